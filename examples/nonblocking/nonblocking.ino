@@ -0,0 +1,37 @@
+#include <WiFiProvisioner.h>
+
+WiFiProvisioner provisioner;
+
+unsigned long lastBlink = 0;
+bool ledState = false;
+
+void setup() {
+  Serial.begin(9600);
+  pinMode(LED_BUILTIN, OUTPUT);
+
+  // Set the success callback
+  provisioner.onSuccess(
+      [](const char *ssid, const char *password, const char *input,
+         const char *username, const char *servicePassword) {
+        Serial.printf("Provisioning successful! Connected to SSID: %s\n", ssid);
+      });
+
+  // Bring the portal up; it runs from provisioner.handle() in loop()
+  if (!provisioner.begin()) {
+    Serial.println("Failed to start the provisioning portal.");
+  }
+}
+
+void loop() {
+  // Serve the portal while it is up
+  if (provisioner.isActive()) {
+    provisioner.handle();
+  }
+
+  // The application keeps running meanwhile
+  if (millis() - lastBlink >= 500) {
+    lastBlink = millis();
+    ledState = !ledState;
+    digitalWrite(LED_BUILTIN, ledState);
+  }
+}
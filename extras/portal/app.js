@@ -0,0 +1,810 @@
+// --- SVG Icons ---
+const svgs = {
+  10: `d="m6.67 14.86l3.77 4.7c.8 1 2.32 1 3.12 0l3.78-4.7C17.06 14.65 15.03 13 12 13s-5.06 1.65-5.33 1.86z"/><path fill="var(--font-color)" fill-opacity=".3" d="M23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0L23.64 7z"/></svg>`,
+  11: `fill-opacity=".3" d="M15.5 14.5c0-2.8 2.2-5 5-5c.36 0 .71.04 1.05.11L23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0l1.94-2.42V14.5z"/><path fill="var(--font-color)" d="M15.5 14.5c0-.23.04-.46.07-.68c-.92-.43-2.14-.82-3.57-.82c-3 0-5.1 1.7-5.3 1.9l3.74 4.66c.8 1 2.32 1 3.12 0l1.94-2.42V14.5zM23 16v-1.5c0-1.4-1.1-2.5-2.5-2.5S18 13.1 18 14.5V16c-.5 0-1 .5-1 1v4c0 .5.5 1 1 1h5c.5 0 1-.5 1-1v-4c0-.5-.5-1-1-1zm-1 0h-3v-1.5c0-.8.7-1.5 1.5-1.5s1.5.7 1.5 1.5V16z"/></svg>`,
+  20: `fill-opacity=".3" d="M23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0L23.64 7z"/><path fill="var(--font-color)" d="m4.79 12.52l5.65 7.04c.8 1 2.32 1 3.12 0l5.65-7.05C18.85 12.24 16.1 10 12 10s-6.85 2.24-7.21 2.52z"/></svg>`,
+  21: `fill-opacity=".3" d="M15.5 14.5c0-2.8 2.2-5 5-5c.36 0 .71.04 1.05.11L23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0l1.94-2.42V14.5z"/><path fill="var(--font-color)" d="M15.5 14.5c0-1.34.51-2.53 1.34-3.42C15.62 10.51 13.98 10 12 10c-4.1 0-6.8 2.2-7.2 2.5l5.64 7.05c.8 1 2.32 1 3.12 0l1.94-2.42V14.5zM23 16v-1.5c0-1.4-1.1-2.5-2.5-2.5S18 13.1 18 14.5V16c-.5 0-1 .5-1 1v4c0 .5.5 1 1 1h5c.5 0 1-.5 1-1v-4c0-.5-.5-1-1-1zm-1 0h-3v-1.5c0-.8.7-1.5 1.5-1.5s1.5.7 1.5 1.5V16z"/></svg>`,
+  30: `fill-opacity=".3" d="M23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0L23.64 7z"/><path fill="var(--font-color)" d="m3.53 10.95l6.91 8.61c.8 1 2.32 1 3.12 0l6.91-8.61C20.04 10.62 16.81 8 12 8s-8.04 2.62-8.47 2.95z"/></svg>`,
+  31: `fill-opacity=".3" d="M15.5 14.5c0-2.8 2.2-5 5-5c.36 0 .71.04 1.05.11L23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0l1.94-2.42V14.5z"/><path fill="var(--font-color)" d="M15.5 14.5a4.92 4.92 0 0 1 3.27-4.68C17.29 8.98 14.94 8 12 8c-4.81 0-8.04 2.62-8.47 2.95l6.91 8.61c.8 1 2.32 1 3.12 0l1.94-2.42V14.5zM23 16v-1.5c0-1.4-1.1-2.5-2.5-2.5S18 13.1 18 14.5V16c-.5 0-1 .5-1 1v4c0 .5.5 1 1 1h5c.5 0 1-.5 1-1v-4c0-.5-.5-1-1-1zm-1 0h-3v-1.5c0-.8.7-1.5 1.5-1.5s1.5.7 1.5 1.5V16z"/></svg>`,
+  40: `d="M23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0L23.64 7z"/></svg>`,
+  41: `d="M23.21 8.24C20.22 5.6 16.3 4 12 4S3.78 5.6.79 8.24C.35 8.63.32 9.3.73 9.71l5.62 5.63l4.94 4.95c.39.39 1.02.39 1.42 0l2.34-2.34V15c0-.45.09-.88.23-1.29c.54-1.57 2.01-2.71 3.77-2.71h2.94l1.29-1.29c.4-.41.37-1.08-.07-1.47z"/><path fill="var(--font-color)" d="M22 16v-1c0-1.1-.9-2-2-2s-2 .9-2 2v1c-.55 0-1 .45-1 1v3c0 .55.45 1 1 1h4c.55 0 1-.45 1-1v-3c0-.55-.45-1-1-1zm-1 0h-2v-1c0-.55.45-1 1-1s1 .45 1 1v1z"/></svg>`,
+};
+const eye_open = `M21.92 11.6C19.9 6.91 16.1 4 12 4s-7.9 2.91-9.92 7.6a1 1 0 0 0 0 .8C4.1 17.09 7.9 20 12 20s7.9-2.91 9.92-7.6a1 1 0 0 0 0-.8ZM12 18c-3.17 0-6.17-2.29-7.9-6C5.83 8.29 8.83 6 12 6s6.17 2.29 7.9 6c-1.73 3.71-4.73 6-7.9 6Zm0-10a4 4 0 1 0 4 4a4 4 0 0 0-4-4Zm0 6a2 2 0 1 1 2-2a2 2 0 0 1-2 2Z`;
+const eye_close = `M10.94 6.08A6.93 6.93 0 0 1 12 6c3.18 0 6.17 2.29 7.91 6a15.23 15.23 0 0 1-.9 1.64a1 1 0 0 0-.16.55a1 1 0 0 0 1.86.5a15.77 15.77 0 0 0 1.21-2.3a1 1 0 0 0 0-.79C19.9 6.91 16.1 4 12 4a7.77 7.77 0 0 0-1.4.12a1 1 0 1 0 .34 2ZM3.71 2.29a1 1 0 0 0-1.42 1.42l3.1 3.09a14.62 14.62 0 0 0-3.31 4.8a1 1 0 0 0 0 .8C4.1 17.09 7.9 20 12 20a9.26 9.26 0 0 0 5.05-1.54l3.24 3.25a1 1 0 0 0 1.42 0a1 1 0 0 0 0-1.42Zm6.36 9.19l2.45 2.45A1.81 1.81 0 0 1 12 14a2 2 0 0 1-2-2a1.81 1.81 0 0 1 .07-.52ZM12 18c-3.18 0-6.17-2.29-7.9-6a12.09 12.09 0 0 1 2.7-3.79L8.57 10A4 4 0 0 0 14 15.43L15.59 17A7.24 7.24 0 0 1 12 18Z`;
+
+// --- DOM Element References ---
+const table = document.getElementById("table-body");
+const form = document.getElementById("network_form");
+const code_listener = document.getElementById("code");
+const ssid_listener = document.getElementById("ssid"); // Hidden SSID input
+const password_listener = document.getElementById("password"); // Network password input
+const username_listener = document.getElementById("username"); // Service username input
+const service_password_listener = document.getElementById("service_password"); // Service password input
+
+// --- Add Event Listeners ---
+if(form) form.addEventListener("submit", submitForm);
+if(code_listener) code_listener.addEventListener("input", updateValue);
+if(ssid_listener) ssid_listener.addEventListener("input", updateValue);
+if(password_listener) password_listener.addEventListener("input", updateValue);
+if(username_listener) username_listener.addEventListener("input", updateValue);
+if(service_password_listener) service_password_listener.addEventListener("input", updateValue);
+
+// --- Config (JSON blob rendered by the C++ code into the page) ---
+const portal_config = JSON.parse(document.getElementById("portal-config").textContent);
+const title_text = portal_config.title;
+const title_sub = portal_config.subtitle;
+const title_info = portal_config.info;
+const input_name_text = portal_config.input_text;
+const input_lenght = portal_config.input_length;
+const connection_successful_text = portal_config.connection_successful;
+const footer_text = portal_config.footer;
+const reset_confirmation_text = portal_config.reset_confirmation;
+const username_text = portal_config.username_text;
+const service_password_text = portal_config.service_password_text;
+const show_input_field = portal_config.show_input;
+const show_login_fields = portal_config.show_login;
+const reset_show = portal_config.show_reset;
+
+// The logo is its own cacheable resource. It is inlined rather than used as
+// an <img> so that it can pick up the page's CSS variables.
+fetch(portal_config.logo)
+  .then((response) => (response.ok ? response.text() : ""))
+  .then((svg) => {
+    const logoContainer = document.getElementById("logo-container");
+    if (logoContainer) logoContainer.innerHTML = svg;
+  })
+  .catch(() => {});
+
+// --- Initialization on DOM ready ---
+window.addEventListener("DOMContentLoaded", (event) => {
+    
+   // Set theme color RGB variables for focus ring (parse from hex)
+   try {
+       const style = getComputedStyle(document.documentElement);
+       const hex = style.getPropertyValue('--theme-color').trim();
+       if (hex && hex.startsWith('#') && (hex.length === 7 || hex.length === 4)) {
+          const fullHex = hex.length === 4 ? `#${hex[1]}${hex[1]}${hex[2]}${hex[2]}${hex[3]}${hex[3]}` : hex;
+          const r = parseInt(fullHex.substring(1, 3), 16);
+          const g = parseInt(fullHex.substring(3, 5), 16);
+          const b = parseInt(fullHex.substring(5, 7), 16);
+          document.documentElement.style.setProperty('--theme-color-r', r);
+          document.documentElement.style.setProperty('--theme-color-g', g);
+          document.documentElement.style.setProperty('--theme-color-b', b);
+       } else {
+           console.warn("Could not parse --theme-color for focus ring:", hex);
+       }
+   } catch(e) { console.error("Error setting theme color RGB variables:", e); }
+
+
+  // Use JS constants defined above to set text content, placeholders etc.
+  const appTitle = document.getElementById("app-title");
+  const appSubtitle = document.getElementById("app-subtitle");
+  const infoText = document.getElementById("info-text");
+  const codeInput = document.getElementById("code");
+  const codeLabel = document.getElementById("label-code");
+  const userLabel = document.getElementById("label-username");
+  const userInput = document.getElementById("username");
+  const servicePassLabel = document.getElementById("label-service-password");
+  const servicePassInput = document.getElementById("service_password");
+  const copyrightText = document.getElementById("copyright");
+  const resetLink = document.getElementById("factorylink");
+
+  if(appTitle) appTitle.textContent = title_text;
+  if(appSubtitle) appSubtitle.textContent = title_sub;
+  if(infoText) infoText.textContent = title_info;
+
+   if(codeInput) {
+       codeInput.setAttribute("maxlength", input_lenght);
+       codeInput.placeholder = input_name_text;
+   }
+   if(codeLabel) codeLabel.textContent = input_name_text;
+
+   if(userLabel) userLabel.textContent = username_text;
+   if(userInput) userInput.placeholder = username_text;
+
+   if(servicePassLabel) servicePassLabel.textContent = service_password_text;
+   if(servicePassInput) servicePassInput.placeholder = service_password_text;
+
+
+  if(copyrightText) copyrightText.textContent = footer_text;
+
+  if (!reset_show && resetLink) {
+    resetLink.style.display = "none";
+  }
+});
+
+// --- Load networks on page load ---
+// The page normally arrives with the device's latest scan inlined; only ask
+// /update when there was none yet.
+window.addEventListener("DOMContentLoaded", (event) => {
+  if (Array.isArray(portal_config.network)) {
+    renderNetworks(portal_config.network, false);
+    showcodeField(!!show_input_field);
+    showLoginFields(!!show_login_fields);
+  } else {
+    loadSSID(); // Initial network scan on load
+  }
+});
+
+function updateValue(e) {
+  // Clear error message for the input field being typed in
+  showError(e.target.id, "", false);
+}
+
+function isRadioChecked() {
+  // Check if any network radio button (including hidden) is checked
+  return Array.from(
+    document.querySelectorAll('input[name="ssid"]')
+  ).some((radio) => radio.checked);
+}
+
+function showError(name, message, state) {
+  // Show/hide error message and styling for a given input field name
+   // Use lowercase name consistently
+  const fieldName = name ? name.toLowerCase() : '';
+  if (!fieldName) return; // Exit if name is invalid
+  
+  // Find input block and message element by convention
+  const block = document.getElementById(`error-${fieldName}-input`);
+  const messageElem = document.getElementById(`error-${fieldName}-message`);
+
+  // Toggle error class on the container for styling input
+  // Check if block exists before trying to access classList
+  if (block) {
+       block.classList.toggle("error", state);
+   } else if (fieldName === 'submit') {
+       // Handle submit error display differently if needed, e.g., show it directly
+       const submitErrorElem = document.getElementById('error-submit-message');
+       if(submitErrorElem) submitErrorElem.textContent = state ? message : "";
+   }
+
+  // Set error message text
+  if (messageElem) messageElem.textContent = state ? message : "";
+}
+
+
+function resetErrors() {
+  // Clear errors for all potentially visible fields
+  ["submit", "code", "password", "ssid", "username", "service_password"].forEach((field) => {
+    showError(field, "", false);
+  });
+}
+
+function connectingState(state, text) {
+  // Update submit button text and state (disabled/enabled) + spinner visibility
+  const ring = document.getElementById("connecting-ring");
+  const submitBtn = document.getElementById("submit-btn");
+
+  if (!submitBtn) { // Safety check
+    return;
+  }
+
+  const buttonTxt = state ? (text || "Connecting") : "Connect";
+  // Update spinner visibility directly
+  if(ring) ring.style.display = state ? "inline-block" : "none"; // Use inline-block
+  
+  // Set button text content without overwriting the span
+  let textNode = Array.from(submitBtn.childNodes).find(node => node.nodeType === Node.TEXT_NODE && node.textContent.trim() !== '');
+  if (textNode) {
+      textNode.textContent = buttonTxt + (state ? ' ' : ''); // Add space before spinner
+  } else {
+       // If no text node, prepend it
+       submitBtn.insertBefore(document.createTextNode(buttonTxt + (state ? ' ' : '')), submitBtn.firstChild);
+  }
+
+  submitBtn.disabled = state;
+}
+
+
+function submitForm(event) {
+  event.preventDefault(); // Prevent default form submission
+
+  // --- Validation ---
+  const validations = [
+    // 1. Check if a network is selected (either listed or hidden)
+    {
+      condition: !isRadioChecked(),
+      field: "submit", // General form error
+      message: "Please select a WiFi network or specify a hidden one.",
+    },
+    // 2. Validate 'Device Key' if it's visible AND configured to be shown
+     {
+      condition: isCodeVisible() && show_input_field, // Check both visibility and config flag
+      field: "code",
+      message: (() => {
+          const value = code_listener ? code_listener.value.trim() : '';
+          // Only require if field is configured to be shown (show_input_field)
+          if (!value && show_input_field) {
+              return `${input_name_text} is required.`;
+          }
+          // Check length only if there is a value
+          if (value && value.length > input_lenght) {
+              return `${input_name_text} cannot exceed ${input_lenght} characters.`;
+          }
+          return null; // No error
+      })(),
+     },
+     // 3. Validate 'Username' if login fields are visible AND configured to be shown
+    {
+      condition: isLoginVisible() && show_login_fields && (!username_listener || !username_listener.value.trim()),
+      field: "username",
+      message: `${username_text} is required.`,
+    },
+     // 4. Validate 'Service Password' if login fields are visible AND configured to be shown
+    {
+      condition: isLoginVisible() && show_login_fields && (!service_password_listener || !service_password_listener.value),
+      field: "service_password",
+      message: `${service_password_text} is required.`,
+    },
+    // 5. Validate 'Hidden SSID' if hidden network is selected
+    {
+      condition: isHidden() && (!ssid_listener || !ssid_listener.value.trim()),
+      field: "ssid", // ID of the hidden SSID input
+      message: "Hidden Network SSID is required.",
+    },
+    // 6. Validate 'Network Password' if required (selected network is secured OR hidden network is selected)
+    {
+       condition: (isAuth() || isHidden()) && (!password_listener || !password_listener.value), // Don't trim password
+       field: "password", // ID of the network password input
+       message: "Network Password is required.",
+    },
+  ];
+
+  let hasErrors = false;
+  resetErrors(); // Clear previous errors first
+
+  validations.forEach(({ condition, field, message }) => {
+     // Only validate if the message function returns a non-null message
+     const errorMessage = typeof message === 'function' ? message() : message;
+    if (condition && errorMessage) {
+      showError(field, errorMessage, true);
+      hasErrors = true;
+    }
+  });
+
+  if (hasErrors) return; // Stop if validation failed
+
+  // --- If validation passes ---
+  connectingState(true); // Show connecting status
+  disableForm(true); // Disable form elements
+
+  // --- Prepare Payload ---
+  let payload = {};
+
+  // Get SSID (either selected radio or hidden input)
+  if (isHidden()) {
+    payload.ssid = ssid_listener ? ssid_listener.value.trim() : '';
+  } else {
+    const selectedRadio = document.querySelector(
+      'input[name="ssid"]:checked' // Ensure it's checked
+    );
+    if (selectedRadio) { // Should always be true if validation passed
+        payload.ssid = selectedRadio.value;
+    } else {
+       // Fallback/error - should not happen if validation is correct
+       console.error("No SSID selected despite passing validation");
+       showError("submit", "Internal Error: No SSID selected.", true);
+       connectingState(false);
+       disableForm(false);
+       return;
+    }
+  }
+
+
+  // Get Network Password if needed
+  if ((isAuth() || isHidden()) && password_listener && password_listener.value) {
+    payload.password = password_listener.value;
+  }
+
+  // Get Device Key if visible AND configured to be shown
+  if (isCodeVisible() && show_input_field && code_listener) {
+    payload.code = code_listener.value.trim(); // Trim device key if needed
+  }
+  
+  // Get Login Credentials if visible AND configured to be shown
+  if (isLoginVisible() && show_login_fields) {
+     payload.username = username_listener ? username_listener.value.trim() : ''; // Trim username
+     payload.service_password = service_password_listener ? service_password_listener.value : ''; // Don't trim password
+  }
+
+  // --- Send Request ---
+  console.log("Sending payload:", JSON.stringify(payload)); // Log for debugging
+  fetch("/configure", {
+    method: "POST",
+    headers: { "Content-Type": "application/json" },
+    body: JSON.stringify(payload),
+  })
+    .then((response) => {
+       // 202: attempt started; 409: one is already running, follow that one
+       if (!response.ok && response.status !== 409) {
+           // Try to get error text if available
+           return response.text().then(text => {
+                console.error("Configure request failed:", response.status, text);
+               throw new Error(`Connection request failed: ${response.status}`);
+           });
+       }
+      return response.json();
+    })
+    .then((status) => followConnect(status, payload, 0))
+    .catch((error) => {
+        console.error("Fetch error during configure:", error);
+        showError("submit", `Error during connection. Please check device logs.`, true);
+        connectingState(false); // Re-enable form on fetch error
+        disableForm(false);
+     });
+}
+
+// Button text for each phase /status reports while an attempt runs
+const connect_phase_text = {
+  associating: "Connecting",
+  dhcp: "Getting address",
+  validating: "Checking",
+};
+
+function followConnect(status, payload, misses) {
+  // Poll /status until the attempt is done or failed. A few failed polls
+  // are tolerated: the portal can drop briefly while the radio joins the
+  // network.
+  if (status.phase === "done") {
+    successPage(payload.ssid); // Show success page
+    return;
+  }
+  if (status.phase === "failed" || status.phase === "idle") {
+    connectFailed(status.reason || 'Unknown', payload);
+    return;
+  }
+  connectingState(true, connect_phase_text[status.phase]);
+
+  setTimeout(() => {
+    fetch("/status")
+      .then((response) => {
+        if (!response.ok) {
+          throw new Error(`Status request failed: ${response.status}`);
+        }
+        return response.json();
+      })
+      .then((next) => followConnect(next, payload, 0))
+      .catch((error) => {
+        if (misses >= 10) {
+          console.error("Lost the device while connecting:", error);
+          connectFailed('Unknown', payload);
+          return;
+        }
+        followConnect(status, payload, misses + 1);
+      });
+  }, 500);
+}
+
+function connectFailed(reason, payload) {
+  // Handle specific errors based on 'reason'
+  console.warn("Connection failed. Reason:", reason);
+
+  if (reason === "code") {
+    showError("code", `Invalid ${input_name_text}`, true);
+  } else if (reason === "auth_failed") {
+     showError("password", "Invalid password.", true);
+  } else if (reason === "handshake_timeout") {
+     showError("password", "No answer to the password; it is probably wrong.", true);
+  } else if (reason === "no_ap_found") {
+     showError("submit", `Could not find '${payload.ssid}'. Network may be out of range.`, true);
+  } else if (reason === "assoc_failed") {
+     showError("submit", `'${payload.ssid}' refused the connection. Please try again.`, true);
+  } else if (reason === "no_ip") {
+     showError("submit", `Connected to '${payload.ssid}', but got no IP address from it.`, true);
+  } else if (reason === "timeout") {
+     showError("submit", `Timed out connecting to '${payload.ssid}'. Please try again.`, true);
+  } else if (reason === "login") { // Handle potential login failure reason
+      showError("username", "Invalid service username or password.", true); // Show general login error
+      showError("service_password", "Invalid service username or password.", true);
+  }
+   else {
+    // Generic error
+    showError( "submit", `Connection failed. Please check credentials and try again.`, true);
+  }
+   connectingState(false); // Re-enable form on error
+   disableForm(false);
+}
+
+
+function successPage(ssid_text) {
+  // Replace card content with success message and checkmark animation
+  const card = document.getElementById("main-card");
+  if (!card) return; // Safety check
+  card.innerHTML = `
+ <div class="wrapper">
+    <svg class="checkmark" xmlns="http://www.w3.org/2000/svg" viewBox="0 0 52 52"> <circle class="checkmark__circle" cx="26" cy="26" r="25" fill="none"/> <path class="checkmark__check" fill="none" d="M14.1 27.2l7.1 7.2 16.7-16.8"/></svg>
+ </div>
+ <div class="container" style="padding: 1rem;">
+   <h2 style="color:#7ac142;word-break: break-word;">Success</h2>
+   <p style="color:#7ac142;word-break: break-word;font-size:1.2rem;margin-bottom: 0.5rem;">Successfully connected to</p>
+   <p style="color:#7ac142;word-break: break-word;margin-top: 0rem; font-weight: bold;">${ssid_text}</p>
+   <p style="opacity: 0.5; margin-top: 1rem;">${connection_successful_text}</p>
+   <p style="opacity: 0.5;">You can close this window now.</p>
+ </div>
+ `;
+  // Optionally hide the footer or other elements
+  const footer = document.getElementById("footer");
+  if(footer) footer.style.display = 'none';
+}
+
+
+function onRadio(element) {
+  // When a radio button is clicked (either listed SSID or 'Hidden Network')
+  if (!element) return;
+  resetErrors(); // Clear any existing errors
+
+  const isHiddenNetwork = element.id === "hiddennetwork_radio";
+  const isListedNetwork = !isHiddenNetwork;
+
+  // Show/hide the input field for the hidden SSID name
+  showssidField(isHiddenNetwork);
+
+  // Determine if the selected network requires a password
+  let needsPassword = false;
+  if (isHiddenNetwork) {
+      needsPassword = true; // Assume hidden networks always need a password for simplicity
+  } else if (isListedNetwork) {
+      // Check the data-auth attribute of the selected listed network
+      needsPassword = element.dataset.auth && parseInt(element.dataset.auth) > 0;
+  }
+  
+  // Show/hide the network password input field
+  showpasswordField(needsPassword);
+
+  // Uncheck other radio buttons if 'Hidden Network' is selected
+  if (isHiddenNetwork) {
+    const radios = document.querySelectorAll(
+      'input[name="ssid"]:not(#hiddennetwork_radio)'
+    );
+    radios.forEach((radio) => (radio.checked = false));
+  } else {
+       // If a listed network is selected, uncheck 'Hidden Network'
+       const hiddenRadio = document.getElementById("hiddennetwork_radio");
+       if(hiddenRadio) hiddenRadio.checked = false;
+  }
+}
+
+
+function disableForm(state) {
+  // Disable or enable all form elements (inputs, buttons)
+  if (!form) return;
+  Array.from(form.elements).forEach((el) => (el.disabled = state));
+  // Also disable/enable the factory reset link
+  disableLinks(state);
+}
+
+function refreshSpin(state) {
+   // Show/hide the spinning animation on the refresh button
+  const icon = document.getElementById("refresh-icon");
+  if(icon) icon.classList.toggle("icn-spinner", state);
+}
+
+// Pending re-poll of /update while the device is scanning
+let scanPollTimer = null;
+
+// `refresh` asks the device for a new scan; `quiet` updates the list
+// without blocking the form (used while polling for a running scan).
+function loadSSID(refresh = false, quiet = false) {
+  console.log("loadSSID called - fetching /update"); // Debug log
+  clearTimeout(scanPollTimer);
+  if (!quiet) {
+    disableForm(true); // Disable form during scan
+    refreshSpin(true); // Show spinner
+    resetErrors(); // Clear errors
+
+     // Clear existing table rows and show scanning message
+     if(table) table.innerHTML = '<tr><td colspan="3" style="text-align: center; color: grey;">Scanning for networks...</td></tr>';
+  }
+
+  // Add cache buster to prevent browser caching of the result
+  const url = "/update?" + (refresh ? "refresh=1&" : "") + "t=" + Date.now();
+
+  fetch(url) // Use the URL with cache buster
+    .then((response) => {
+      console.log("Fetch response status:", response.status); // Debug log
+      if (!response.ok) {
+          // Log response text for more details on failure
+           return response.text().then(text => {
+               console.error(`Network scan request failed: ${response.status} ${response.statusText}`, text);
+               throw new Error(`Network scan failed (${response.status})`);
+           });
+       }
+      return response.json(); // Attempt to parse JSON
+    })
+    .then((jsonResponse) => {
+       console.log("Received network data JSON:", jsonResponse); // Debug log
+       if (!table) return; // Safety check
+       renderNetworks(jsonResponse.network, !!jsonResponse.scanning);
+
+      // Show/hide fields based on JSON response (use injected boolean constants for logic elsewhere)
+      // Use !! to ensure boolean conversion
+      showcodeField(!!jsonResponse.show_code); 
+      showLoginFields(!!jsonResponse.show_login);
+      console.log("showcodeField called with:", !!jsonResponse.show_code); // Debug
+      console.log("showLoginFields called with:", !!jsonResponse.show_login); // Debug
+
+      // The device answers from its last scan; check back while a new one runs
+      if (jsonResponse.scanning) {
+        scanPollTimer = setTimeout(() => loadSSID(false, true), 1500);
+      }
+    })
+    .catch((error) => {
+      console.error("Error during network scan fetch/processing:", error); // More specific error log
+      if (quiet) return;
+      showError("submit", `Error fetching networks. Please refresh.`, true);
+      if(table) table.innerHTML = '<tr><td colspan="3" style="text-align: center; color: red;">Error loading networks. Refresh or check device.</td></tr>'; // Show error in table
+    })
+    .finally(() => {
+      if (!quiet) {
+        refreshSpin(false); // Hide spinner
+        disableForm(false); // Re-enable form
+      }
+       console.log("loadSSID finished"); // Debug log
+    });
+}
+
+
+// Fills the network table from a scan result (from /update or inlined in
+// the page), keeping the user's current choice selected.
+function renderNetworks(networks, scanning) {
+   if (!table) return; // Safety check
+   const checked = table.querySelector('input[name="ssid"]:checked');
+   const selected = checked ? checked.value : null;
+   // Clear existing table rows again
+   table.innerHTML = '';
+
+  // Check if network data is valid array
+  if (networks && Array.isArray(networks) && networks.length > 0) {
+       console.log(`Processing ${networks.length} networks...`); // Debug log
+       networks.forEach(({ ssid, authmode, rssi }) => {
+           // Basic validation of data before adding row
+           if (typeof ssid === 'string' && typeof authmode === 'number' && typeof rssi === 'number') {
+               addTableRow(ssid, authmode, rssi); // Add row for each network
+           } else {
+               console.warn("Received invalid network data item:", { ssid, authmode, rssi });
+           }
+       });
+       table.querySelectorAll('input[name="ssid"]').forEach((radio) => {
+           if (radio.value === selected) radio.checked = true;
+       });
+       console.log("Finished processing networks."); // Debug log
+   } else if (scanning) {
+       table.innerHTML = '<tr><td colspan="3" style="text-align: center; color: grey;">Scanning for networks...</td></tr>';
+   } else {
+       console.log("No networks found or network data is empty/invalid.");
+       table.innerHTML = '<tr><td colspan="3" style="text-align: center; color: grey;">No WiFi networks found. Try refreshing.</td></tr>';
+   }
+}
+
+
+function addTableRow(ssid, authmode, rssi) {
+  // Add a row to the network table
+   if (!table) return; // Safety check
+  const locked = authmode > 0 ? 1 : 0; // Use 1 for locked, 0 for open
+   // Ensure RSSI level is within 0-4 range expected by svgs object keys
+   const safeSignalLevel = Math.max(0, Math.min(4, rssi || 0)); // Default to 0 if rssi is undefined/null
+  const iconKey = `${safeSignalLevel}${locked}`;
+  const iconPath = svgs[iconKey]; // Get the correct SVG path
+
+   let iconHtml = '<!-- Icon N/A -->'; // Default if icon not found
+   if (iconPath) {
+       // Note: iconPath already includes the closing </svg> tag in the svgs object
+       iconHtml = `<svg xmlns="http://www.w3.org/2000/svg" style="vertical-align: middle;" width="1.2em" height="1.2em" preserveAspectRatio="xMidYMid meet" viewBox="0 0 24 24"><path fill="var(--font-color)" ${iconPath}`;
+   } else {
+        console.warn(`No SVG found for signal key ${iconKey} (RSSI level ${safeSignalLevel}, locked: ${locked})`);
+   }
+
+
+  // Use textContent for SSID to prevent potential XSS if SSID contains HTML
+  const safeSSID = document.createElement('span');
+  safeSSID.textContent = ssid;
+   // Create a safer ID by replacing non-alphanumeric chars with underscores + random suffix
+   const uniqueId = `ssid-${ssid.replace(/[^a-zA-Z0-9]/g, '_')}-${Math.random().toString(36).substring(2, 7)}`;
+
+
+  table.innerHTML += `
+ <tr>
+     <td class="radiossid">
+       <input type="radio" name="ssid" value="${ssid}" data-auth="${authmode}" onclick="onRadio(this)" id="${uniqueId}" class="circle">
+     </td>
+      <td><label for="${uniqueId}">${safeSSID.innerHTML}</label></td>
+     <td class="signal">${iconHtml}</td>
+ </tr>
+ `;
+}
+
+ // Updated function to handle multiple password fields
+function togglePassShow(inputId, iconId) {
+    const input = document.getElementById(inputId);
+    const iconPath = document.getElementById(iconId); // Get the path element
+    if (!input || !iconPath) {
+       console.warn("Could not find input or icon element for togglePassShow:", inputId, iconId);
+       return;
+    }
+
+    const isPassword = input.type === "password";
+    input.type = isPassword ? "text" : "password";
+    iconPath.setAttribute("d", isPassword ? eye_open : eye_close); // Set the 'd' attribute of the path
+}
+
+
+function showssidField(state) {
+    // Show/hide hidden SSID input block
+     const elem = document.getElementById("hiddenNetwork");
+     if(elem) elem.style.display = state ? "" : "none";
+}
+
+function showpasswordField(state) {
+   // Show/hide network password input block
+    const elem = document.getElementById("hiddenPassword");
+     if(elem) elem.style.display = state ? "" : "none";
+}
+
+function showcodeField(state) {
+  // Show/hide device key input block
+    const elem = document.getElementById("codeinputBlock");
+     if(elem) elem.style.display = state ? "" : "none";
+     console.log("codeinputBlock display set to:", state ? "" : "none"); // Debug
+}
+
+function showLoginFields(state) {
+   // Show/hide both username and service password blocks
+  const userBlock = document.getElementById("loginFieldsBlock");
+  const passBlock = document.getElementById("servicePasswordBlock");
+   if(userBlock) userBlock.style.display = state ? "" : "none";
+   if(passBlock) passBlock.style.display = state ? "" : "none";
+   console.log("loginFieldsBlock display set to:", state ? "" : "none"); // Debug
+}
+
+function isLoginVisible() {
+   // Check if the username block is visible (implies both login fields are)
+   const userBlock = document.getElementById("loginFieldsBlock");
+  return userBlock ? userBlock.style.display !== "none" : false;
+}
+
+
+function isHidden() {
+    // Check if the 'Hidden Network' radio is selected
+    const hiddenRadio = document.getElementById("hiddennetwork_radio");
+    return hiddenRadio ? hiddenRadio.checked : false;
+}
+
+function isAuth() {
+  // Check if the currently selected *listed* network requires authentication
+  const selectedRadio = document.querySelector(
+    'input[name="ssid"]:checked:not(#hiddennetwork_radio)' // Exclude hidden radio
+  );
+  // Check data-auth attribute (0 = open, >0 = secured)
+  return selectedRadio ? parseInt(selectedRadio.dataset.auth || "0") > 0 : false;
+}
+
+function isCodeVisible() {
+    // Check if device key input block is visible
+    const codeBlock = document.getElementById("codeinputBlock");
+    return codeBlock ? codeBlock.style.display !== "none" : false;
+}
+function isPasswordVisible() {
+   // Check if network password input block is visible
+    const passBlock = document.getElementById("hiddenPassword");
+    return passBlock ? passBlock.style.display !== "none" : false;
+}
+function isSsidVisible() {
+   // Check if hidden SSID input block is visible
+    const ssidBlock = document.getElementById("hiddenNetwork");
+    return ssidBlock ? ssidBlock.style.display !== "none" : false;
+}
+
+function disableLinks(state) {
+   // Disable/enable the factory reset link
+  const link = document.getElementById("factorylink");
+   if(link) link.style.pointerEvents = state ? "none" : "";
+   if(link) link.style.opacity = state ? "0.5" : "1"; // Visually fade when disabled
+}
+
+
+function factoryReset() {
+  // Show confirmation dialog for factory reset
+  const card = document.getElementById("main-card");
+   if (!card) return; // Safety check
+  card.innerHTML = `
+         <div id="factory-reset-section">
+           <h3 style="padding-top: 1rem; margin: 0rem;">Factory Reset</h3>
+           <p>Are you sure you want to reset the device to factory settings?</p>
+           <p style="color: gray; margin-top: 1rem;">${reset_confirmation_text}</p>
+           <div style="display: flex; justify-content: center; gap: 1rem; margin-top: 1.5rem;">
+              <button
+                id="cancelReset"
+                class="btn-process"
+                style="background-color: gray;"
+                onclick="cancelFactoryReset();"
+                >
+                Cancel <span id="cancel-spinner" style="display: none;"></span>
+              </button>
+              <button
+                id="resetYes"
+                class="btn-process"
+                style="background-color: #cc0033;" /* Red color for reset */
+                onclick="startFactoryReset();"
+                >
+                Reset <span id="connecting-ring" style="display: none;"></span>
+              </button>
+           </div>
+           <p id="reset-feedback" class="error-message"></p>
+         </div>
+       `;
+       // Hide footer during confirmation
+        const footer = document.getElementById("footer");
+        if(footer) footer.style.display = 'none';
+}
+
+function disableFactoryResetButtons(state) {
+    // Disable/enable reset confirmation buttons
+    const yesButton = document.getElementById("resetYes");
+    const noButton = document.getElementById("cancelReset");
+    if(yesButton) yesButton.disabled = state;
+    if(noButton) noButton.disabled = state;
+     disableLinks(state); // Also disable link if needed
+}
+
+
+function startFactoryReset() {
+  disableFactoryResetButtons(true); // Disable buttons
+
+  const resetButton = document.getElementById("resetYes");
+  const factoryResetSection = document.getElementById("factory-reset-section");
+  const feedback = document.getElementById("reset-feedback");
+
+  if(!resetButton || !factoryResetSection || !feedback) return; // Safety check
+
+  // Show spinner on reset button
+  resetButton.innerHTML = `Resetting<span id="connecting-ring" style="display: inline-block;"></span>`;
+  feedback.textContent = ""; // Clear previous feedback
+
+  fetch("/factoryreset", { method: "POST" })
+    .then((response) => {
+       if (!response.ok) {
+           // Try to get error text if available
+           return response.text().then(text => {
+                console.error("Factory reset request failed:", response.status, text);
+               throw new Error(`Reset request failed: ${response.status}`);
+           });
+       }
+       // Don't expect JSON, just success status
+       return response.text(); // Consume body
+    })
+    .then(() => {
+          // Show success message within the existing structure
+         factoryResetSection.innerHTML = `
+           <div class="wrapper">
+             <svg class="checkmark" xmlns="http://www.w3.org/2000/svg" viewBox="0 0 52 52">
+               <circle class="checkmark__circle" cx="26" cy="26" r="25" fill="none" />
+               <path class="checkmark__check" fill="none" d="M14.1 27.2l7.1 7.2 16.7-16.8" />
+             </svg>
+           </div>
+           <div class="container" style="padding: 1rem;">
+             <h2 style="color:#7ac142;word-break: break-word;">Reset Success</h2>
+             <p style="color: gray;word-break: break-word;font-size:1.2rem;margin-bottom: 0.5rem;">Factory reset successful.</p>
+             <p style="opacity: 0.5;">Device will restart. Reconnect to AP to configure again.</p>
+           </div>
+         `;
+         // No automatic redirect, user needs to reconnect after ESP32 restart (implied)
+    })
+    .catch((error) => {
+      console.error("Factory reset error:", error);
+      feedback.textContent = `Error during reset. Check device logs.`;
+      disableFactoryResetButtons(false); // Re-enable buttons on error
+       if(resetButton) resetButton.innerHTML = 'Reset <span id="connecting-ring" style="display: none;"></span>'; // Reset button text
+    });
+}
+
+function cancelFactoryReset() {
+  // Simply reload the page to cancel the reset confirmation
+  disableFactoryResetButtons(true); // Disable buttons while reloading
+  const spinner = document.getElementById("cancel-spinner");
+  if(spinner) spinner.style.display = "inline-block"; // Show spinner on cancel
+
+  // Add a small delay before reloading to show spinner
+  setTimeout(() => {
+       window.location.href = "/"; // Reload the root page
+  }, 300);
+}
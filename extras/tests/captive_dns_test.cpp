@@ -0,0 +1,292 @@
+// Checks CaptiveDns over a loopback UDP socket: A and ANY answers, NODATA
+// with an SOA for other types, overrides and NXDOMAIN, refused classes,
+// malformed queries and draining the socket.
+#include "internal/captive_dns.h"
+#include <lwip/sockets.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <sys/time.h>
+#include <vector>
+
+using namespace wifiprov;
+
+namespace {
+
+const uint16_t kPort = 18054;
+
+const uint16_t kTypeA = 1;
+const uint16_t kTypeSoa = 6;
+const uint16_t kTypeAaaa = 28;
+const uint16_t kTypeHttps = 65;
+const uint16_t kTypeAny = 255;
+const uint16_t kClassIn = 1;
+const uint16_t kClassChaos = 3;
+
+int failures = 0;
+
+#define CHECK(condition)                                                                           \
+  do {                                                                                             \
+    if (!(condition)) {                                                                            \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                \
+      ++failures;                                                                                  \
+    }                                                                                              \
+  } while (0)
+
+using Packet = std::vector<uint8_t>;
+
+uint16_t read16(const Packet &p, size_t at) { return (uint16_t)(p[at] << 8 | p[at + 1]); }
+
+uint32_t read32(const Packet &p, size_t at) {
+  return (uint32_t)read16(p, at) << 16 | read16(p, at + 2);
+}
+
+void append16(Packet &p, uint16_t value) {
+  p.push_back(value >> 8);
+  p.push_back(value & 0xFF);
+}
+
+// A query with one question for `name`, recursion desired
+Packet query(const char *name, uint16_t type, uint16_t qclass = kClassIn, uint16_t id = 0x1234) {
+  Packet p;
+  append16(p, id);
+  append16(p, 0x0100); // RD
+  append16(p, 1);      // QDCOUNT
+  append16(p, 0);
+  append16(p, 0);
+  append16(p, 0);
+  const char *label = name;
+  while (*label) {
+    const char *dot = strchr(label, '.');
+    size_t length = dot ? (size_t)(dot - label) : strlen(label);
+    p.push_back((uint8_t)length);
+    p.insert(p.end(), label, label + length);
+    label += length + (dot ? 1 : 0);
+  }
+  p.push_back(0);
+  append16(p, type);
+  append16(p, qclass);
+  return p;
+}
+
+struct Reply {
+  uint16_t id;
+  uint16_t flags;
+  uint8_t rcode;
+  uint16_t questions, answers, authorities, additionals;
+  Packet packet;
+  size_t recordAt; // First byte after the question
+
+  uint16_t recordType() const { return read16(packet, recordAt + 2); }
+  uint32_t recordTtl() const { return read32(packet, recordAt + 6); }
+  // The A record's address, as a.b.c.d
+  std::string address() const {
+    char text[16];
+    size_t at = recordAt + 12;
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", packet[at], packet[at + 1], packet[at + 2],
+             packet[at + 3]);
+    return text;
+  }
+  // The SOA's minimum, the negative TTL
+  uint32_t soaMinimum() const { return read32(packet, packet.size() - 4); }
+};
+
+struct Client {
+  int fd;
+
+  Client() {
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    timeval timeout = {0, 200000};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  }
+  ~Client() { close(fd); }
+
+  void send(const Packet &p) {
+    sockaddr_in server = {};
+    server.sin_family = AF_INET;
+    server.sin_port = htons(kPort);
+    server.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sendto(fd, p.data(), p.size(), 0, (sockaddr *)&server, sizeof(server));
+  }
+
+  // False if no reply came
+  bool receive(Reply &reply) {
+    uint8_t buffer[600];
+    ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+    if (n < 12) {
+      return false;
+    }
+    reply.packet.assign(buffer, buffer + n);
+    reply.id = read16(reply.packet, 0);
+    reply.flags = read16(reply.packet, 2);
+    reply.rcode = reply.flags & 0x0F;
+    reply.questions = read16(reply.packet, 4);
+    reply.answers = read16(reply.packet, 6);
+    reply.authorities = read16(reply.packet, 8);
+    reply.additionals = read16(reply.packet, 10);
+    size_t at = 12;
+    if (reply.questions) {
+      while (at < reply.packet.size() && reply.packet[at]) {
+        at += reply.packet[at] + 1;
+      }
+      at += 5;
+    }
+    reply.recordAt = at;
+    return true;
+  }
+};
+
+// Sends `p`, lets the server answer and reads the reply
+bool ask(CaptiveDns &dns, Client &client, const Packet &p, Reply &reply) {
+  client.send(p);
+  dns.processPending();
+  return client.receive(reply);
+}
+
+void testAnswers(CaptiveDns &dns, Client &client) {
+  Reply reply;
+  Packet a = query("example.com", kTypeA);
+  CHECK(ask(dns, client, a, reply));
+  CHECK(reply.id == 0x1234);
+  CHECK(reply.flags == (0x8000 | 0x0400 | 0x0100)); // QR, AA, RD echoed, NOERROR
+  CHECK(reply.questions == 1 && reply.answers == 1 && reply.authorities == 0 &&
+        reply.additionals == 0);
+  CHECK(memcmp(reply.packet.data() + 12, a.data() + 12, a.size() - 12) == 0);
+  CHECK(reply.recordType() == kTypeA && reply.recordTtl() == CaptiveDns::kTtl);
+  CHECK(reply.address() == "192.168.4.1");
+  CHECK(reply.packet.size() == a.size() + 16);
+
+  CHECK(ask(dns, client, query("example.com", kTypeAny), reply));
+  CHECK(reply.answers == 1 && reply.address() == "192.168.4.1");
+
+  // Other types get NODATA with an SOA, so the client caches the answer
+  for (uint16_t type : {kTypeAaaa, kTypeHttps}) {
+    CHECK(ask(dns, client, query("example.com", type), reply));
+    CHECK(reply.rcode == 0 && reply.answers == 0 && reply.authorities == 1);
+    CHECK(reply.recordType() == kTypeSoa && reply.soaMinimum() == CaptiveDns::kTtl);
+  }
+
+  CHECK(ask(dns, client, query("example.com", kTypeA, kClassChaos), reply));
+  CHECK(reply.rcode == 5 && reply.answers == 0 && reply.authorities == 0); // REFUSED
+}
+
+void testOverrides(CaptiveDns &dns, Client &client) {
+  CHECK(dns.addOverride("Connectivity.Test.", IPAddress(10, 0, 0, 7)));
+  CHECK(dns.addOverride("blocked.test", IPAddress(0, 0, 0, 0)));
+
+  Reply reply;
+  CHECK(ask(dns, client, query("connectivity.TEST", kTypeA), reply));
+  CHECK(reply.answers == 1 && reply.address() == "10.0.0.7");
+  CHECK(ask(dns, client, query("connectivity.test", kTypeAaaa), reply));
+  CHECK(reply.rcode == 0 && reply.answers == 0 && reply.authorities == 1);
+
+  // 0.0.0.0 is NXDOMAIN, for every type
+  for (uint16_t type : {kTypeA, kTypeAaaa}) {
+    CHECK(ask(dns, client, query("blocked.test", type), reply));
+    CHECK(reply.rcode == 3 && reply.answers == 0 && reply.authorities == 1);
+    CHECK(reply.recordType() == kTypeSoa);
+  }
+
+  // Names below an override are not covered by it
+  CHECK(ask(dns, client, query("www.blocked.test", kTypeA), reply));
+  CHECK(reply.rcode == 0 && reply.address() == "192.168.4.1");
+
+  CaptiveDns table;
+  CHECK(!table.addOverride("", IPAddress(1, 2, 3, 4)));
+  CHECK(!table.addOverride(".", IPAddress(1, 2, 3, 4)));
+  CHECK(!table.addOverride(nullptr, IPAddress(1, 2, 3, 4)));
+  CHECK(!table.addOverride(std::string(64, 'x').c_str(), IPAddress(1, 2, 3, 4)));
+  CHECK(table.addOverride(std::string(63, 'x').c_str(), IPAddress(1, 2, 3, 4)));
+  for (int i = 1; i < WIFI_PROVISIONER_DNS_OVERRIDES; ++i) {
+    CHECK(table.addOverride("full.test", IPAddress(1, 2, 3, 4)));
+  }
+  CHECK(!table.addOverride("one-too-many.test", IPAddress(1, 2, 3, 4)));
+}
+
+void testMalformed(CaptiveDns &dns, Client &client) {
+  Reply reply;
+  // Too short for a header, or an answer rather than a query: dropped
+  CHECK(!ask(dns, client, Packet(11, 0), reply));
+  Packet answer = query("example.com", kTypeA);
+  answer[2] |= 0x80;
+  CHECK(!ask(dns, client, answer, reply));
+
+  // Two questions
+  Packet two = query("example.com", kTypeA);
+  two[5] = 2;
+  CHECK(ask(dns, client, two, reply));
+  CHECK(reply.rcode == 1 && reply.questions == 0 && reply.answers == 0); // FORMERR
+
+  // Question cut short, and a compression pointer in it
+  Packet cut = query("example.com", kTypeA);
+  cut.resize(cut.size() - 3);
+  CHECK(ask(dns, client, cut, reply));
+  CHECK(reply.rcode == 1 && reply.packet.size() == 12);
+  Packet pointer = query("example.com", kTypeA);
+  pointer[12] = 0xC0;
+  CHECK(ask(dns, client, pointer, reply));
+  CHECK(reply.rcode == 1);
+
+  // Name over 255 bytes
+  std::string longName;
+  for (int i = 0; i < 5; ++i) {
+    longName += std::string(60, 'a') + ".";
+  }
+  longName += "com";
+  CHECK(ask(dns, client, query(longName.c_str(), kTypeA), reply));
+  CHECK(reply.rcode == 1);
+
+  // Opcodes other than QUERY
+  Packet status = query("example.com", kTypeA);
+  status[2] |= 2 << 3;
+  CHECK(ask(dns, client, status, reply));
+  CHECK(reply.rcode == 4 && ((reply.flags >> 11) & 0x0F) == 2); // NOTIMP
+}
+
+void testDraining(CaptiveDns &dns, Client &client) {
+  uint32_t before = dns.queries();
+  for (int i = 0; i < 3; ++i) {
+    client.send(query("example.com", kTypeA, kClassIn, (uint16_t)i));
+  }
+  CHECK(dns.processPending() == 3);
+  CHECK(dns.queries() - before == 3);
+  Reply reply;
+  for (int i = 0; i < 3; ++i) {
+    CHECK(client.receive(reply) && reply.id == i);
+  }
+
+  // One call is bounded, so a flood cannot starve HTTP
+  for (int i = 0; i < 40; ++i) {
+    client.send(query("example.com", kTypeA));
+  }
+  size_t first = dns.processPending();
+  size_t second = dns.processPending();
+  CHECK(first < 40 && first + second == 40);
+  for (int i = 0; i < 40; ++i) {
+    CHECK(client.receive(reply));
+  }
+  CHECK(dns.processPending() == 0);
+}
+
+} // namespace
+
+int main() {
+  CaptiveDns dns;
+  if (!dns.begin(kPort, IPAddress(192, 168, 4, 1))) {
+    fprintf(stderr, "Could not listen on port %u\n", kPort);
+    return 1;
+  }
+  Client client;
+  testAnswers(dns, client);
+  testOverrides(dns, client);
+  testMalformed(dns, client);
+  testDraining(dns, client);
+
+  dns.end();
+  CHECK(!dns.running() && dns.processPending() == 0);
+  if (failures) {
+    fprintf(stderr, "%d check(s) failed\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,267 @@
+// Checks CredentialStore against the in-memory Preferences: round trips,
+// most recent first ordering, eviction of the oldest network, failure
+// counts, skipped unchanged writes, the version 1 migration and blobs of
+// other layouts.
+#include "internal/credential_store.h"
+#include <Preferences.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <time.h>
+#include <vector>
+
+using namespace wifiprov;
+
+namespace {
+
+const uint8_t kBssid[6] = {0x02, 0x11, 0x22, 0x33, 0x44, 0x55};
+
+int failures = 0;
+
+#define CHECK(condition)                                                                           \
+  do {                                                                                             \
+    if (!(condition)) {                                                                            \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                \
+      ++failures;                                                                                  \
+    }                                                                                              \
+  } while (0)
+
+void reset() {
+  Preferences::store().clear();
+  Preferences::writes() = 0;
+}
+
+// The raw blob, or an empty one if nothing is stored
+std::vector<uint8_t> storedBlob() {
+  Preferences::Namespace &keys = Preferences::store()["wifiprov"];
+  auto found = keys.find("network");
+  return found == keys.end() ? std::vector<uint8_t>() : found->second;
+}
+
+void putBlob(const std::vector<uint8_t> &blob) {
+  Preferences prefs;
+  prefs.begin("wifiprov", false);
+  prefs.putBytes("network", blob.data(), blob.size());
+  prefs.end();
+}
+
+std::string networkName(int i) { return "net" + std::to_string(i); }
+
+void testEmpty() {
+  reset();
+  CredentialStore store;
+  StoredNetwork networks[CredentialStore::kCapacity];
+  StoredNetwork network;
+  CHECK(store.load(networks) == 0);
+  CHECK(!store.find("Home", network));
+  store.noteFailure("Home");
+  store.clear();
+  CHECK(Preferences::writes() == 0);
+}
+
+void testRoundTrip() {
+  reset();
+  CredentialStore store;
+  time_t before = time(nullptr);
+  CHECK(store.save("Home", "secret12", kBssid, 6));
+  CHECK(store.save("Cafe", nullptr, nullptr, 0));
+
+  StoredNetwork networks[CredentialStore::kCapacity];
+  CHECK(store.load(networks) == 2);
+  CHECK(strcmp(networks[0].ssid, "Cafe") == 0 && networks[0].password[0] == '\0');
+  CHECK(networks[0].channel == 0 && networks[0].bssid[0] == 0);
+  CHECK(strcmp(networks[1].ssid, "Home") == 0 && strcmp(networks[1].password, "secret12") == 0);
+  CHECK(memcmp(networks[1].bssid, kBssid, 6) == 0 && networks[1].channel == 6);
+  CHECK(networks[1].failures == 0 && networks[1].lastSuccess >= (uint32_t)before);
+
+  StoredNetwork network;
+  CHECK(store.find("Home", network) && network.channel == 6);
+  CHECK(!store.find("home", network) && network.ssid[0] == '\0');
+
+  // Joining again moves the network to the front without a second entry
+  CHECK(store.save("Home", "secret12", kBssid, 11));
+  CHECK(store.load(networks) == 2);
+  CHECK(strcmp(networks[0].ssid, "Home") == 0 && networks[0].channel == 11);
+  CHECK(strcmp(networks[1].ssid, "Cafe") == 0);
+
+  // The longest fields fit, one more byte does not
+  std::string ssid(32, 's');
+  std::string password(64, 'p');
+  CHECK(store.save(ssid.c_str(), password.c_str(), kBssid, 1));
+  CHECK(store.find(ssid.c_str(), network) && network.password == password);
+  CHECK(!store.save((ssid + "s").c_str(), "secret12", kBssid, 1));
+  CHECK(!store.save("Home", (password + "p").c_str(), kBssid, 1));
+  CHECK(!store.save("", "secret12", kBssid, 1));
+
+  store.clear();
+  CHECK(store.load(networks) == 0);
+}
+
+void testEviction() {
+  reset();
+  CredentialStore store;
+  for (size_t i = 0; i <= CredentialStore::kCapacity; ++i) {
+    CHECK(store.save(networkName(i).c_str(), "password", kBssid, 1));
+  }
+  StoredNetwork networks[CredentialStore::kCapacity];
+  CHECK(store.load(networks) == CredentialStore::kCapacity);
+  for (size_t i = 0; i < CredentialStore::kCapacity; ++i) {
+    CHECK(networkName(CredentialStore::kCapacity - i) == networks[i].ssid);
+  }
+  StoredNetwork network;
+  CHECK(!store.find("net0", network));
+
+  // A network joined again is not evicted for itself
+  CHECK(store.save("net1", "password", kBssid, 1));
+  CHECK(store.load(networks) == CredentialStore::kCapacity);
+  CHECK(strcmp(networks[0].ssid, "net1") == 0);
+  CHECK(strcmp(networks[CredentialStore::kCapacity - 1].ssid, "net2") == 0);
+}
+
+void testFailures() {
+  reset();
+  CredentialStore store;
+  CHECK(store.save("Home", "secret12", kBssid, 6));
+  CHECK(store.save("Cafe", "latte123", kBssid, 1));
+  store.noteFailure("Home");
+  store.noteFailure("Home");
+  store.noteFailure("Nowhere");
+
+  StoredNetwork network;
+  CHECK(store.find("Home", network) && network.failures == 2);
+  CHECK(store.find("Cafe", network) && network.failures == 0);
+
+  // A failure does not reorder the list; a success clears the count
+  StoredNetwork networks[CredentialStore::kCapacity];
+  CHECK(store.load(networks) == 2 && strcmp(networks[0].ssid, "Cafe") == 0);
+  CHECK(store.save("Home", "secret12", kBssid, 6));
+  CHECK(store.find("Home", network) && network.failures == 0);
+
+  for (int i = 0; i < 300; ++i) {
+    store.noteFailure("Home");
+  }
+  CHECK(store.find("Home", network) && network.failures == UINT8_MAX);
+}
+
+void testUnchangedWrites() {
+  reset();
+  CredentialStore store;
+  // The same join within one second of the clock rewrites nothing
+  for (int attempt = 0; attempt < 3; ++attempt) {
+    time_t second = time(nullptr);
+    CHECK(store.save("Home", "secret12", kBssid, 6));
+    size_t writes = Preferences::writes();
+    CHECK(store.save("Home", "secret12", kBssid, 6));
+    if (time(nullptr) == second) {
+      CHECK(Preferences::writes() == writes);
+      return;
+    }
+  }
+  fprintf(stderr, "the clock ticked during every attempt\n");
+  ++failures;
+}
+
+// A version 1 record as the previous release wrote it
+std::vector<uint8_t> recordV1(const char *ssid, const char *password, uint8_t channel,
+                              uint8_t failures, uint32_t lastSuccess) {
+  struct {
+    uint8_t version;
+    StoredNetwork network;
+  } record;
+  memset(&record, 0, sizeof(record));
+  record.version = 1;
+  strcpy(record.network.ssid, ssid);
+  strcpy(record.network.password, password);
+  memcpy(record.network.bssid, kBssid, 6);
+  record.network.channel = channel;
+  record.network.failures = failures;
+  record.network.lastSuccess = lastSuccess;
+  const uint8_t *bytes = (const uint8_t *)&record;
+  return std::vector<uint8_t>(bytes, bytes + sizeof(record));
+}
+
+void testMigration() {
+  reset();
+  putBlob(recordV1("Home", "secret12", 6, 1, 1700000000));
+  CredentialStore store;
+  StoredNetwork networks[CredentialStore::kCapacity];
+  CHECK(store.load(networks) == 1);
+  CHECK(strcmp(networks[0].ssid, "Home") == 0 && strcmp(networks[0].password, "secret12") == 0);
+  CHECK(memcmp(networks[0].bssid, kBssid, 6) == 0 && networks[0].channel == 6);
+  CHECK(networks[0].failures == 1 && networks[0].lastSuccess == 1700000000);
+  StoredNetwork network;
+  CHECK(store.find("Home", network) && network.channel == 6);
+  CHECK(storedBlob()[0] == 1); // Reads leave it alone
+
+  // The next change writes the current layout, keeping the network
+  CHECK(store.save("Cafe", "latte123", kBssid, 1));
+  CHECK(storedBlob()[0] == 2);
+  CHECK(store.load(networks) == 2);
+  CHECK(strcmp(networks[1].ssid, "Home") == 0 && networks[1].failures == 1);
+
+  // So does a failure count
+  reset();
+  putBlob(recordV1("Home", "secret12", 6, 0, 0));
+  store.noteFailure("Home");
+  CHECK(storedBlob()[0] == 2);
+  CHECK(store.find("Home", network) && network.failures == 1);
+
+  // A version 1 record with an unterminated SSID is not misread
+  reset();
+  std::vector<uint8_t> broken = recordV1("Home", "secret12", 6, 0, 0);
+  memset(broken.data() + offsetof(StoredNetwork, ssid) + 4, 'x', 33);
+  putBlob(broken);
+  CHECK(store.load(networks) == 0);
+}
+
+void testForeignBlobs() {
+  CredentialStore store;
+  StoredNetwork networks[CredentialStore::kCapacity];
+  StoredNetwork network;
+  const std::vector<uint8_t> foreign[] = {
+      {3, 1, 4, 'H', 'o', 'm', 'e', 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0}, // A later version
+      {2, CredentialStore::kCapacity + 1},                                 // Too many networks
+      {2},                                                                 // No count
+      {1, 0, 0, 0},                                                        // Version 1, wrong size
+  };
+  for (const auto &blob : foreign) {
+    reset();
+    putBlob(blob);
+    CHECK(store.load(networks) == 0);
+    CHECK(!store.find("Home", network));
+    // Saving replaces it
+    CHECK(store.save("Cafe", "latte123", kBssid, 1));
+    CHECK(store.load(networks) == 1 && strcmp(networks[0].ssid, "Cafe") == 0);
+  }
+
+  // A cut-off blob yields the networks before the cut
+  reset();
+  CHECK(store.save("Home", "secret12", kBssid, 6));
+  CHECK(store.save("Cafe", "latte123", kBssid, 1));
+  std::vector<uint8_t> blob = storedBlob();
+  blob.resize(blob.size() - 3);
+  putBlob(blob);
+  CHECK(store.load(networks) == 1 && strcmp(networks[0].ssid, "Cafe") == 0);
+
+  // So does a zero-length SSID
+  reset();
+  putBlob({2, 2, 4, 'C', 'a', 'f', 'e', 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0});
+  CHECK(store.load(networks) == 1 && networks[0].channel == 1);
+}
+
+} // namespace
+
+int main() {
+  testEmpty();
+  testRoundTrip();
+  testEviction();
+  testFailures();
+  testUnchangedWrites();
+  testMigration();
+  testForeignBlobs();
+  if (failures) {
+    fprintf(stderr, "%d check(s) failed\n", failures);
+    return 1;
+  }
+  return 0;
+}
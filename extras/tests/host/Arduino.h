@@ -0,0 +1,20 @@
+// Host stand-in for the parts of the Arduino core that the sources under
+// test use. Not a general Arduino emulation.
+#ifndef WIFIPROVISIONER_HOST_ARDUINO_H
+#define WIFIPROVISIONER_HOST_ARDUINO_H
+
+#include "Print.h"
+#include "WString.h"
+#include <ctype.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROGMEM
+
+unsigned long millis();
+void delay(unsigned long ms);
+void yield();
+
+#endif // WIFIPROVISIONER_HOST_ARDUINO_H
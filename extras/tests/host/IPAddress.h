@@ -0,0 +1,17 @@
+// Host stand-in: an IPv4 address as four bytes.
+#ifndef WIFIPROVISIONER_HOST_IPADDRESS_H
+#define WIFIPROVISIONER_HOST_IPADDRESS_H
+
+#include <stdint.h>
+
+class IPAddress {
+public:
+  IPAddress() : _bytes{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _bytes{a, b, c, d} {}
+  uint8_t operator[](int index) const { return _bytes[index]; }
+
+private:
+  uint8_t _bytes[4];
+};
+
+#endif // WIFIPROVISIONER_HOST_IPADDRESS_H
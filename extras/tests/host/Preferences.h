@@ -0,0 +1,83 @@
+// Host stand-in for the ESP32 Preferences library, keeping namespaces in
+// memory for the life of the process. A read-only begin() fails on a
+// namespace that was never written, as it does on NVS.
+#ifndef WIFIPROVISIONER_HOST_PREFERENCES_H
+#define WIFIPROVISIONER_HOST_PREFERENCES_H
+
+#include <map>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <string.h>
+#include <vector>
+
+class Preferences {
+public:
+  using Namespace = std::map<std::string, std::vector<uint8_t>>;
+
+  bool begin(const char *name, bool readOnly = false, const char *partition = nullptr) {
+    auto found = store().find(name);
+    if (found == store().end()) {
+      if (readOnly) {
+        return false;
+      }
+      found = store().emplace(name, Namespace()).first;
+    }
+    _namespace = &found->second;
+    _readOnly = readOnly;
+    return true;
+  }
+  void end() { _namespace = nullptr; }
+
+  size_t putBytes(const char *key, const void *value, size_t len) {
+    if (!_namespace || _readOnly) {
+      return 0;
+    }
+    (*_namespace)[key].assign((const uint8_t *)value, (const uint8_t *)value + len);
+    ++writes();
+    return len;
+  }
+  size_t getBytesLength(const char *key) {
+    const std::vector<uint8_t> *value = find(key);
+    return value ? value->size() : 0;
+  }
+  size_t getBytes(const char *key, void *buf, size_t maxLen) {
+    const std::vector<uint8_t> *value = find(key);
+    if (!value || value->size() > maxLen) {
+      return 0;
+    }
+    memcpy(buf, value->data(), value->size());
+    return value->size();
+  }
+  bool remove(const char *key) {
+    if (!_namespace || _readOnly || !_namespace->erase(key)) {
+      return false;
+    }
+    ++writes();
+    return true;
+  }
+
+  // Host only: every namespace, and how many writes reached them
+  static std::map<std::string, Namespace> &store() {
+    static std::map<std::string, Namespace> namespaces;
+    return namespaces;
+  }
+  static size_t &writes() {
+    static size_t count = 0;
+    return count;
+  }
+
+private:
+  const std::vector<uint8_t> *find(const char *key) const {
+    if (!_namespace) {
+      return nullptr;
+    }
+    auto found = _namespace->find(key);
+    return found == _namespace->end() ? nullptr : &found->second;
+  }
+
+  Namespace *_namespace = nullptr;
+  bool _readOnly = false;
+};
+
+#endif // WIFIPROVISIONER_HOST_PREFERENCES_H
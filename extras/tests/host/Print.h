@@ -0,0 +1,38 @@
+// Host stand-in for the Arduino Print class.
+#ifndef WIFIPROVISIONER_HOST_PRINT_H
+#define WIFIPROVISIONER_HOST_PRINT_H
+
+#include "WString.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t byte) = 0;
+  virtual size_t write(const uint8_t *data, size_t len) {
+    size_t n = 0;
+    while (len--) {
+      n += write(*data++);
+    }
+    return n;
+  }
+  size_t write(const char *text) { return write((const uint8_t *)text, strlen(text)); }
+  size_t write(const char *data, size_t len) { return write((const uint8_t *)data, len); }
+  virtual void flush() {}
+
+  size_t print(const char *text) { return write(text); }
+  size_t print(const String &text) { return write(text.c_str()); }
+  size_t print(long number);
+  size_t print(unsigned long number);
+  size_t print(int number) { return print((long)number); }
+  size_t print(unsigned int number) { return print((unsigned long)number); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T &value) { return print(value) + println(); }
+
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+#endif // WIFIPROVISIONER_HOST_PRINT_H
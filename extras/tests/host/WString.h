@@ -0,0 +1,40 @@
+// Host stand-in for the Arduino String class, backed by std::string.
+#ifndef WIFIPROVISIONER_HOST_WSTRING_H
+#define WIFIPROVISIONER_HOST_WSTRING_H
+
+#include <string>
+
+class String {
+public:
+  String() {}
+  String(const char *text) : _s(text ? text : "") {}
+  explicit String(int number) : _s(std::to_string(number)) {}
+
+  const char *c_str() const { return _s.c_str(); }
+  unsigned int length() const { return _s.size(); }
+  bool isEmpty() const { return _s.empty(); }
+  bool reserve(unsigned int size) {
+    _s.reserve(size);
+    return true;
+  }
+  bool concat(const char *data, unsigned int len) {
+    _s.append(data, len);
+    return true;
+  }
+  String &operator+=(char c) {
+    _s += c;
+    return *this;
+  }
+  String &operator+=(const char *text) {
+    _s += text;
+    return *this;
+  }
+  bool operator==(const String &other) const { return _s == other._s; }
+  bool operator!=(const String &other) const { return _s != other._s; }
+  bool operator==(const char *other) const { return _s == other; }
+
+private:
+  std::string _s;
+};
+
+#endif // WIFIPROVISIONER_HOST_WSTRING_H
@@ -0,0 +1,41 @@
+// Host implementations behind Arduino.h and Print.h.
+#include "Arduino.h"
+#include <chrono>
+#include <stdarg.h>
+#include <stdio.h>
+#include <thread>
+
+namespace {
+const auto kStart = std::chrono::steady_clock::now();
+}
+
+unsigned long millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - kStart)
+      .count();
+}
+
+void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+void yield() { std::this_thread::yield(); }
+
+size_t Print::print(long number) {
+  char buf[24];
+  return write(buf, snprintf(buf, sizeof(buf), "%ld", number));
+}
+
+size_t Print::print(unsigned long number) {
+  char buf[24];
+  return write(buf, snprintf(buf, sizeof(buf), "%lu", number));
+}
+
+size_t Print::printf(const char *format, ...) {
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (len < 0) {
+    return 0;
+  }
+  return write(buf, (size_t)len < sizeof(buf) ? (size_t)len : sizeof(buf) - 1);
+}
@@ -0,0 +1 @@
+// Host stand-in: lwIP options are not needed on top of POSIX sockets.
@@ -0,0 +1,13 @@
+// Host stand-in: the lwIP socket API is the POSIX one.
+#ifndef WIFIPROVISIONER_HOST_LWIP_SOCKETS_H
+#define WIFIPROVISIONER_HOST_LWIP_SOCKETS_H
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#endif // WIFIPROVISIONER_HOST_LWIP_SOCKETS_H
@@ -0,0 +1,154 @@
+// Checks JsonWriter output and times it on /update-shaped responses with
+// 10, 50 and 200 networks, written twice (length, then body) as the portal
+// does. Built with ArduinoJson on the include path, the same document is
+// also built and serialized with ArduinoJson for comparison.
+#include "internal/json_writer.h"
+#include <assert.h>
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if __has_include(<ArduinoJson.h>)
+#include <ArduinoJson.h>
+#define HAVE_ARDUINOJSON 1
+#endif
+
+using namespace wifiprov;
+
+// Heap allocations made by the code under test
+static size_t allocations = 0;
+
+void *operator new(size_t size) {
+  ++allocations;
+  void *p = malloc(size ? size : 1);
+  if (!p) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+namespace {
+
+struct Network {
+  char ssid[33];
+  int level;
+  bool secured;
+};
+
+
+template <typename Fn> double nanosPerRun(size_t runs, Fn &&fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < runs; ++i) {
+    fn();
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / runs;
+}
+
+void writeUpdate(JsonWriter &json, const Network *networks, size_t count) {
+  json.beginObject().member("show_code", true).member("show_login", false).key("network").beginArray();
+  for (size_t i = 0; i < count; ++i) {
+    json.beginObject()
+        .member("rssi", networks[i].level)
+        .member("ssid", networks[i].ssid)
+        .member("authmode", networks[i].secured ? 1 : 0)
+        .endObject();
+  }
+  json.endArray().member("age", 3).member("scanning", false).endObject();
+}
+
+void checkOutput() {
+  Network networks[2] = {{"Home \"5G\"", 4, true}, {"<lab>\\\n", 1, false}};
+  uint8_t buffer[256];
+  BufferPrint out(buffer, sizeof(buffer));
+  JsonWriter json(out);
+  writeUpdate(json, networks, 2);
+  const char *expected = "{\"show_code\":true,\"show_login\":false,\"network\":["
+                         "{\"rssi\":4,\"ssid\":\"Home \\\"5G\\\"\",\"authmode\":1},"
+                         "{\"rssi\":1,\"ssid\":\"\\u003clab>\\\\\\n\",\"authmode\":0}"
+                         "],\"age\":3,\"scanning\":false}";
+  assert(out.length() == strlen(expected) && memcmp(buffer, expected, out.length()) == 0);
+
+  uint8_t small[4];
+  BufferPrint clipped(small, sizeof(small));
+  assert(clipped.write((const uint8_t *)"abcdef", 6) == 4 && clipped.length() == 4);
+}
+
+#ifdef HAVE_ARDUINOJSON
+struct CountingAllocator : ArduinoJson::Allocator {
+  void *allocate(size_t size) override {
+    ++allocations;
+    return malloc(size);
+  }
+  void deallocate(void *pointer) override { free(pointer); }
+  void *reallocate(void *pointer, size_t size) override {
+    ++allocations;
+    return realloc(pointer, size);
+  }
+};
+#endif
+
+} // namespace
+
+int main() {
+  checkOutput();
+
+  static Network networks[200];
+  for (size_t i = 0; i < 200; ++i) {
+    snprintf(networks[i].ssid, sizeof(networks[i].ssid), "Network-%03u-%s", (unsigned)i,
+             i % 3 ? "guest" : "office");
+    networks[i].level = 4 - (int)(i % 5);
+    networks[i].secured = i % 4 != 0;
+  }
+
+  static uint8_t buffer[32 * 1024];
+  const size_t counts[] = {10, 50, 200};
+  printf("%-9s %8s %14s %14s\n", "networks", "bytes", "JsonWriter ns", "ArduinoJson ns");
+  for (size_t count : counts) {
+    size_t length = 0;
+    allocations = 0;
+    double writer = nanosPerRun(2000, [&]() {
+      ByteCounter counter;
+      JsonWriter measure(counter);
+      writeUpdate(measure, networks, count);
+      BufferPrint out(buffer, sizeof(buffer));
+      JsonWriter json(out);
+      writeUpdate(json, networks, count);
+      length = out.length();
+      assert(length == counter.count());
+    });
+    assert(allocations == 0);
+
+    double document = 0;
+#ifdef HAVE_ARDUINOJSON
+    CountingAllocator allocator;
+    allocations = 0;
+    document = nanosPerRun(2000, [&]() {
+      JsonDocument doc(&allocator);
+      doc["show_code"] = true;
+      doc["show_login"] = false;
+      JsonArray array = doc["network"].to<JsonArray>();
+      for (size_t i = 0; i < count; ++i) {
+        JsonObject entry = array.add<JsonObject>();
+        entry["rssi"] = networks[i].level;
+        entry["ssid"] = (const char *)networks[i].ssid;
+        entry["authmode"] = networks[i].secured ? 1 : 0;
+      }
+      doc["age"] = 3;
+      doc["scanning"] = false;
+      size_t measured = measureJson(doc);
+      assert(serializeJson(doc, (char *)buffer, sizeof(buffer)) == measured);
+    });
+    printf("%-9u %8u %14.0f %14.0f  (%.1f allocations per ArduinoJson run)\n", (unsigned)count,
+           (unsigned)length, writer, document, allocations / 2000.0);
+#else
+    (void)document;
+    printf("%-9u %8u %14.0f %14s\n", (unsigned)count, (unsigned)length, writer, "-");
+#endif
+  }
+  return 0;
+}
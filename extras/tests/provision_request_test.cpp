@@ -0,0 +1,213 @@
+// Checks ProvisionRequestParser on /configure bodies: every split of the
+// input, escapes and surrogate pairs, field limits, skipped members and
+// malformed JSON.
+#include "internal/provision_request.h"
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+using namespace wifiprov;
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(condition)                                                                           \
+  do {                                                                                             \
+    if (!(condition)) {                                                                            \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                \
+      ++failures;                                                                                  \
+    }                                                                                              \
+  } while (0)
+
+// Parses `body` fed `chunk` bytes at a time; `error` gets the parser's
+// reason on failure
+bool parse(const std::string &body, ProvisionRequest &out, size_t chunk, size_t codeLimit = 0,
+           std::string *error = nullptr) {
+  ProvisionRequestParser parser(out, codeLimit);
+  bool ok = true;
+  for (size_t at = 0; at < body.size() && ok; at += chunk) {
+    ok = parser.feed(body.data() + at, std::min(chunk, body.size() - at));
+  }
+  ok = ok && parser.finish();
+  if (error) {
+    *error = parser.error() ? parser.error() : "";
+  }
+  return ok;
+}
+
+// Parses `body` whole and in every split, and checks they all agree
+bool parseAllSplits(const std::string &body, ProvisionRequest &out, size_t codeLimit = 0,
+                    std::string *error = nullptr) {
+  bool ok = parse(body, out, body.size() ? body.size() : 1, codeLimit, error);
+  for (size_t chunk = 1; chunk < body.size(); ++chunk) {
+    ProvisionRequest split;
+    std::string splitError;
+    bool splitOk = parse(body, split, chunk, codeLimit, &splitError);
+    if (splitOk != ok || (ok && memcmp(&split, &out, sizeof(out)) != 0) ||
+        (error && splitError != *error)) {
+      fprintf(stderr, "split of %u bytes differs on %s\n", (unsigned)chunk, body.c_str());
+      ++failures;
+      break;
+    }
+  }
+  return ok;
+}
+
+void testFields() {
+  ProvisionRequest request;
+  CHECK(parseAllSplits(" {\"ssid\": \"Home\", \"password\":\"secret12\", \"code\":\"1234\","
+                       " \"username\":\"me\", \"service_password\":\"pw\"} ",
+                       request));
+  CHECK(strcmp(request.ssid, "Home") == 0);
+  CHECK(strcmp(request.password, "secret12") == 0);
+  CHECK(strcmp(request.code, "1234") == 0);
+  CHECK(strcmp(request.username, "me") == 0);
+  CHECK(strcmp(request.servicePassword, "pw") == 0);
+  CHECK(request.present == (ProvisionRequest::kPassword | ProvisionRequest::kCode |
+                            ProvisionRequest::kUsername | ProvisionRequest::kServicePassword));
+
+  // Known members that are not strings count as absent
+  CHECK(parseAllSplits("{\"ssid\":\"Open\",\"password\":null,\"code\":1234,\"username\":true}",
+                       request));
+  CHECK(strcmp(request.ssid, "Open") == 0);
+  CHECK(request.present == 0);
+  CHECK(request.optional(request.password, ProvisionRequest::kPassword) == nullptr);
+
+  // An empty string is present
+  CHECK(parseAllSplits("{\"ssid\":\"Open\",\"password\":\"\"}", request));
+  CHECK(request.optional(request.password, ProvisionRequest::kPassword) != nullptr);
+
+  // A new parse starts from an empty request
+  CHECK(parseAllSplits("{}", request));
+  CHECK(request.ssid[0] == '\0' && request.password[0] == '\0' && request.present == 0);
+}
+
+void testEscapes() {
+  ProvisionRequest request;
+  CHECK(parseAllSplits("{\"ssid\":\"a\\\"b\\\\c\\/d\\n\\t\\b\\f\\r\"}", request));
+  CHECK(strcmp(request.ssid, "a\"b\\c/d\n\t\b\f\r") == 0);
+
+  // \u escapes are written as UTF-8, surrogate pairs as one code point
+  CHECK(parseAllSplits("{\"ssid\":\"\\u0041\\u00e9\\u20AC\\ud83d\\ude00\"}", request));
+  CHECK(strcmp(request.ssid, "A\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80") == 0);
+  // Raw UTF-8 passes through
+  CHECK(parseAllSplits("{\"ssid\":\"Caf\xC3\xA9\"}", request));
+  CHECK(strcmp(request.ssid, "Caf\xC3\xA9") == 0);
+
+  std::string error;
+  CHECK(!parseAllSplits("{\"ssid\":\"\\ud83dx\"}", request, 0, &error));
+  CHECK(error == "unpaired surrogate");
+  CHECK(!parseAllSplits("{\"ssid\":\"\\ude00\"}", request, 0, &error));
+  CHECK(error == "unpaired surrogate");
+  CHECK(!parseAllSplits("{\"ssid\":\"\\ud83d\\u0041\"}", request, 0, &error));
+  CHECK(error == "unpaired surrogate");
+  CHECK(!parseAllSplits("{\"ssid\":\"\\ud83d\\n\"}", request, 0, &error));
+  CHECK(error == "unpaired surrogate");
+  CHECK(!parseAllSplits("{\"ssid\":\"\\u0000\"}", request, 0, &error));
+  CHECK(error == "NUL in string");
+  CHECK(!parseAllSplits("{\"ssid\":\"\\x41\"}", request, 0, &error));
+  CHECK(error == "bad escape");
+  CHECK(!parseAllSplits("{\"ssid\":\"\\u00g0\"}", request, 0, &error));
+  CHECK(error == "bad \\u escape");
+}
+
+void testLimits() {
+  ProvisionRequest request;
+  std::string error;
+  std::string ssid32(32, 's');
+  CHECK(parseAllSplits("{\"ssid\":\"" + ssid32 + "\"}", request));
+  CHECK(strlen(request.ssid) == 32);
+  CHECK(!parseAllSplits("{\"ssid\":\"" + ssid32 + "s\"}", request, 0, &error));
+  CHECK(error == "ssid too long");
+
+  std::string password64(64, 'p');
+  CHECK(parseAllSplits("{\"ssid\":\"A\",\"password\":\"" + password64 + "\"}", request));
+  CHECK(strlen(request.password) == 64);
+  CHECK(!parseAllSplits("{\"ssid\":\"A\",\"password\":\"" + password64 + "p\"}", request, 0,
+                        &error));
+  CHECK(error == "password too long");
+
+  // A multi-byte character that does not fit whole is refused too
+  CHECK(!parseAllSplits("{\"ssid\":\"" + std::string(31, 's') + "\\u00e9\"}", request, 0,
+                        &error));
+  CHECK(error == "ssid too long");
+
+  // The caller's code limit, and the compiled-in one above it
+  CHECK(parseAllSplits("{\"ssid\":\"A\",\"code\":\"1234\"}", request, 4));
+  CHECK(!parseAllSplits("{\"ssid\":\"A\",\"code\":\"12345\"}", request, 4, &error));
+  CHECK(error == "code too long");
+  std::string longestCode(ProvisionRequest::kCodeMax, '9');
+  CHECK(parseAllSplits("{\"ssid\":\"A\",\"code\":\"" + longestCode + "\"}", request, 1000));
+  CHECK(!parseAllSplits("{\"ssid\":\"A\",\"code\":\"" + longestCode + "9\"}", request, 1000));
+}
+
+void testSkipped() {
+  ProvisionRequest request;
+  // Unknown members, nested ones with brackets and quotes inside strings
+  CHECK(parseAllSplits("{\"x\":{\"a\":[1,{\"b\":\"}]\\\"\"}],\"c\":-1.5e+3},\"ssid\":\"A\","
+                       "\"list\":[\"ssid\",[]],\"n\":false}",
+                       request));
+  CHECK(strcmp(request.ssid, "A") == 0);
+
+  // A name longer than any field's that starts like one matches none
+  CHECK(parseAllSplits("{\"ssid_with_a_much_longer_name_than_any\":\"B\",\"ssid\":\"A\"}",
+                       request));
+  CHECK(strcmp(request.ssid, "A") == 0);
+
+  // An unknown member may be longer than any field
+  CHECK(parseAllSplits("{\"note\":\"" + std::string(500, 'n') + "\",\"ssid\":\"A\"}", request));
+
+  std::string error;
+  CHECK(!parseAllSplits("{\"x\":" + std::string(17, '[') + std::string(17, ']') + "}", request,
+                        0, &error));
+  CHECK(error == "nested too deeply");
+  CHECK(parseAllSplits("{\"x\":" + std::string(16, '[') + std::string(16, ']') + "}", request));
+}
+
+void testMalformed() {
+  ProvisionRequest request;
+  std::string error;
+  const struct {
+    const char *body;
+    const char *error;
+  } cases[] = {
+      {"", "incomplete JSON"},
+      {"   ", "incomplete JSON"},
+      {"[\"ssid\"]", "expected an object"},
+      {"{\"ssid\":\"A\"", "incomplete JSON"},
+      {"{\"ssid\":\"A", "incomplete JSON"},
+      {"{\"ssid\" \"A\"}", "expected ':'"},
+      {"{ssid:\"A\"}", "expected a member name"},
+      {"{\"ssid\":}", "expected a value"},
+      {"{\"ssid\":\"A\" \"password\":\"B\"}", "expected ',' or '}'"},
+      {"{\"ssid\":\"A\",}", "expected a member name"},
+      {"{\"ssid\":\"A\"} x", "data after the object"},
+      {"{\"ssid\":\"A\"}{}", "data after the object"},
+      {"{\"ssid\":\"A\nB\"}", "control character in string"},
+  };
+  for (const auto &c : cases) {
+    bool ok = parseAllSplits(c.body, request, 0, &error);
+    CHECK(!ok);
+    if (error != c.error) {
+      fprintf(stderr, "'%s': got '%s', expected '%s'\n", c.body, error.c_str(), c.error);
+      ++failures;
+    }
+  }
+}
+
+} // namespace
+
+int main() {
+  testFields();
+  testEscapes();
+  testLimits();
+  testSkipped();
+  testMalformed();
+  if (failures) {
+    fprintf(stderr, "%d check(s) failed\n", failures);
+    return 1;
+  }
+  return 0;
+}
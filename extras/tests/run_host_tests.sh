@@ -0,0 +1,46 @@
+#!/bin/sh
+# Builds and runs the host tests and benchmarks in this directory with the
+# system C++ compiler. The sources under test come from src/; Arduino and
+# lwIP are replaced by the small stand-ins in host/.
+#
+# Usage:
+#   extras/tests/run_host_tests.sh
+#   ARDUINOJSON_DIR=path/to/ArduinoJson/src extras/tests/run_host_tests.sh
+#   WPA_PMK_LONG=1 extras/tests/run_host_tests.sh
+#
+# The second form adds ArduinoJson to the JsonWriter benchmark; the third
+# adds the slow 16777216-iteration PBKDF2 vector.
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+SRC="$HERE/../../src"
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+CXX=${CXX:-c++}
+CXXFLAGS=${CXXFLAGS:-"-O2 -g"}
+FLAGS="-std=gnu++17 -Wall -Wextra -Wno-unused-parameter -pthread -I$HERE/host -I$SRC"
+if [ -n "$ARDUINOJSON_DIR" ]; then
+  FLAGS="$FLAGS -I$ARDUINOJSON_DIR"
+fi
+
+run() {
+  name=$1
+  shift
+  echo "== $name"
+  # shellcheck disable=SC2086
+  $CXX $FLAGS $CXXFLAGS -o "$OUT/$name" "$HERE/$name.cpp" "$HERE/host/arduino_host.cpp" "$@"
+  "$OUT/$name"
+}
+
+run json_writer_bench "$SRC/internal/json_writer.cpp"
+run socket_http_server_test "$SRC/internal/socket_http_server.cpp" "$SRC/internal/http_transport.cpp" \
+  "$SRC/internal/idle_waiter.cpp"
+run idle_waiter_bench "$SRC/internal/idle_waiter.cpp" "$SRC/internal/captive_dns.cpp" \
+  "$SRC/internal/socket_http_server.cpp" "$SRC/internal/http_transport.cpp"
+run wpa_pmk_test "$SRC/internal/wpa_pmk.cpp"
+run provision_request_test "$SRC/internal/provision_request.cpp"
+run captive_dns_test "$SRC/internal/captive_dns.cpp"
+run credential_store_test "$SRC/internal/credential_store.cpp"
+
+echo "All host tests passed."
@@ -0,0 +1,275 @@
+// Host test of SocketHttpServer's connection handling: keep-alive reuse,
+// pipelining, the per-connection request limit, the idle close and
+// HTTP/1.0. The server polls on its own thread; the client side is plain
+// blocking sockets.
+#include "internal/socket_http_server.h"
+#include <Arduino.h>
+#include <atomic>
+#include <lwip/sockets.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <sys/time.h>
+#include <thread>
+
+using namespace wifiprov;
+
+namespace {
+
+const uint16_t kPort = 18089;
+
+int failures = 0;
+
+#define CHECK(condition)                                                                           \
+  do {                                                                                             \
+    if (!(condition)) {                                                                            \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                \
+      ++failures;                                                                                  \
+    }                                                                                              \
+  } while (0)
+
+struct Response {
+  int status = 0;
+  std::string connection;
+  std::string body;
+};
+
+// One client connection, with whatever has been read past the last response
+struct Client {
+  int fd = -1;
+  std::string pending;
+
+  bool open() {
+    fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(kPort);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    timeval timeout = {3, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return connect(fd, (sockaddr *)&address, sizeof(address)) == 0;
+  }
+
+  ~Client() {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+
+  void send(const std::string &data) { ::send(fd, data.data(), data.size(), MSG_NOSIGNAL); }
+
+  // Reads up to a complete response; false on close or timeout
+  bool read(Response &response) {
+    size_t headerEnd;
+    while ((headerEnd = pending.find("\r\n\r\n")) == std::string::npos) {
+      if (!fill()) {
+        return false;
+      }
+    }
+    std::string head = pending.substr(0, headerEnd + 2);
+    response.status = atoi(head.c_str() + 9);
+    response.connection = field(head, "Connection");
+    size_t length = strtoul(field(head, "Content-Length").c_str(), nullptr, 10);
+    while (pending.size() < headerEnd + 4 + length) {
+      if (!fill()) {
+        return false;
+      }
+    }
+    response.body = pending.substr(headerEnd + 4, length);
+    pending.erase(0, headerEnd + 4 + length);
+    return true;
+  }
+
+  // True once the server has closed its end
+  bool closed() {
+    char byte;
+    return recv(fd, &byte, 1, 0) == 0;
+  }
+
+private:
+  bool fill() {
+    char buffer[1024];
+    ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+    if (n <= 0) {
+      return false;
+    }
+    pending.append(buffer, n);
+    return true;
+  }
+
+  static std::string field(const std::string &head, const char *name) {
+    size_t at = head.find(std::string("\r\n") + name + ": ");
+    if (at == std::string::npos) {
+      return std::string();
+    }
+    at += strlen(name) + 4;
+    return head.substr(at, head.find("\r\n", at) - at);
+  }
+};
+
+std::string get(const char *path, const char *version = "HTTP/1.1", const char *extra = "") {
+  return std::string("GET ") + path + " " + version + "\r\nHost: test\r\n" + extra + "\r\n";
+}
+
+void testKeepAlive() {
+  Client client;
+  CHECK(client.open());
+  for (int i = 0; i < 10; ++i) {
+    Response response;
+    client.send(get("/"));
+    CHECK(client.read(response));
+    CHECK(response.status == 200 && response.connection == "keep-alive");
+  }
+  timeval shortWait = {0, 200000};
+  setsockopt(client.fd, SOL_SOCKET, SO_RCVTIMEO, &shortWait, sizeof(shortWait));
+  CHECK(!client.closed()); // Still open for the next request
+}
+
+void testPipelining() {
+  Client client;
+  CHECK(client.open());
+  client.send(get("/a") + "POST /echo HTTP/1.1\r\nHost: test\r\nContent-Length: 5\r\n\r\nhello" +
+              get("/b"));
+  Response a, echo, b;
+  CHECK(client.read(a) && a.body == "GET /a");
+  CHECK(client.read(echo) && echo.body == "POST /echo hello");
+  CHECK(client.read(b) && b.body == "GET /b");
+}
+
+void testRequestLimit() {
+  Client client;
+  CHECK(client.open());
+  for (int i = 1; i <= WIFI_PROVISIONER_HTTP_MAX_REQUESTS; ++i) {
+    Response response;
+    client.send(get("/"));
+    CHECK(client.read(response));
+    bool last = i == WIFI_PROVISIONER_HTTP_MAX_REQUESTS;
+    CHECK(response.connection == (last ? "close" : "keep-alive"));
+  }
+  CHECK(client.closed());
+}
+
+void testConnectionClose() {
+  Client http10;
+  CHECK(http10.open());
+  Response response;
+  http10.send(get("/", "HTTP/1.0"));
+  CHECK(http10.read(response) && response.connection == "close");
+  CHECK(http10.closed());
+
+  Client http10KeepAlive;
+  CHECK(http10KeepAlive.open());
+  http10KeepAlive.send(get("/", "HTTP/1.0", "Connection: keep-alive\r\n"));
+  CHECK(http10KeepAlive.read(response) && response.connection == "keep-alive");
+  http10KeepAlive.send(get("/", "HTTP/1.0", "Connection: keep-alive\r\n"));
+  CHECK(http10KeepAlive.read(response));
+
+  Client http11Close;
+  CHECK(http11Close.open());
+  http11Close.send(get("/", "HTTP/1.1", "Connection: close\r\n"));
+  CHECK(http11Close.read(response) && response.connection == "close");
+  CHECK(http11Close.closed());
+}
+
+void testIdleClose() {
+  Client client;
+  CHECK(client.open());
+  Response response;
+  client.send(get("/"));
+  CHECK(client.read(response));
+  timeval wait = {(long)(SocketHttpServer::kIdleTimeout / 1000 + 2), 0};
+  setsockopt(client.fd, SOL_SOCKET, SO_RCVTIMEO, &wait, sizeof(wait));
+  unsigned long start = millis();
+  CHECK(client.closed());
+  unsigned long elapsed = millis() - start;
+  CHECK(elapsed >= SocketHttpServer::kIdleTimeout - 100);
+}
+
+// Connections opened for a page load's worth of requests, with and without
+// persistent connections
+void reportHandshakes() {
+  const int requests = 8;
+  int persistent = 0;
+  int http10 = 0;
+  Client session;
+  persistent += session.open();
+  for (int i = 0; i < requests; ++i) {
+    Response response;
+    session.send(get("/"));
+    CHECK(session.read(response));
+  }
+  for (int i = 0; i < requests; ++i) {
+    Client client;
+    http10 += client.open();
+    Response response;
+    client.send(get("/", "HTTP/1.0"));
+    CHECK(client.read(response));
+  }
+  printf("%d requests: %d TCP handshake(s) kept alive, %d with HTTP/1.0\n", requests, persistent,
+         http10);
+  CHECK(persistent == 1 && http10 == requests);
+}
+
+void testRouteTable() {
+  SocketHttpServer server(kPort + 1);
+  static char paths[SocketHttpServer::kMaxRoutes + 1][8];
+  for (size_t i = 0; i <= SocketHttpServer::kMaxRoutes; ++i) {
+    snprintf(paths[i], sizeof(paths[i]), "/r%u", (unsigned)i);
+    bool added = server.on(paths[i], HttpMethod::Get, []() {});
+    CHECK(added == (i < SocketHttpServer::kMaxRoutes));
+  }
+}
+
+} // namespace
+
+int main() {
+  testRouteTable();
+
+  SocketHttpServer server(kPort);
+  auto respond = [&server](const std::string &body) {
+    Print *out = server.beginResponse();
+    out->print("HTTP/1.1 200 OK\r\nConnection: ");
+    out->print(server.keepAlive() ? "keep-alive" : "close");
+    out->print("\r\nContent-Length: ");
+    out->print((unsigned)body.size());
+    out->print("\r\n\r\n");
+    out->print(body.c_str());
+    server.endResponse();
+  };
+  server.on("/", HttpMethod::Get, [&]() { respond("root"); });
+  server.on("/a", HttpMethod::Get, [&]() { respond("GET /a"); });
+  server.on("/b", HttpMethod::Get, [&]() { respond("GET /b"); });
+  server.on("/echo", HttpMethod::Post, [&]() {
+    size_t length = 0;
+    const char *body = server.body(&length);
+    respond("POST /echo " + std::string(body, length));
+  });
+  if (!server.begin()) {
+    fprintf(stderr, "Could not listen on port %u\n", kPort);
+    return 1;
+  }
+
+  std::atomic<bool> running(true);
+  std::thread poller([&]() {
+    while (running) {
+      server.poll();
+      delay(1);
+    }
+  });
+
+  testKeepAlive();
+  testPipelining();
+  testRequestLimit();
+  testConnectionClose();
+  testIdleClose();
+  reportHandshakes();
+
+  running = false;
+  poller.join();
+  server.end();
+  if (failures) {
+    fprintf(stderr, "%d check(s) failed\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,126 @@
+// Checks pbkdf2HmacSha1() against the RFC 6070 vectors and derivePmk()
+// against the IEEE 802.11i Annex J ones, then times a PMK derivation. The
+// 16777216-iteration RFC 6070 vector takes tens of seconds and only runs
+// with WPA_PMK_LONG=1 in the environment.
+#include "internal/wpa_pmk.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace wifiprov;
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(condition)                                                                           \
+  do {                                                                                             \
+    if (!(condition)) {                                                                            \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                \
+      ++failures;                                                                                  \
+    }                                                                                              \
+  } while (0)
+
+void toHex(const uint8_t *bytes, size_t length, char *out) {
+  for (size_t i = 0; i < length; ++i) {
+    snprintf(out + 2 * i, 3, "%02x", bytes[i]);
+  }
+}
+
+// Lengths are passed so the vector with embedded NULs fits too
+bool pbkdf2Matches(const char *password, size_t passwordLength, const char *salt, size_t saltLength,
+                   uint32_t iterations, size_t outLength, const char *expected) {
+  uint8_t out[64];
+  char hex[2 * sizeof(out) + 1];
+  pbkdf2HmacSha1((const uint8_t *)password, passwordLength, (const uint8_t *)salt, saltLength,
+                 iterations, out, outLength);
+  toHex(out, outLength, hex);
+  if (strcmp(hex, expected) != 0) {
+    fprintf(stderr, "PBKDF2(\"%s\", \"%s\", %u): got %s\n", password, salt, (unsigned)iterations,
+            hex);
+    return false;
+  }
+  return true;
+}
+
+bool pmkMatches(const char *ssid, const char *passphrase, const char *expected) {
+  uint8_t pmk[kPmkLength];
+  char psk[kPskLength + 1];
+  if (!derivePmk(ssid, passphrase, pmk)) {
+    return false;
+  }
+  formatPsk(pmk, psk);
+  return strcmp(psk, expected) == 0 && isPsk(psk);
+}
+
+void testRfc6070() {
+  CHECK(pbkdf2Matches("password", 8, "salt", 4, 1, 20, "0c60c80f961f0e71f3a9b524af6012062fe037a6"));
+  CHECK(pbkdf2Matches("password", 8, "salt", 4, 2, 20, "ea6c014dc72d6f8ccd1ed92ace1d41f0d8de8957"));
+  CHECK(pbkdf2Matches("password", 8, "salt", 4, 4096, 20,
+                      "4b007901b765489abead49d926f721d065a429c1"));
+  CHECK(pbkdf2Matches("passwordPASSWORDpassword", 24, "saltSALTsaltSALTsaltSALTsaltSALTsalt", 36,
+                      4096, 25, "3d2eec4fe41c849b80c8d83662c0e44a8b291a964cf2f07038"));
+  CHECK(pbkdf2Matches("pass\0word", 9, "sa\0lt", 5, 4096, 16, "56fa6aa75548099dcc37d7f03425e0c3"));
+  const char *longRun = getenv("WPA_PMK_LONG");
+  if (longRun && strcmp(longRun, "1") == 0) {
+    CHECK(pbkdf2Matches("password", 8, "salt", 4, 16777216, 20,
+                        "eefe3d61cd4da4e4e9945b3d6ba2158c2634e984"));
+  }
+}
+
+void testAnnexJ() {
+  CHECK(pmkMatches("IEEE", "password",
+                   "f42c6fc52df0ebef9ebb4b90b38a5f902e83fe1b135a70e23aed762e9710a12e"));
+  CHECK(pmkMatches("ThisIsASSID", "ThisIsAPassword",
+                   "0dc0d6eb90555ed6419756b9a15ec3e3209b63df707dd508d14581f8982721af"));
+}
+
+void testLimits() {
+  uint8_t pmk[kPmkLength];
+  CHECK(!derivePmk("IEEE", "short", pmk));
+  CHECK(!derivePmk("", "password", pmk));
+  CHECK(!derivePmk("ThisSSIDIsOneByteTooLongForWiFi!!", "password", pmk));
+  CHECK(derivePmk("ThisSSIDIsExactlyThirtyTwoBytes!", "password", pmk));
+  char longest[64];
+  memset(longest, 'a', 63);
+  longest[63] = '\0';
+  CHECK(derivePmk("IEEE", longest, pmk));
+
+  char psk[kPskLength + 2];
+  memset(psk, 'A', kPskLength + 1);
+  psk[kPskLength + 1] = '\0';
+  CHECK(!isPsk(psk)); // One digit too many
+  psk[kPskLength] = '\0';
+  CHECK(isPsk(psk));
+  psk[3] = 'g';
+  CHECK(!isPsk(psk));
+  CHECK(!isPsk("password"));
+  CHECK(!isPsk(""));
+}
+
+// Time of one derivation, as rememberNetwork() pays it once per stored network
+void timeDerivation() {
+  const int runs = 200;
+  uint8_t pmk[kPmkLength];
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; ++i) {
+    derivePmk("HomeNetwork", "correct horse battery", pmk);
+  }
+  std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  printf("derivePmk: %.2f ms per PMK (2 x 8192 SHA-1 blocks)\n", elapsed.count() / runs);
+}
+
+} // namespace
+
+int main() {
+  testRfc6070();
+  testAnnexJ();
+  testLimits();
+  timeDerivation();
+  if (failures) {
+    fprintf(stderr, "%d check(s) failed\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,476 @@
+#!/usr/bin/env python3
+"""Generates src/internal/provision_html.h from the portal page sources.
+
+The portal is split into a small HTML shell (extras/portal/index.html) and
+static assets (app.css, app.js) that browsers cache. Values taken from
+WiFiProvisioner::Config at runtime are marked in the shell with {{SLOT_NAME}}
+placeholders; {{VERSION:file}} is replaced here with the content hash of an
+asset, so its URL changes whenever the asset does. This script:
+
+  * minifies the HTML, CSS and JS (comments, indentation, console.log calls),
+  * splits the shell at the placeholders into static chunks,
+  * precompresses every shell chunk as a raw deflate stream ending in a sync
+    flush, so the firmware can splice chunks and injected values into one
+    gzip body without running a compressor over the static parts,
+  * gzips every asset whole, so it can be sent straight from flash,
+  * emits all of it as a C++ header.
+
+Unknown or missing placeholders are reported here instead of at runtime.
+
+Usage:
+  python3 extras/tools/build_portal_assets.py          # regenerate the header
+  python3 extras/tools/build_portal_assets.py --check  # fail if it is stale
+"""
+
+import argparse
+import gzip
+import os
+import re
+import sys
+import zlib
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(__file__), "..", ".."))
+PORTAL = os.path.join(ROOT, "extras", "portal")
+SOURCE = os.path.join(PORTAL, "index.html")
+OUTPUT = os.path.join(ROOT, "src", "internal", "provision_html.h")
+
+# Injection points, in PageSlot enum order. Every slot must appear in the
+# page at least once; anything else between {{ and }} is an error.
+SLOTS = [
+    "HTML_TITLE",
+    "THEME_COLOR",
+    "CONFIG",
+]
+
+# Static assets: source file, URL path and content type.
+ASSETS = [
+    ("app.css", "/app.css", "text/css"),
+    ("app.js", "/app.js", "application/javascript"),
+]
+
+PLACEHOLDER = re.compile(r"\{\{([A-Za-z0-9_]*)\}\}")
+VERSION = re.compile(r"\{\{VERSION:([A-Za-z0-9_.]+)\}\}")
+
+
+# --- HTML / CSS ---------------------------------------------------------------
+
+def minify_html(text):
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    # Whitespace directly inside tag brackets never matters.
+    text = re.sub(r"<\s+", "<", text)
+    text = re.sub(r"\s+(/?>)", r"\1", text)
+    return text
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    # A space before ':' can be a descendant combinator, so only trim after it.
+    text = re.sub(r"\s*([{};,>])\s*", r"\1", text)
+    text = re.sub(r":\s+", ":", text)
+    text = text.replace(";}", "}")
+    return text.strip()
+
+
+# --- JS -----------------------------------------------------------------------
+
+PUNCTUATORS = sorted(
+    ["===", "!==", "...", "==", "!=", "<=", ">=", "&&", "||", "??", "?.",
+     "++", "--", "=>", "+=", "-=", "*=", "/=", "%=", "&=", "|="],
+    key=len, reverse=True)
+REGEX_PREFIX = set("( , = : [ ! & | ? { } ; + - * % < > ~ ^ => && || ?? == === != !==".split())
+REGEX_KEYWORDS = {"return", "typeof", "case", "do", "else", "in", "of", "new",
+                  "delete", "void", "throw"}
+RESTRICTED = {"return", "break", "continue", "throw"}
+WORD = re.compile(r"[A-Za-z0-9_$]")
+
+
+def _skip_string(src, i):
+    quote = src[i]
+    i += 1
+    while src[i] != quote:
+        i += 2 if src[i] == "\\" else 1
+    return i + 1
+
+
+def _skip_template(src, i):
+    i += 1
+    while src[i] != "`":
+        if src[i] == "\\":
+            i += 2
+        elif src.startswith("${", i):
+            i = _skip_expression(src, i + 2)
+        else:
+            i += 1
+    return i + 1
+
+
+def _skip_expression(src, i):
+    depth = 1
+    while True:
+        c = src[i]
+        if c in "'\"":
+            i = _skip_string(src, i)
+        elif c == "`":
+            i = _skip_template(src, i)
+        elif c == "{":
+            depth += 1
+            i += 1
+        elif c == "}":
+            depth -= 1
+            i += 1
+            if depth == 0:
+                return i
+        else:
+            i += 1
+
+
+def _skip_regex(src, i):
+    i += 1
+    in_class = False
+    while in_class or src[i] != "/":
+        if src[i] == "\\":
+            i += 1
+        elif src[i] == "[":
+            in_class = True
+        elif src[i] == "]":
+            in_class = False
+        i += 1
+    i += 1
+    while i < len(src) and WORD.match(src[i]):
+        i += 1
+    return i
+
+
+def tokenize_js(src):
+    """Returns (token, newline_before) pairs; comments are dropped."""
+    tokens = []
+    newline = False
+    i = 0
+    while i < len(src):
+        c = src[i]
+        if c.isspace():
+            newline = newline or c == "\n"
+            i += 1
+            continue
+        if src.startswith("//", i):
+            i = src.find("\n", i)
+            i = len(src) if i < 0 else i
+            continue
+        if src.startswith("/*", i):
+            end = src.find("*/", i + 2)
+            newline = newline or "\n" in src[i:end]
+            i = end + 2
+            continue
+
+        start = i
+        prev = tokens[-1][0] if tokens else ";"
+        if c in "'\"":
+            i = _skip_string(src, i)
+        elif c == "`":
+            i = _skip_template(src, i)
+        elif c == "/" and (prev in REGEX_PREFIX or prev in REGEX_KEYWORDS):
+            i = _skip_regex(src, i)
+        elif WORD.match(c):
+            while i < len(src) and WORD.match(src[i]):
+                i += 1
+        else:
+            for p in PUNCTUATORS:
+                if src.startswith(p, i):
+                    i += len(p)
+                    break
+            else:
+                i += 1
+        tokens.append((src[start:i], newline))
+        newline = False
+    return tokens
+
+
+def _is_wordy(token):
+    return bool(WORD.match(token[0])) and bool(WORD.match(token[-1]))
+
+
+def _ends_expression(token):
+    return _is_wordy(token) or token[0] in "'\"`/" or token in (")", "]", "}", "++", "--")
+
+
+def _starts_expression(token):
+    return _is_wordy(token) or token[0] in "'\"`{!~" or token in ("++", "--")
+
+
+def strip_console_log(tokens):
+    out = []
+    i = 0
+    while i < len(tokens):
+        if [t for t, _ in tokens[i:i + 4]] == ["console", ".", "log", "("]:
+            depth = 0
+            j = i + 3
+            while True:
+                if tokens[j][0] == "(":
+                    depth += 1
+                elif tokens[j][0] == ")":
+                    depth -= 1
+                    if depth == 0:
+                        break
+                j += 1
+            j += 1
+            at_statement = not out or out[-1][0] in (";", "{", "}")
+            if at_statement:
+                if j < len(tokens) and tokens[j][0] == ";":
+                    j += 1
+            else:
+                # e.g. the body of an unbraced if; keep an expression there.
+                out.append(("void", tokens[i][1]))
+                out.append(("0", False))
+            i = j
+            continue
+        out.append(tokens[i])
+        i += 1
+    return out
+
+
+def minify_js(text):
+    tokens = strip_console_log(tokenize_js(text))
+    out = []
+    prev = None
+    for token, newline in tokens:
+        if prev is not None:
+            # Keep line breaks wherever automatic semicolon insertion could
+            # depend on them; drop them everywhere else.
+            if newline and (prev in RESTRICTED or
+                            (_ends_expression(prev) and _starts_expression(token))):
+                out.append("\n")
+            elif _is_wordy(prev[-1]) and _is_wordy(token[0]):
+                out.append(" ")
+            elif prev[-1] in "+-" and token[0] == prev[-1]:
+                out.append(" ")
+        out.append(token)
+        prev = token
+    return "".join(out)
+
+
+# --- Page assembly ------------------------------------------------------------
+
+def minify_page(text):
+    out = []
+    pos = 0
+    for m in re.finditer(r"(<(style|script)[^>]*>)(.*?)(</\2>)", text, flags=re.S | re.I):
+        out.append(minify_html(text[pos:m.start()]))
+        body = minify_css(m.group(3)) if m.group(2).lower() == "style" else minify_js(m.group(3))
+        out.append(m.group(1) + body + m.group(4))
+        pos = m.end()
+    out.append(minify_html(text[pos:]))
+    return "".join(out).strip()
+
+
+def minify_asset(name, text):
+    return minify_css(text) if name.endswith(".css") else minify_js(text)
+
+
+def asset_version(data):
+    return "%08x" % zlib.crc32(data)
+
+
+def insert_versions(page, versions):
+    def version(m):
+        if m.group(1) not in versions:
+            sys.exit("error: {{VERSION:%s}} names no asset" % m.group(1))
+        return versions[m.group(1)]
+    return VERSION.sub(version, page)
+
+
+def split_chunks(page):
+    """Splits the page into (text, slot) pairs, where slot follows the text."""
+    chunks = []
+    seen = set()
+    pos = 0
+    for m in PLACEHOLDER.finditer(page):
+        name = m.group(1)
+        if name not in SLOTS:
+            line = page.count("\n", 0, m.start()) + 1
+            sys.exit("error: unknown placeholder {{%s}} (minified line %d)" % (name, line))
+        chunks.append((page[pos:m.start()], name))
+        seen.add(name)
+        pos = m.end()
+    chunks.append((page[pos:], None))
+    missing = [s for s in SLOTS if s not in seen]
+    if missing:
+        sys.exit("error: placeholders never used: " + ", ".join(missing))
+    return chunks
+
+
+def deflate_chunk(data):
+    # Raw deflate (no zlib header), ending byte aligned without BFINAL so the
+    # firmware can keep appending blocks after it.
+    compressor = zlib.compressobj(9, zlib.DEFLATED, -15, 9)
+    return compressor.compress(data) + compressor.flush(zlib.Z_SYNC_FLUSH)
+
+
+def gzip_asset(data):
+    # mtime=0 keeps the output, and so the header, reproducible.
+    return gzip.compress(data, 9, mtime=0)
+
+
+def c_string(data, indent="    "):
+    lines = []
+    line = ""
+    for byte in data:
+        ch = chr(byte)
+        if ch == "\\":
+            piece = "\\\\"
+        elif ch == '"':
+            piece = '\\"'
+        elif ch == "\n":
+            piece = "\\n"
+        elif ch == "?":
+            piece = "\\?"  # avoid trigraphs
+        elif 0x20 <= byte < 0x7F:
+            piece = ch
+        else:
+            piece = "\\%03o" % byte
+        line += piece
+        if len(line) >= 96:
+            lines.append(line)
+            line = ""
+    if line or not lines:
+        lines.append(line)
+    return "\n".join('%s"%s"' % (indent, l) for l in lines)
+
+
+def c_bytes(data, indent="    "):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append(indent + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(rows)
+
+
+def render_header(chunks, assets, source_name):
+    # The shell text embeds the asset versions, so this covers the assets too.
+    static_hash = zlib.crc32("".join(t for t, _ in chunks).encode("utf-8"))
+    out = []
+    w = out.append
+    w("// Generated by extras/tools/build_portal_assets.py from %s." % source_name)
+    w("// Do not edit by hand; change the source and re-run the script.")
+    w("#ifndef PROVISION_HTML_H")
+    w("#define PROVISION_HTML_H")
+    w("")
+    w("#include <Arduino.h>")
+    w("")
+    w("// Config values injected between the static page chunks.")
+    w("enum class PageSlot : uint8_t {")
+    for name in SLOTS:
+        w("  %s," % name)
+    w("  NONE")
+    w("};")
+    w("")
+    w("// One static piece of the page. `deflated` holds the same bytes as a raw")
+    w("// deflate stream ending in a sync flush; `slot` is injected after it.")
+    w("struct PageChunk {")
+    w("  const char *text;")
+    w("  uint16_t textLength;")
+    w("  const uint8_t *deflated;")
+    w("  uint16_t deflatedLength;")
+    w("  PageSlot slot;")
+    w("};")
+    w("")
+    total_text = total_deflated = 0
+    for index, (text, _) in enumerate(chunks):
+        data = text.encode("utf-8")
+        deflated = deflate_chunk(data)
+        total_text += len(data)
+        total_deflated += len(deflated)
+        w("static constexpr const char page_chunk%d[] PROGMEM =" % index)
+        w(c_string(data) + ";")
+        w("static constexpr const uint8_t page_chunk%d_deflated[] PROGMEM = {" % index)
+        w(c_bytes(deflated))
+        w("};")
+        w("")
+    w("static constexpr PageChunk page_chunks[] PROGMEM = {")
+    for index, (text, slot) in enumerate(chunks):
+        w("    {page_chunk%d, sizeof(page_chunk%d) - 1, page_chunk%d_deflated," % (index, index, index))
+        w("     sizeof(page_chunk%d_deflated), PageSlot::%s}," % (index, slot or "NONE"))
+    w("};")
+    w("static constexpr size_t page_chunk_count = %d;" % len(chunks))
+    w("")
+    w("// A static resource served as-is, gzipped or plain, with a long-lived")
+    w("// cache policy. `version` is part of the URL the page links it with.")
+    w("struct PortalAsset {")
+    w("  const char *path;")
+    w("  const char *contentType;")
+    w("  const char *version;")
+    w("  const char *text;")
+    w("  uint32_t textLength;")
+    w("  const uint8_t *gzip;")
+    w("  uint32_t gzipLength;")
+    w("};")
+    w("")
+    for index, (name, path, content_type, data, version) in enumerate(assets):
+        compressed = gzip_asset(data)
+        total_text += len(data)
+        total_deflated += len(compressed)
+        w("// %s" % name)
+        w("static constexpr const char portal_asset%d[] PROGMEM =" % index)
+        w(c_string(data) + ";")
+        w("static constexpr const uint8_t portal_asset%d_gzip[] PROGMEM = {" % index)
+        w(c_bytes(compressed))
+        w("};")
+        w("")
+    w("static constexpr PortalAsset portal_assets[] PROGMEM = {")
+    for index, (name, path, content_type, data, version) in enumerate(assets):
+        w('    {"%s", "%s", "%s", portal_asset%d,' % (path, content_type, version, index))
+        w("     sizeof(portal_asset%d) - 1, portal_asset%d_gzip, sizeof(portal_asset%d_gzip)}," % (index, index, index))
+    w("};")
+    w("static constexpr size_t portal_asset_count = %d;" % len(assets))
+    w("")
+    w("// CRC-32 of all static chunks; changes whenever the page source does.")
+    w("static constexpr uint32_t page_static_hash = 0x%08X;" % static_hash)
+    w("")
+    w("#endif // PROVISION_HTML_H")
+    w("")
+    return "\n".join(out), total_text, total_deflated
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--check", action="store_true",
+                        help="exit non-zero if the generated header is out of date")
+    args = parser.parse_args()
+
+    source_size = 0
+    assets = []
+    versions = {}
+    for name, path, content_type in ASSETS:
+        with open(os.path.join(PORTAL, name), encoding="utf-8") as f:
+            text = f.read()
+        source_size += len(text.encode("utf-8"))
+        data = minify_asset(name, text).encode("utf-8")
+        versions[name] = asset_version(data)
+        assets.append((name, path, content_type, data, versions[name]))
+
+    with open(SOURCE, encoding="utf-8") as f:
+        source = f.read()
+    source_size += len(source.encode("utf-8"))
+    page = insert_versions(minify_page(source), versions)
+    chunks = split_chunks(page)
+    for text, _ in chunks:
+        if len(text.encode("utf-8")) > 0xFFFF:
+            sys.exit("error: chunk exceeds 64 KB; add a split point")
+    header, total_text, total_deflated = render_header(
+        chunks, assets, os.path.relpath(PORTAL, ROOT))
+
+    if args.check:
+        with open(OUTPUT, encoding="utf-8") as f:
+            if f.read() != header:
+                sys.exit("%s is stale; re-run %s" % (os.path.relpath(OUTPUT, ROOT), os.path.relpath(__file__, ROOT)))
+        return
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write(header)
+    print("%s: %d bytes source -> %d bytes minified -> %d bytes compressed, %d chunks, %d assets"
+          % (os.path.relpath(OUTPUT, ROOT), source_size, total_text,
+             total_deflated, len(chunks), len(assets)))
+
+
+if __name__ == "__main__":
+    main()
@@ -1,9 +1,15 @@
 #include "WiFiProvisioner.h"
-#include "internal/provision_html.h" // Include the corrected header
-#include <ArduinoJson.h>
-#include <DNSServer.h>
-#include <WebServer.h>
+#include "internal/gzip_writer.h"
+#include "internal/http_transport.h"
+#include "internal/idle_waiter.h"
+#include "internal/json_writer.h"
+#include "internal/provision_html.h"
+#include "internal/socket_http_server.h"
+#include "internal/station_connector.h"
+#include "internal/webserver_transport.h"
+#include "internal/wpa_pmk.h"
 #include <WiFi.h>
+#include <esp_wifi.h>
 
 #define WIFI_PROVISIONER_LOG_DEBUG 0
 #define WIFI_PROVISIONER_LOG_INFO 1
@@ -29,8 +35,7 @@
 #endif
 
 namespace {
-// --- Helper functions (convertRRSItoLevel, networkScan, sendStandardHeaders) ---
-// --- (Unchanged from the previous correct version) ---
+// --- Helper functions: scan results, responses, page rendering ---
 /**
  * @brief Converts a Received Signal Strength Indicator (RSSI) value to a signal
  * strength level (0-4).
@@ -56,53 +61,406 @@ int convertRRSItoLevel(int rssi) {
 }
 
 /**
- * @brief Scans for available Wi-Fi networks and populates a JSON document.
+ * @brief Merges the `n` access points of a finished scan into `list`: one
+ * entry per SSID at its strongest RSSI, strongest first, at most `limit`.
  */
-void networkScan(JsonDocument &doc) {
-  JsonArray networks = doc["network"].to<JsonArray>();
-
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
-                             "Starting Network Scan...");
-  // WiFi.scanNetworks will return the number of networks found, or -1/-2 on error.
-  int n = WiFi.scanNetworks(false, false); // Async=false, ShowHidden=false
+void collectScanResults(wifiprov::NetworkList &list, int n, size_t limit) {
+  list.clear(limit);
   if (n > 0) {
-     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Found %d networks.", n);
+     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Found %d access points.", n);
     for (int i = 0; i < n; ++i) {
-      JsonObject network = networks.add<JsonObject>();
-      int rssiVal = WiFi.RSSI(i);
-      network["rssi"] = convertRRSItoLevel(rssiVal);
-      network["ssid"] = WiFi.SSID(i);
-      // Determine authentication mode (0 = Open, 1 = Secured)
-      network["authmode"] = (WiFi.encryptionType(i) == WIFI_AUTH_OPEN) ? 0 : 1;
-       WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "  [%d] SSID: %s, RSSI: %d (%d), Auth: %d", i, WiFi.SSID(i).c_str(), rssiVal, network["rssi"].as<int>(), network["authmode"].as<int>());
+      // Read the driver's record directly instead of a String per field
+      const wifi_ap_record_t *ap = (const wifi_ap_record_t *)WiFi.getScanInfoByIndex(i);
+      if (!ap) {
+        continue;
+      }
+      list.add(ap->ssid, ap->rssi, ap->authmode != WIFI_AUTH_OPEN, ap->primary, ap->bssid);
+       WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "  [%d] SSID: %s, RSSI: %d, Channel: %d, Auth: %d", i, (const char *)ap->ssid, ap->rssi, ap->primary, (int)ap->authmode);
     }
+    list.sort();
   } else if (n == 0) {
       WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "No networks found during scan.");
-  } else {
-      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "WiFi scan failed with code: %d", n);
   }
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Network scan complete.");
 }
 
+/**
+ * @brief True for failures that mean a stored password no longer works. A
+ * handshake timeout counts: on ESP32 it is how a wrong WPA2 password
+ * usually shows. Such a network is not tried again during this boot.
+ */
+bool passwordRejected(wifiprov::ConnectFailure failure) {
+  return failure == wifiprov::ConnectFailure::AuthFailed ||
+         failure == wifiprov::ConnectFailure::HandshakeTimeout;
+}
+
+/**
+ * @brief A stored network seen in a scan, at its strongest access point.
+ */
+struct StoredCandidate {
+  size_t index; // Into the stored list
+  int score;
+  wifiprov::ConnectHint hint;
+};
+
+/**
+ * @brief Matches the `n` access points of a finished scan against the
+ * `count` stored networks, leaving out those set in `skip`. Fills `out`
+ * best first: by RSSI, less 10 dB per failed boot join, the more recently
+ * joined on a tie.
+ */
+size_t matchStoredNetworks(const wifiprov::StoredNetwork *networks, size_t count, uint32_t skip, int n,
+                           StoredCandidate *out) {
+  size_t found = 0;
+  for (int i = 0; i < n; ++i) {
+    const wifi_ap_record_t *ap = (const wifi_ap_record_t *)WiFi.getScanInfoByIndex(i);
+    if (!ap) {
+      continue;
+    }
+    for (size_t j = 0; j < count; ++j) {
+      // Security that does not fit the stored password is another network
+      if ((skip & (1u << j)) || strncmp((const char *)ap->ssid, networks[j].ssid, sizeof(networks[j].ssid)) != 0 ||
+          (ap->authmode != WIFI_AUTH_OPEN) != (networks[j].password[0] != '\0') ||
+          (ap->authmode == WIFI_AUTH_WPA3_PSK && wifiprov::isPsk(networks[j].password))) {
+        continue;
+      }
+      size_t c = 0;
+      while (c < found && out[c].index != j) {
+        ++c;
+      }
+      int score = ap->rssi - 10 * networks[j].failures;
+      if (c == found) {
+        ++found;
+      } else if (score <= out[c].score) {
+        break; // Already have a stronger access point for it
+      }
+      out[c].index = j;
+      out[c].score = score;
+      memcpy(out[c].hint.bssid, ap->bssid, sizeof(out[c].hint.bssid));
+      out[c].hint.channel = ap->primary;
+      break;
+    }
+  }
+
+  // Insertion sort; ties keep the stored order, most recently joined first
+  for (size_t i = 1; i < found; ++i) {
+    StoredCandidate candidate = out[i];
+    size_t j = i;
+    while (j > 0 && (out[j - 1].score < candidate.score ||
+                     (out[j - 1].score == candidate.score && out[j - 1].index > candidate.index))) {
+      out[j] = out[j - 1];
+      --j;
+    }
+    out[j] = candidate;
+  }
+  return found;
+}
+
+/**
+ * @brief Writes a network list as the JSON array the page expects.
+ */
+void writeNetworks(wifiprov::JsonWriter &json, const wifiprov::NetworkList &list) {
+  json.beginArray();
+  for (size_t i = 0; i < list.size(); ++i) {
+    json.beginObject()
+        .member("rssi", convertRRSItoLevel(list[i].rssi))
+        .member("ssid", list[i].ssid)
+        // Determine authentication mode (0 = Open, 1 = Secured)
+        .member("authmode", list[i].secured ? 1 : 0)
+        .endObject();
+  }
+  json.endArray();
+}
+
+
+/**
+ * @brief Reason phrase for the status codes this library sends.
+ */
+const char *statusText(int statusCode) {
+  switch (statusCode) {
+  case 200: return "OK";
+  case 202: return "Accepted";
+  case 204: return "No Content";
+  case 302: return "Found";
+  case 304: return "Not Modified";
+  case 400: return "Bad Request";
+  case 409: return "Conflict";
+  default: return "OK";
+  }
+}
 
 /**
- * @brief Sends standard HTTP headers for a response.
+ * @brief Sends standard HTTP headers for a response. Responses are not cached
+ * unless a `cacheControl` policy is given. The connection is kept open if
+ * the transport allows it, so every response must carry a Content-Length.
  */
-void sendStandardHeaders(WiFiClient &client, int statusCode, const char *contentType) {
-    client.print("HTTP/1.1 "); client.print(statusCode); client.println(" OK");
-    client.print("Content-Type: "); client.println(contentType);
-    client.println("Cache-Control: no-cache, no-store, must-revalidate");
-    client.println("Pragma: no-cache");
-    client.println("Expires: -1");
-    client.println("Connection: close"); // Important: close connection after response
-    // Content-Length will be added separately if known, otherwise chunked or close is needed
+void sendStandardHeaders(wifiprov::HttpTransport &http, Print &out, int statusCode,
+                         const char *contentType, const char *cacheControl = nullptr) {
+    out.print("HTTP/1.1 "); out.print(statusCode); out.print(" "); out.println(statusText(statusCode));
+    if (contentType) {
+      out.print("Content-Type: "); out.println(contentType);
+    }
+    if (cacheControl) {
+      out.print("Cache-Control: "); out.println(cacheControl);
+    } else {
+      out.println("Cache-Control: no-cache, no-store, must-revalidate");
+      out.println("Pragma: no-cache");
+      out.println("Expires: -1");
+    }
+    out.println(http.keepAlive() ? "Connection: keep-alive" : "Connection: close");
+    // Content-Length is added by the caller
+}
+
+/**
+ * @brief Completes a response and logs what it cost on the wire. The
+ * connection is closed once the transport has sent it.
+ */
+void finishResponse(wifiprov::HttpTransport &http, const char *label) {
+  wifiprov::ResponseStats stats = http.endResponse();
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "%s: %u bytes in %u segments.",
+                             label, (unsigned)stats.bytes, (unsigned)stats.segments);
+}
+
+/**
+ * @brief Sends a JSON response whose body comes from `emit(JsonWriter &)`.
+ * The body is emitted twice, first into a counter for Content-Length, so
+ * nothing is built up in memory.
+ */
+template <typename EmitFn>
+void sendJsonResponse(wifiprov::HttpTransport &http, int statusCode, const char *label, EmitFn &&emit) {
+  Print *out = http.beginResponse();
+  if (!out) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "No client for %s response.", label);
+    return;
+  }
+  wifiprov::ByteCounter counter;
+  wifiprov::JsonWriter measure(counter);
+  emit(measure);
+
+  sendStandardHeaders(http, *out, statusCode, "application/json");
+  out->print("Content-Length: "); out->println((unsigned)counter.count());
+  out->println(); // End headers
+  wifiprov::JsonWriter json(*out);
+  emit(json);
+  finishResponse(http, label);
+}
+
+/**
+ * @brief Checks an If-None-Match header value against `etag` using the weak
+ * comparison RFC 9110 prescribes for this header.
+ */
+bool etagMatches(const char *ifNoneMatch, const char *etag) {
+  const char *p = ifNoneMatch;
+  size_t etagLength = strlen(etag);
+  while (p && *p) {
+    while (*p == ' ' || *p == ',') ++p;
+    if (*p == '*') return true;
+    if (strncmp(p, "W/", 2) == 0) p += 2;
+    const char *token = p;
+    while (*p && *p != ',' && *p != ' ') ++p;
+    if ((size_t)(p - token) == etagLength && strncmp(token, etag, etagLength) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Checks whether a Host header names `address`, with or without a
+ * port (RFC 9110 allows "192.168.4.1:80").
+ */
+bool hostIs(const char *host, const char *address) {
+  size_t length = strlen(address);
+  if (strncmp(host, address, length) != 0) {
+    return false;
+  }
+  const char *port = host + length;
+  if (*port == ':') {
+    while (isdigit((unsigned char)*++port)) {
+    }
+  }
+  return *port == '\0';
+}
+
+/**
+ * @brief Checks an Accept-Encoding header value for a usable "gzip" coding.
+ * A coding listed with q=0 is treated as refused.
+ */
+bool acceptsGzip(const char *acceptEncoding) {
+  const char *p = acceptEncoding;
+  while (p && *p) {
+    while (*p == ' ' || *p == ',') ++p;
+    const char *token = p;
+    while (*p && *p != ',' && *p != ';' && *p != ' ') ++p;
+    bool isGzip = (p - token == 4) && strncasecmp(token, "gzip", 4) == 0;
+    // Skip parameters, watching for an explicit q=0
+    bool refused = false;
+    while (*p && *p != ',') {
+      if ((p[0] == 'q' || p[0] == 'Q') && p[1] == '=') {
+        refused = atof(p + 2) <= 0.0;
+      }
+      ++p;
+    }
+    if (isGzip) return !refused;
+  }
+  return false;
+}
+
+/**
+ * @brief Connectivity-check URLs and the reply that makes each OS open its
+ * captive portal sheet. Apple's assistant only needs a page that is not its
+ * expected "Success" document; everyone else is redirected to the portal.
+ */
+struct CaptiveProbe {
+  const char *path;
+  bool stub; // true: tiny HTML page, false: 302 to the portal
+};
+
+const CaptiveProbe kCaptiveProbes[] = {
+    {"/generate_204", false},              // Android, ChromeOS
+    {"/gen_204", false},                   // Android
+    {"/hotspot-detect.html", true},        // Apple
+    {"/library/test/success.html", true},  // Apple (older iOS)
+    {"/success.html", true},               // Apple, some Linux desktops
+    {"/ncsi.txt", false},                  // Windows NCSI
+    {"/connecttest.txt", false},           // Windows 10+
+    {"/redirect", false},                  // Windows 10+ follow-up
+    {"/fwlink", false},                    // Microsoft
+    {"/canonical.html", false},            // Firefox
+    {"/success.txt", false},               // Firefox
+};
+
+// A manual refresh does not rescan if the cached result is newer than this
+const unsigned long kMinRescanInterval = 5000;
+
+// How often startProvisioning() logs its wakeups and DNS queries per second
+const unsigned long kWakeupStatsInterval = 10000;
+
+// After a successful attempt the server stays up until the page has read
+// the result from /status, or this long at most
+const unsigned long kConnectLinger = 5000;
+
+// Beacons announcing a soft AP channel move before it happens; clients
+// that honour the announcement follow the AP instead of losing it
+const uint8_t kApCsaCount = 3;
+
+// Cache policy for resources whose URL carries their content version
+const char *const kImmutableCacheControl = "public, max-age=31536000, immutable";
+
+/**
+ * @brief FNV-1a hash of a string, continuing from `hash`.
+ */
+uint32_t hashString(const char *s, uint32_t hash = 2166136261u) {
+  for (; s && *s; ++s) hash = (hash ^ (uint8_t)*s) * 16777619u;
+  return hash;
+}
+
+/**
+ * @brief FNV-1a fingerprint of every Config value that ends up in the page,
+ * plus the generation of the scan inlined into it. Used to notice when the
+ * page changed after the page cache was built.
+ */
+uint32_t pageFingerprint(const WiFiProvisioner::Config &config, uint32_t scanGeneration) {
+  uint32_t hash = 2166136261u;
+  auto mixByte = [&hash](uint8_t b) { hash = (hash ^ b) * 16777619u; };
+  auto mixString = [&](const char *s) {
+    for (; s && *s; ++s) mixByte((uint8_t)*s);
+    mixByte(0); // field separator
+  };
+  mixString(config.HTML_TITLE);
+  mixString(config.THEME_COLOR);
+  mixString(config.SVG_LOGO);
+  mixString(config.PROJECT_TITLE);
+  mixString(config.PROJECT_SUB_TITLE);
+  mixString(config.PROJECT_INFO);
+  mixString(config.FOOTER_TEXT);
+  mixString(config.CONNECTION_SUCCESSFUL);
+  mixString(config.RESET_CONFIRMATION_TEXT);
+  mixString(config.INPUT_TEXT);
+  mixString(config.USERNAME_TEXT);
+  mixString(config.SERVICE_PASSWORD_TEXT);
+  for (int shift = 0; shift < 32; shift += 8) mixByte((uint8_t)(config.INPUT_LENGTH >> shift));
+  mixByte(config.SHOW_INPUT_FIELD);
+  mixByte(config.SHOW_RESET_FIELD);
+  mixByte(config.SHOW_LOGIN_FIELDS);
+  for (int shift = 0; shift < 32; shift += 8) mixByte((uint8_t)(scanGeneration >> shift));
+  return hash;
+}
+
+/**
+ * @brief Writes the JSON blob the page script reads its texts and switches
+ * from. The logo URL carries a hash of the logo so browsers can cache it.
+ * `networks`, the cached scan result if there is one, lets the page list
+ * networks on first paint without calling /update.
+ */
+void writeConfigBlob(const WiFiProvisioner::Config &config, const wifiprov::NetworkList *networks,
+                     Print &out) {
+  char logoUrl[24];
+  snprintf(logoUrl, sizeof(logoUrl), "/logo.svg?v=%08x", (unsigned)hashString(config.SVG_LOGO));
+
+  // JsonWriter escapes '<', so the blob cannot close its <script> element
+  wifiprov::JsonWriter json(out);
+  json.beginObject()
+      .member("logo", (const char *)logoUrl)
+      .member("title", config.PROJECT_TITLE)
+      .member("subtitle", config.PROJECT_SUB_TITLE)
+      .member("info", config.PROJECT_INFO)
+      .member("footer", config.FOOTER_TEXT)
+      .member("connection_successful", config.CONNECTION_SUCCESSFUL)
+      .member("reset_confirmation", config.RESET_CONFIRMATION_TEXT)
+      .member("input_text", config.INPUT_TEXT)
+      .member("input_length", config.INPUT_LENGTH)
+      .member("username_text", config.USERNAME_TEXT)
+      .member("service_password_text", config.SERVICE_PASSWORD_TEXT)
+      .member("show_input", config.SHOW_INPUT_FIELD)
+      .member("show_login", config.SHOW_LOGIN_FIELDS)
+      .member("show_reset", config.SHOW_RESET_FIELD);
+  if (networks) {
+    json.key("network");
+    writeNetworks(json, *networks);
+  }
+  json.endObject();
+}
+
+/**
+ * @brief Writes the text injected for a page slot.
+ */
+void writeSlot(const WiFiProvisioner::Config &config, const wifiprov::NetworkList *networks,
+               PageSlot slot, Print &out) {
+  switch (slot) {
+  case PageSlot::HTML_TITLE:
+    if (config.HTML_TITLE) out.print(config.HTML_TITLE);
+    return;
+  case PageSlot::THEME_COLOR:
+    if (config.THEME_COLOR) out.print(config.THEME_COLOR);
+    return;
+  case PageSlot::CONFIG:
+    writeConfigBlob(config, networks, out);
+    return;
+  case PageSlot::NONE:
+    return;
+  }
+}
+
+/**
+ * @brief Walks the portal page shell in order. Each static chunk from
+ * provision_html.h is passed to `chunk(const PageChunk &)` and each injected
+ * config value is written to `values` as it is generated, with no copy in
+ * between.
+ */
+template <typename ChunkFn>
+void renderPortalPage(const WiFiProvisioner::Config &config, const wifiprov::NetworkList *networks,
+                      ChunkFn &&chunk, Print &values) {
+  for (size_t i = 0; i < page_chunk_count; ++i) {
+    const PageChunk &part = page_chunks[i];
+    chunk(part);
+    writeSlot(config, networks, part.slot, values);
+  }
 }
 
 
 } // end anonymous namespace
 
 // --- Class Constructor and Destructor ---
-// --- (Unchanged) ---
 WiFiProvisioner::Config::Config(
     const char *apName, const char *htmlTitle, const char *themeColor,
     const char *svgLogo, const char *projectTitle, const char *projectSubTitle,
@@ -122,39 +480,44 @@ WiFiProvisioner::Config::Config(
       SHOW_LOGIN_FIELDS(showLoginFields) {}
 
 WiFiProvisioner::WiFiProvisioner(const Config &config)
-    : _config(config), _server(nullptr), _dnsServer(nullptr),
+    : _config(config), _http(nullptr),
       _apIP(192, 168, 4, 1), _netMsk(255, 255, 255, 0), _dnsPort(53),
       _serverPort(80), _wifiDelay(100), _wifiConnectionTimeout(10000), // Default 10 seconds
-      _serverLoopFlag(false) {}
+      _serverLoopFlag(false), _station(nullptr), _idle(nullptr), _connectPhase(ConnectPhase::Idle),
+      _connectReason(nullptr), _connectStart(0), _connectDoneTime(0),
+      _connectReported(false), _pending(), _apMoveTime(0), _apMoved(false), _scanTime(0), _scanGeneration(0),
+      _scanValid(false), _scanRunning(false), _pagePlain(nullptr), _pageGzip(nullptr), _pageKey(0), _storedJoinCount(0),
+      _storedJoinNext(0), _storedSkip(0), _storedScanPending(false), _joinFailures(nullptr) {}
 
 WiFiProvisioner::~WiFiProvisioner() {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "WiFiProvisioner destructor called.");
     releaseResources();
+    if (_joinFailures) {
+      vQueueDelete(_joinFailures);
+    }
 }
 
-// --- Public Methods (getConfig, releaseResources, startProvisioning, loop, callbacks) ---
-// --- (Unchanged) ---
+// --- Public Methods and the portal loop ---
 WiFiProvisioner::Config &WiFiProvisioner::getConfig() { return _config; }
 
 void WiFiProvisioner::releaseResources() {
   _serverLoopFlag = true; // Signal loop to stop if running
+  stopServiceTasks(); // Nothing may touch the servers past this point
 
   // Webserver
-  if (_server != nullptr) {
+  if (_http != nullptr) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Stopping web server...");
-    _server->stop();
-    delete _server;
-    _server = nullptr;
+    _http->end();
+    delete _http;
+    _http = nullptr;
      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Web server stopped and deleted.");
   }
 
   // DNS
-  if (_dnsServer != nullptr) {
+  if (_dns.running()) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Stopping DNS server...");
-    _dnsServer->stop();
-    delete _dnsServer;
-    _dnsServer = nullptr;
-     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "DNS server stopped and deleted.");
+    _dns.end();
+     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "DNS server stopped.");
   }
 
   // WiFi - Don't necessarily change mode here, depends on context
@@ -162,10 +525,193 @@ void WiFiProvisioner::releaseResources() {
   //   WiFi.mode(WIFI_STA);
   //   delay(_wifiDelay);
   // }
+  stopNetworkScan();
+  _networks.clear(_config.MAX_NETWORKS);
+  _scanValid = false;
+  releasePageCache();
+
+  // Station connect helper and idle waiter (unregister their event handlers)
+  delete _station;
+  _station = nullptr;
+  delete _idle;
+  _idle = nullptr;
+  _connectPhase = ConnectPhase::Idle;
+  cancelStoredJoins();
+  noteStoredJoinFailures();
+  _apMoved = false;
+  _pending.clear(); // Also wipes the passwords
    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Resources released.");
 }
 
-bool WiFiProvisioner::startProvisioning() {
+/**
+ * @brief Starts a background scan unless one is already running. Results
+ * are picked up by updateNetworkScan().
+ */
+void WiFiProvisioner::startNetworkScan() {
+  // Nor while a stored network is joined behind the portal: the scan
+  // would stall it. The queue rescans once it is done.
+  if (_scanRunning || (_connectPhase == ConnectPhase::Reconnecting && !_storedScanPending)) {
+    return;
+  }
+  // Async=true, ShowHidden=false
+  if (WiFi.scanNetworks(true, false) == WIFI_SCAN_FAILED) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "Failed to start network scan.");
+    // Back off for a full interval instead of retrying every loop
+    _scanTime = millis();
+    return;
+  }
+  _scanRunning = true;
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Network scan started.");
+}
+
+/**
+ * @brief Collects a finished background scan and starts the next one once
+ * the cached result is older than Config::SCAN_INTERVAL_MS (0 disables
+ * periodic rescans). Called from handle(), so at most one scan is in flight.
+ */
+void WiFiProvisioner::updateNetworkScan() {
+  if (_scanRunning) {
+    int16_t n = WiFi.scanComplete();
+    if (n == WIFI_SCAN_RUNNING) {
+      return;
+    }
+    _scanRunning = false;
+    if (n < 0) {
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "WiFi scan failed with code: %d", n);
+      _scanTime = millis();
+      if (_storedScanPending) {
+        queueStoredNetworks(0); // Only the unhinted fallback
+        nextStoredJoin();
+      }
+      return;
+    }
+
+    collectScanResults(_networks, n, _config.MAX_NETWORKS);
+    bool joinStored = _storedScanPending;
+    if (joinStored) {
+      queueStoredNetworks(n); // From the raw records, before they are freed
+    }
+    WiFi.scanDelete(); // Our copy is all we need
+    _scanTime = millis();
+    _scanValid = true;
+    _scanGeneration++;
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Network scan complete, %u networks listed.", (unsigned)_networks.size());
+    if (joinStored) {
+      nextStoredJoin();
+    }
+    return;
+  }
+
+  if (_config.SCAN_INTERVAL_MS > 0 && millis() - _scanTime >= _config.SCAN_INTERVAL_MS) {
+    startNetworkScan();
+  }
+}
+
+/**
+ * @brief Aborts a running scan, e.g. before the radio is needed to connect.
+ */
+void WiFiProvisioner::stopNetworkScan() {
+  if (!_scanRunning) {
+    return;
+  }
+  esp_wifi_scan_stop();
+  WiFi.scanDelete();
+  _scanRunning = false;
+  _scanTime = millis();
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Network scan stopped.");
+}
+
+void WiFiProvisioner::releasePageCache() {
+  // Each is freed once no response is sending it
+  if (_pagePlain) {
+    _pagePlain->release();
+    _pagePlain = nullptr;
+  }
+  if (_pageGzip) {
+    _pageGzip->release();
+    _pageGzip = nullptr;
+  }
+  _pageKey = 0;
+}
+
+/**
+ * @brief Renders the portal page once, as plain text and as gzip, so every
+ * response is sent from a stable buffer and never holds up other clients.
+ * The static chunks are already compressed at build time, so only the
+ * injected config values go through the compressor here. On allocation
+ * failure the cache stays empty and the page is streamed uncompressed.
+ */
+void WiFiProvisioner::buildPageCache() {
+  releasePageCache();
+  const wifiprov::NetworkList *networks = _scanValid ? &_networks : nullptr;
+
+  wifiprov::ByteCounter counter;
+  size_t textLength = 0;
+  size_t sizeHint = 0;
+  renderPortalPage(
+      _config, networks,
+      [&](const PageChunk &part) {
+        counter.write((const uint8_t *)part.text, part.textLength);
+        textLength += part.textLength;
+        sizeHint += part.deflatedLength;
+      },
+      counter);
+  size_t pageLength = counter.count();
+  sizeHint += (pageLength - textLength) / 2;
+
+  uint8_t *page = (uint8_t *)malloc(pageLength);
+  if (!page) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "No memory for the page cache, streaming the page.");
+    return;
+  }
+  wifiprov::BufferPrint plain(page, pageLength);
+  size_t valueStart[page_chunk_count];
+  size_t next = 0;
+  renderPortalPage(
+      _config, networks,
+      [&](const PageChunk &part) {
+        plain.write((const uint8_t *)part.text, part.textLength);
+        valueStart[next++] = plain.length();
+      },
+      plain);
+  _pagePlain = wifiprov::SharedBuffer::adopt(page, pageLength);
+  if (!_pagePlain) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "No memory for the page cache, streaming the page.");
+    return;
+  }
+  _pageKey = pageFingerprint(_config, _scanGeneration);
+
+  // Each injected value, the config blob above all, is compressed in one
+  // piece from the plain render rather than in JsonWriter's small writes
+  wifiprov::GzipWriter gzip;
+  if (gzip.begin(sizeHint + 32)) {
+    for (size_t i = 0; i < page_chunk_count; ++i) {
+      const PageChunk &part = page_chunks[i];
+      size_t valueEnd = i + 1 < page_chunk_count ? valueStart[i + 1] - page_chunks[i + 1].textLength
+                                                 : pageLength;
+      gzip.appendDeflated(part.deflated, part.deflatedLength,
+                          (const uint8_t *)part.text, part.textLength);
+      gzip.deflate(page + valueStart[i], valueEnd - valueStart[i]);
+    }
+    size_t gzipLength = 0;
+    uint8_t *data = gzip.finish(&gzipLength);
+    if (data) {
+      _pageGzip = wifiprov::SharedBuffer::adopt(data, gzipLength);
+    }
+  }
+
+  if (!_pageGzip) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "Page compression failed, serving uncompressed.");
+    return;
+  }
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Page cache built: %u bytes -> %u bytes gzip.", (unsigned)pageLength, (unsigned)_pageGzip->length());
+}
+
+/**
+ * @brief Brings up the soft AP, DNS and web server and returns; the portal
+ * then runs from handle().
+ */
+bool WiFiProvisioner::begin() {
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Starting provisioning process...");
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Disconnecting existing WiFi connection.");
   WiFi.disconnect(false, true); // Disconnect, don't erase credentials yet
@@ -173,8 +719,11 @@ bool WiFiProvisioner::startProvisioning() {
 
   releaseResources(); // Ensure clean state before starting
 
-  _server = new WebServer(_serverPort);
-  _dnsServer = new DNSServer();
+  if (_config.MULTI_CLIENT_HTTP) {
+    _http = new wifiprov::SocketHttpServer(_serverPort);
+  } else {
+    _http = new wifiprov::WebServerTransport(_serverPort);
+  }
 
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Setting WiFi mode to AP+STA.");
   if (!WiFi.mode(WIFI_AP_STA)) {
@@ -205,9 +754,9 @@ bool WiFiProvisioner::startProvisioning() {
 
 
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Starting DNS server...");
-  _dnsServer->setErrorReplyCode(DNSReplyCode::NoError);
-  // Start DNS server, mapping all domains ('*') to the AP's IP address
-  if (!_dnsServer->start(_dnsPort, "*", actualApIP)) {
+  // Start DNS server, mapping all domains to the AP's IP address apart
+  // from the overrides
+  if (!_dns.begin(_dnsPort, actualApIP)) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR,
                                "Failed to start DNS server.");
     releaseResources();
@@ -215,62 +764,420 @@ bool WiFiProvisioner::startProvisioning() {
   }
    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "DNS server started.");
 
+  // Scan now so the network list is ready by the time a phone loads the page
+  startNetworkScan();
+
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Setting up web server handlers.");
   // --- Define Server Routes ---
-  _server->on("/", HTTP_GET, [this]() { this->handleRootRequest(); });
-  _server->on("/configure", HTTP_POST, [this]() { this->handleConfigureRequest(); });
-  _server->on("/update", HTTP_GET, [this]() { this->handleUpdateRequest(); });
-  _server->on("/factoryreset", HTTP_POST, [this]() { this->handleResetRequest(); });
+  // Every request counts as activity, for a transport whose sockets the
+  // idle wait in startProvisioning() cannot watch. The service tasks do
+  // their own pacing, and _idle belongs to the application's task.
+  auto active = [this](std::function<void()> handler) -> std::function<void()> {
+    return [this, handler]() {
+      if (_idle && !_httpTask.running()) {
+        _idle->noteActivity();
+      }
+      handler();
+    };
+  };
+  // A route past the transport's table would silently fall through to the
+  // probe redirect
+  auto route = [this](const char *path, wifiprov::HttpMethod method, std::function<void()> handler) {
+    if (!_http->on(path, method, handler)) {
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "Route table full, '%s' will not be served.", path);
+    }
+  };
+  route("/", wifiprov::HttpMethod::Get, active([this]() { this->handleRootRequest(); }));
+  route("/configure", wifiprov::HttpMethod::Post, active([this]() { this->handleConfigureRequest(); }));
+  route("/update", wifiprov::HttpMethod::Get, active([this]() { this->handleUpdateRequest(); }));
+  route("/status", wifiprov::HttpMethod::Get, active([this]() { this->handleStatusRequest(); }));
+  route("/factoryreset", wifiprov::HttpMethod::Post, active([this]() { this->handleResetRequest(); }));
+
+  // --- Static Page Resources ---
+  for (size_t i = 0; i < portal_asset_count; ++i) {
+    const PortalAsset *asset = &portal_assets[i];
+    route(asset->path, wifiprov::HttpMethod::Get, active([this, asset]() { this->handleAssetRequest(*asset); }));
+  }
+  route("/logo.svg", wifiprov::HttpMethod::Get, active([this]() { this->handleLogoRequest(); }));
 
   // --- Captive Portal Routes ---
-  // Redirect common captive portal checks to the root page
-  _server->on("/generate_204", HTTP_GET, [this]() { this->handleRootRequest(); }); // Android
-  _server->on("/fwlink", HTTP_GET, [this]() { this->handleRootRequest(); }); // Microsoft
-  _server->on("/hotspot-detect.html", HTTP_GET, [this]() { this->handleRootRequest(); }); // Apple
-  _server->on("/success.html", HTTP_GET, [this]() { this->handleRootRequest(); }); // Some systems might request this after connection
-  _server->on("/ncsi.txt", HTTP_GET, [this]() { this->handleRootRequest(); }); // Microsoft NCSI
-  _server->on("/connecttest.txt", HTTP_GET, [this]() { this->handleRootRequest(); }); // Other system check
+  // OS connectivity checks get the smallest reply that raises the portal
+  // sheet; only the sheet itself loads the full page from "/"
+  for (const CaptiveProbe &probe : kCaptiveProbes) {
+    bool stub = probe.stub;
+    route(probe.path, wifiprov::HttpMethod::Get, active([this, stub]() { this->handleProbeRequest(stub); }));
+  }
+  route("/favicon.ico", wifiprov::HttpMethod::Get, active([this]() { this->handleFaviconRequest(); }));
 
   // --- Fallback Route ---
-  _server->onNotFound([this]() { this->handleRootRequest(); });
+  // Background traffic for other sites is pointed at the portal too
+  _http->onNotFound(active([this]() { this->handleProbeRequest(false); }));
 
-  _server->begin(); // Start the web server
+  const char *const collectedHeaders[] = {"Accept-Encoding", "If-None-Match"};
+  _http->collectHeaders(collectedHeaders, sizeof(collectedHeaders) / sizeof(collectedHeaders[0]));
+
+  buildPageCache();
+
+  if (!_http->begin()) { // Start the web server
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "Failed to start web server.");
+    releaseResources();
+    return false;
+  }
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
                              "Web server started. Access portal at http://%s/",
                              actualApIP.toString().c_str());
 
-  _serverLoopFlag = false; // Reset loop flag before starting the loop
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Entering server loop...");
-  loop(); // Enter the server loop (blocking until provisioning complete/failed)
+  _serverLoopFlag = false; // Cleared here, set once provisioning is complete
+
+  _idle = new wifiprov::IdleWaiter();
+  if (!_joinFailures) {
+    _joinFailures = xQueueCreate(wifiprov::CredentialStore::kCapacity, sizeof(_pending.ssid));
+  }
+
+  // Optionally service DNS and HTTP from their own tasks; without them the
+  // portal still runs from handle()
+  if (_config.SERVICE_TASKS && !startServiceTasks()) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "Falling back to servicing from handle().");
+  }
+  return true;
+}
+
+/**
+ * @brief Blocking form of begin() + handle(): serves the portal until
+ * provisioning completes.
+ */
+bool WiFiProvisioner::startProvisioning() {
+  if (!begin()) {
+    return false;
+  }
+  return runPortal();
+}
+
+/**
+ * @brief Boot-time entry point: joins the last stored network if it can,
+ * else serves the portal, with the stored networks tried behind it, until
+ * one of them joins or provisioning completes.
+ */
+bool WiFiProvisioner::autoConnect(unsigned long timeoutMs) {
+  wifiprov::StoredNetwork networks[wifiprov::CredentialStore::kCapacity];
+  size_t count = _credentials.load(networks);
+  if (count == 0) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "No stored network, starting the portal.");
+    return startProvisioning();
+  }
+
+  // Fast path: straight to where the last network was joined, no scan.
+  // When it is unlikely to work (no access point on record, or that
+  // network failed last boot), the portal comes up at once instead.
+  uint32_t skip = 0;
+  if (networks[0].channel != 0 && networks[0].failures == 0) {
+    wifiprov::ConnectHint hint;
+    memcpy(hint.bssid, networks[0].bssid, sizeof(hint.bssid));
+    hint.channel = networks[0].channel;
+    wifiprov::ConnectFailure failure = joinStoredNetwork(networks[0], hint, timeoutMs);
+    if (failure == wifiprov::ConnectFailure::None) {
+      memset(networks, 0, sizeof(networks));
+      return true;
+    }
+    _credentials.noteFailure(networks[0].ssid);
+    if (passwordRejected(failure)) {
+      skip = 1; // Not worth another try
+    }
+  }
+  memset(networks, 0, sizeof(networks));
+
+  // The portal comes up now. Its first scan shows which stored networks
+  // are in range, and handle() tries them behind it, best first.
+  if (!begin()) {
+    return false;
+  }
+  _storedSkip = skip;
+  _storedScanPending = true;
+  _connectPhase = ConnectPhase::Reconnecting;
+  return runPortal();
+}
+
+/**
+ * @brief One blocking join of a stored network, through `hint`. Ends early
+ * on a definitive failure such as a missing access point or a refused
+ * password.
+ */
+wifiprov::ConnectFailure WiFiProvisioner::joinStoredNetwork(const wifiprov::StoredNetwork &network,
+                                                            const wifiprov::ConnectHint &hint,
+                                                            unsigned long timeoutMs) {
+  unsigned long start = millis();
+  wifiprov::ConnectFailure failure = connect(network.ssid, network.password, &hint);
+  if (failure == wifiprov::ConnectFailure::None) {
+    _station->wait(timeoutMs);
+    _station->end();
+    failure = _station->failure();
+  }
+  if (failure != wifiprov::ConnectFailure::None) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "Stored network '%s' not joined after %lums: %s",
+                               network.ssid, millis() - start, wifiprov::connectFailureName(failure));
+    return failure;
+  }
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Joined stored network '%s' in %lums.",
+                             network.ssid, millis() - start);
+  rememberNetwork(network.ssid, network.password);
+  return failure;
+}
+
+static_assert(wifiprov::CredentialStore::kCapacity <= 32, "_storedSkip holds one bit per stored network");
+
+/**
+ * @brief Queues the stored networks the portal's scan (`n` access points)
+ * saw, best first, each through the access point it was seen on. The most
+ * recent network not skipped goes last, without a hint, if the scan did
+ * not show it: it may be hidden or only slow to appear.
+ */
+void WiFiProvisioner::queueStoredNetworks(int n) {
+  wifiprov::StoredNetwork networks[wifiprov::CredentialStore::kCapacity];
+  size_t count = _credentials.load(networks);
+  StoredCandidate candidates[wifiprov::CredentialStore::kCapacity];
+  size_t found = matchStoredNetworks(networks, count, _storedSkip, n, candidates);
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "%u of %u stored networks in range.",
+                             (unsigned)found, (unsigned)count);
+
+  size_t fallback = 0;
+  while (fallback < count && (_storedSkip & (1u << fallback))) {
+    ++fallback;
+  }
+  _storedJoinCount = _storedJoinNext = 0;
+  for (size_t c = 0; c < found; ++c) {
+    StoredJoin &join = _storedJoins[_storedJoinCount++];
+    join.index = candidates[c].index;
+    join.channel = candidates[c].hint.channel;
+    memcpy(join.bssid, candidates[c].hint.bssid, sizeof(join.bssid));
+    if (candidates[c].index == fallback) {
+      fallback = count;
+    }
+  }
+  if (fallback < count) {
+    StoredJoin &join = _storedJoins[_storedJoinCount++];
+    join.index = fallback;
+    join.channel = 0;
+  }
+  _storedScanPending = false;
+  memset(networks, 0, sizeof(networks));
+}
+
+/**
+ * @brief Starts the next queued stored network as the Reconnecting attempt.
+ * False, with the phase back at Idle, once the queue is empty.
+ */
+bool WiFiProvisioner::nextStoredJoin() {
+  _storedScanPending = false;
+  while (_storedJoinNext < _storedJoinCount) {
+    const StoredJoin &join = _storedJoins[_storedJoinNext++];
+    if (_storedSkip & (1u << join.index)) {
+      continue;
+    }
+    wifiprov::ConnectHint hint;
+    memcpy(hint.bssid, join.bssid, sizeof(hint.bssid));
+    hint.channel = join.channel;
+    wifiprov::StoredNetwork networks[wifiprov::CredentialStore::kCapacity];
+    size_t count = _credentials.load(networks);
+    bool started = false;
+    if (join.index < count) {
+      // A form submitted meanwhile takes over from this attempt
+      _pending.clear();
+      strcpy(_pending.ssid, networks[join.index].ssid);
+      strcpy(_pending.password, networks[join.index].password);
+      if (_pending.password[0]) {
+        _pending.present = wifiprov::ProvisionRequest::kPassword;
+      }
+      started = connect(_pending.ssid, _pending.password, join.channel ? &hint : nullptr) ==
+                wifiprov::ConnectFailure::None;
+    }
+    memset(networks, 0, sizeof(networks));
+    if (started) {
+      _connectPhase = ConnectPhase::Reconnecting;
+      _connectStart = millis();
+      return true;
+    }
+  }
+  cancelStoredJoins();
+  _connectPhase = ConnectPhase::Idle;
+  _pending.clear();
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "No stored network joined, waiting for the portal.");
+  return false;
+}
+
+void WiFiProvisioner::cancelStoredJoins() {
+  _storedJoinCount = _storedJoinNext = 0;
+  _storedScanPending = false;
+}
 
-  // --- After loop() exits ---
+/**
+ * @brief Counts the stored joins that failed behind the portal. Runs on
+ * the application's task, which does all the writes to the store.
+ */
+void WiFiProvisioner::noteStoredJoinFailures() {
+  char ssid[sizeof(_pending.ssid)];
+  while (_joinFailures && xQueueReceive(_joinFailures, ssid, 0) == pdTRUE) {
+    _credentials.noteFailure(ssid);
+  }
+}
+
+/**
+ * @brief Serves a portal brought up by begin() until it shuts down. True if
+ * the station is connected by then.
+ */
+bool WiFiProvisioner::runPortal() {
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Entering server loop...");
+  unsigned long statsStart = millis();
+  uint32_t statsQueries = _dns.queries();
+  while (isActive()) {
+    handle();
+     yield(); // IMPORTANT: Allow ESP32 background tasks (like WiFi) to run
+    if (!_idle) {
+      break; // Portal shut down during handle()
+    }
+    // Sleep until a DNS query or HTTP traffic arrives, or MAX_IDLE_MS
+    // passes; with MAX_IDLE_MS == 0 this is the old fixed 1 ms poll. The
+    // service tasks do their own polling.
+    bool tasks = _dnsTask.running() || _httpTask.running();
+    if (!tasks) {
+      _idle->watchRead(_dns.fd());
+      _http->watchSockets(*_idle);
+    }
+    _idle->wait(tasks ? 10 : _config.MAX_IDLE_MS);
+
+    unsigned long now = millis();
+    if (now - statsStart >= kWakeupStatsInterval) {
+      uint32_t queries = _dns.queries();
+      uint32_t socketWakeups;
+      uint32_t wakeups = _idle->takeWakeups(&socketWakeups);
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG,
+                                 "Server loop: %lu wakeups/s (%lu by a socket), %lu DNS queries/s.",
+                                 (unsigned long)wakeups * 1000 / (now - statsStart),
+                                 (unsigned long)socketWakeups * 1000 / (now - statsStart),
+                                 (unsigned long)(queries - statsQueries) * 1000 / (now - statsStart));
+      statsStart = now;
+      statsQueries = queries;
+    }
+  }
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Exited server loop. Provisioning process finished.");
-  // At this point, releaseResources() should have been called by loop() or handleConfigureRequest()
-  
+
   // Return true only if the final WiFi status is connected
   bool connected = (WiFi.status() == WL_CONNECTED);
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "startProvisioning returning: %s", connected ? "true (connected)" : "false (not connected)");
   return connected;
 }
 
+/**
+ * @brief Does one pass of portal work without blocking: DNS, HTTP, the
+ * background scan and any connect attempt. Shuts the portal down once
+ * provisioning has completed.
+ */
+void WiFiProvisioner::handle() {
+  if (!isActive()) {
+    return;
+  }
 
-void WiFiProvisioner::loop() {
+  if (_dnsTask.running() || _httpTask.running()) {
+    // The service tasks do the work; only the shutdown happens here, after
+    // they have stopped touching the portal state
+    if (_serverLoopFlag) {
+      stopServiceTasks();
+    }
+  } else {
     // WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Server loop tick..."); // Too noisy
-  while (!_serverLoopFlag) {
     // DNS requests are typically for captive portal redirection
-    if (_dnsServer) {
-      _dnsServer->processNextRequest();
+    _dns.processPending();
+    servePortal();
+
+    // Keep polling at full rate while a connect attempt is moving
+    if (_idle && _connectPhase != ConnectPhase::Idle && _connectPhase != ConnectPhase::Failed) {
+      _idle->noteActivity();
     }
+  }
 
-    // Handle incoming HTTP client requests
-    if (_server) {
-      _server->handleClient();
+  noteStoredJoinFailures();
+
+  // With the service tasks, the flag may have been set since they were
+  // checked; they are stopped on the next pass
+  if (_serverLoopFlag && !_dnsTask.running() && !_httpTask.running()) {
+    if (_connectPhase == ConnectPhase::Done) {
+      using wifiprov::ProvisionRequest;
+      rememberNetwork(_pending.ssid, _pending.password);
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Provisioning fully successful, calling onSuccess callback.");
+      if (onSuccessCallback) {
+        onSuccessCallback(_pending.ssid,
+                          _pending.optional(_pending.password, ProvisionRequest::kPassword),
+                          _pending.optional(_pending.code, ProvisionRequest::kCode),
+                          _pending.optional(_pending.username, ProvisionRequest::kUsername),
+                          _pending.optional(_pending.servicePassword, ProvisionRequest::kServicePassword));
+      }
+    } else {
+      // Joined the stored network behind the portal; nothing was provisioned
+      rememberNetwork(_pending.ssid, _pending.password);
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Stored network joined, closing the portal.");
     }
-     yield(); // IMPORTANT: Allow ESP32 background tasks (like WiFi) to run
-     delay(1); // Small delay to prevent tight loop hogging CPU
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Provisioning complete, shutting the portal down.");
+    end();
+  }
+}
+
+/**
+ * @brief HTTP side of a portal pass: requests, then the background scan and
+ * connect attempt those requests drive. Runs on the HTTP task if enabled.
+ */
+void WiFiProvisioner::servePortal() {
+  // Handle incoming HTTP client requests
+  _http->poll();
+
+  updateNetworkScan();
+  updateConnectAttempt();
+}
+
+/**
+ * @brief Moves DNS and HTTP servicing to their own tasks, per Config.
+ */
+bool WiFiProvisioner::startServiceTasks() {
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Starting DNS and HTTP service tasks.");
+  if (!_dnsTask.start("wifiprov-dns", _config.DNS_TASK_STACK, _config.DNS_TASK_PRIORITY,
+                      _config.DNS_TASK_CORE, 1, [this]() { _dns.processPending(); })) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "Failed to start DNS task.");
+    return false;
   }
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Server loop finished (_serverLoopFlag is true).");
-  // Don't call releaseResources here, it's called by the function that sets the flag
+  if (!_httpTask.start("wifiprov-http", _config.HTTP_TASK_STACK, _config.HTTP_TASK_PRIORITY,
+                       _config.HTTP_TASK_CORE, 1, [this]() { servePortal(); })) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "Failed to start HTTP task.");
+    _dnsTask.stop();
+    return false;
+  }
+  return true;
+}
+
+void WiFiProvisioner::stopServiceTasks() {
+  _httpTask.stop();
+  _dnsTask.stop();
+}
+
+bool WiFiProvisioner::isActive() const { return _http != nullptr; }
+
+/**
+ * @brief Stops the portal and its soft AP. The station connection, if any,
+ * is kept.
+ */
+void WiFiProvisioner::end() {
+  if (!isActive()) {
+    return;
+  }
+  releaseResources();
+  if (WiFi.getMode() == WIFI_AP_STA) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Switching WiFi mode to STA.");
+    WiFi.mode(WIFI_STA);
+  }
+}
+
+WiFiProvisioner &WiFiProvisioner::addDnsOverride(const char *domain, IPAddress address) {
+  if (!_dns.addOverride(domain, address)) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "DNS override for '%s' not added.", domain ? domain : "NULL");
+  }
+  return *this;
 }
 
 WiFiProvisioner &WiFiProvisioner::onProvision(ProvisionCallback callback) {
@@ -301,6 +1208,12 @@ WiFiProvisioner &WiFiProvisioner::onSuccess(SuccessCallback callback) {
 // --- Private Request Handlers ---
 
 void WiFiProvisioner::handleRootRequest() {
+  // "/" on some other host is an app or probe that went through our DNS
+  String host = _http->hostHeader();
+  if (host.length() > 0 && !hostIs(host.c_str(), _apIP.toString().c_str())) {
+    handleProbeRequest(false);
+    return;
+  }
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Handling root request '/'.");
 
   // Call the onProvision callback if it's set
@@ -309,166 +1222,233 @@ void WiFiProvisioner::handleRootRequest() {
     provisionCallback();
   }
 
-  // Get configuration values as C-strings for JS injection
-  const char *showResetFieldStr = _config.SHOW_RESET_FIELD ? "true" : "false";
-  const char *showLoginFieldsStr = _config.SHOW_LOGIN_FIELDS ? "true" : "false";
-  const char *showInputFieldStr = _config.SHOW_INPUT_FIELD ? "true" : "false"; // Added this
-
-  char inputLengthStr[12];
-  snprintf(inputLengthStr, sizeof(inputLengthStr), "%d", _config.INPUT_LENGTH);
+  // onProvision may have changed the config, or a newer scan is available;
+  // re-render if so
+  uint32_t fingerprint = pageFingerprint(_config, _scanGeneration);
+  if (fingerprint != _pageKey) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Config or scan changed, rebuilding page cache.");
+    buildPageCache();
+  }
 
   // Get client
-  WiFiClient client = _server->client();
-  if (!client) {
+  Print *response = _http->beginResponse();
+  if (!response) {
        WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "No client available for root request.");
        return;
   }
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Client connected for root request.");
+  Print &out = *response;
+
+  bool sendGzip = _pageGzip && acceptsGzip(_http->header("Accept-Encoding").c_str());
+
+  // Strong validator: static page version + config values + scan, per encoding
+  char etag[32];
+  snprintf(etag, sizeof(etag), "\"%08x-%08x%s\"", (unsigned)page_static_hash,
+           (unsigned)fingerprint, sendGzip ? "-gz" : "");
+  // Let the browser keep the page but check back with us on every load
+  const char *cacheControl = "no-cache";
+
+  if (etagMatches(_http->header("If-None-Match").c_str(), etag)) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "ETag %s matches, sending 304.", etag);
+    sendStandardHeaders(*_http, out, 304, nullptr, cacheControl);
+    out.print("ETag: "); out.println(etag);
+    out.println("Vary: Accept-Encoding");
+    out.println(); // End of headers, no body
+    finishResponse(*_http, "Root 304");
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Root request handled, not modified.");
+    return;
+  }
 
-  // --- Send Headers ---
-   sendStandardHeaders(client, 200, "text/html");
-   client.println(); // End of headers
+  if (sendGzip) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Sending cached gzip page (%u bytes).", (unsigned)_pageGzip->length());
+    sendStandardHeaders(*_http, out, 200, "text/html", cacheControl);
+    out.print("ETag: "); out.println(etag);
+    out.println("Content-Encoding: gzip");
+    out.println("Vary: Accept-Encoding");
+    out.print("Content-Length: "); out.println((unsigned)_pageGzip->length());
+    out.println(); // End of headers
+    // Pinned, so a rebuild while this is still being sent cannot free it
+    _http->sendStable(_pageGzip->data(), _pageGzip->length(), _pageGzip);
+    finishResponse(*_http, "Root gzip");
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Root request handled, response sent.");
+    return;
+  }
 
+  if (_pagePlain) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Sending cached page (%u bytes).", (unsigned)_pagePlain->length());
+    sendStandardHeaders(*_http, out, 200, "text/html", cacheControl);
+    out.print("ETag: "); out.println(etag);
+    out.println("Vary: Accept-Encoding");
+    out.print("Content-Length: "); out.println((unsigned)_pagePlain->length());
+    out.println(); // End of headers
+    // Sent from the buffer as the socket takes it, between other clients
+    _http->sendStable(_pagePlain->data(), _pagePlain->length(), _pagePlain);
+    finishResponse(*_http, "Root");
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Root request handled, response sent.");
+    return;
+  }
+
+  // --- Send Headers ---
+  // No memory for the cache: the page is streamed, and a slot that outgrows
+  // its buffer is flushed while this handler runs
+   sendStandardHeaders(*_http, out, 200, "text/html", cacheControl);
+   out.print("ETag: "); out.println(etag);
+   out.println("Vary: Accept-Encoding");
+   // Measured first, so the connection can stay open after the page
+   wifiprov::ByteCounter pageLength;
+   renderPortalPage(
+       _config, _scanValid ? &_networks : nullptr,
+       [&pageLength](const PageChunk &part) {
+         pageLength.write((const uint8_t *)part.text, part.textLength);
+       },
+       pageLength);
+   out.print("Content-Length: "); out.println((unsigned)pageLength.count());
+   out.println(); // End of headers
 
   // --- Send HTML Body ---
-  // Send fixed parts and inject dynamic config values
+  // Stream the parts, with the config values written straight into the
+  // response
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Sending HTML body parts...");
-  client.write_P(index_html1, strlen_P(index_html1));            // Before Title
-  client.print(_config.HTML_TITLE);                             // Title
-  client.write_P(index_html2, strlen_P(index_html2));            // Before Theme Color
-  client.print(_config.THEME_COLOR);                            // Theme Color
-  client.write_P(index_html3, strlen_P(index_html3));            // Before Logo
-  client.print(_config.SVG_LOGO);                               // Logo SVG
-  client.write_P(index_html4, strlen_P(index_html4));            // Before Project Title (and includes up to end of <div class="header">)
-  client.print(_config.PROJECT_TITLE);                          // Project Title
-  //client.write_P(index_html5, strlen_P(index_html5));            // Before Project Subtitle
-  //client.print(_config.PROJECT_SUB_TITLE);                      // Project Subtitle
-  //client.write_P(index_html6, strlen_P(index_html6));            // Before Project Info
-  //client.print(_config.PROJECT_INFO);                           // Project Info
-  //client.write_P(index_html7, strlen_P(index_html7));            // HTML up to Device Key Input Block (end of hiddenPassword block)
-
-  client.write_P(index_html8, strlen_P(index_html8));            // Device Key Input Block HTML
-
-  client.write_P(index_html9_username_block, strlen_P(index_html9_username_block)); // Username block HTML
-  client.write_P(index_html9_service_password_block, strlen_P(index_html9_service_password_block)); // Service password block HTML
-  client.write_P(index_html9_part2, strlen_P(index_html9_part2)); // Submit button, start of footer
-
-
-  // --- Inject JS Constants Correctly within the <script> tag ---
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Injecting JavaScript constants...");
-  // Start of script and first constant definition
-  client.write_P(js_const_part1, strlen_P(js_const_part1));   // `const title_logo = \``
-  client.print(_config.SVG_LOGO);                             // Inject logo SVG (duplicate needed for JS)
-  client.write_P(js_const_part1a, strlen_P(js_const_part1a)); // `\`; const title_text = \``
-  client.print(_config.PROJECT_TITLE);                        // Inject project title
-  client.write_P(js_const_part1b, strlen_P(js_const_part1b)); // `\`; const title_sub = \``
-  client.print(_config.PROJECT_SUB_TITLE);                    // Inject subtitle
-  client.write_P(js_const_part1c, strlen_P(js_const_part1c)); // `\`; const title_info = \``
-  client.print(_config.PROJECT_INFO);                         // Inject info text
-
-  client.write_P(js_const_part1d, strlen_P(js_const_part1d)); // `\`; const input_name_text = \``
-  client.print(_config.INPUT_TEXT);                           // Prints Device Key label
-  client.write_P(js_const_part2, strlen_P(js_const_part2));   // `\`; const input_lenght = `
-  client.print(inputLengthStr);                               // Prints length for Device Key
-  client.write_P(js_const_part3, strlen_P(js_const_part3));   // `; const connection_successful_text = \``
-  client.print(_config.CONNECTION_SUCCESSFUL);                // Prints success message
-  client.write_P(js_const_part4, strlen_P(js_const_part4));   // `\`; const footer_text = \``
-  client.print(_config.FOOTER_TEXT);                          // Prints footer
-  client.write_P(js_const_part5, strlen_P(js_const_part5));   // `\`; const reset_confirmation_text = \``
-  client.print(_config.RESET_CONFIRMATION_TEXT);              // Prints reset confirm text
-  client.write_P(js_const_part6, strlen_P(js_const_part6));   // `\`; const username_text = \``
-  client.print(_config.USERNAME_TEXT);                        // Prints Username label
-  client.write_P(js_const_part7, strlen_P(js_const_part7));   // `\`; const service_password_text = \``
-  client.print(_config.SERVICE_PASSWORD_TEXT);                // Prints Service Password label
-  client.write_P(js_const_part8, strlen_P(js_const_part8));   // `\`; const show_input_field = `
-  client.print(showInputFieldStr);                            // Prints "true" or "false" for device key field visibility
-  client.write_P(js_const_part8a, strlen_P(js_const_part8a)); // `; const show_login_fields = `
-  client.print(showLoginFieldsStr);                           // Prints "true" or "false" for login fields visibility
-  client.write_P(js_const_part9, strlen_P(js_const_part9));   // `; const reset_show = `
-  client.print(showResetFieldStr);                            // Prints "true" or "false" for reset link visibility
-
-  // --- Send Remainder of HTML (rest of <script> and </html>) ---
-  client.write_P(index_html13, strlen_P(index_html13)); // Includes closing semicolon for reset_show and rest of JS/HTML
-
-  // Connection: close header handles closing
-  client.stop();
+  renderPortalPage(
+      _config, _scanValid ? &_networks : nullptr,
+      [&out](const PageChunk &part) {
+        out.write((const uint8_t *)part.text, part.textLength);
+      },
+      out);
+
+  finishResponse(*_http, "Root");
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Root request handled, response sent.");
 }
 
 
-// --- handleUpdateRequest (Added favicon handler) ---
-void WiFiProvisioner::handleUpdateRequest() {
-   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Handling update request '/update'.");
-  JsonDocument doc; // Use StaticJsonDocument if possible for fixed size
-
-  // Determine which fields to show based on config
-  doc["show_code"] = _config.SHOW_INPUT_FIELD;
-  doc["show_login"] = _config.SHOW_LOGIN_FIELDS;
-  
-  // Perform network scan and populate the document
-  networkScan(doc);
-
-  WiFiClient client = _server->client();
-   if (!client) {
-       WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "No client available for update request.");
-       return;
+/**
+ * @brief Sends a body that is fully in memory, answering a matching
+ * If-None-Match with 304 instead.
+ */
+void WiFiProvisioner::sendStaticResponse(const char *contentType, const char *etag,
+                                         const char *cacheControl, const uint8_t *body,
+                                         size_t length, bool gzip) {
+  Print *response = _http->beginResponse();
+  if (!response) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "No client available for %s.", _http->uri().c_str());
+    return;
   }
-   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Client connected for update request.");
-  
-  // Calculate JSON length (important for Content-Length header)
-  size_t jsonLength = measureJson(doc);
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "JSON response length: %d", jsonLength);
 
-  // Send headers and JSON payload
-  sendStandardHeaders(client, 200, "application/json");
-  client.print("Content-Length: "); client.println(jsonLength); // Add Content-Length
-  client.println(); // End headers
-  serializeJson(doc, client);
+  Print &out = *response;
+  bool notModified = etagMatches(_http->header("If-None-Match").c_str(), etag);
+  sendStandardHeaders(*_http, out, notModified ? 304 : 200, notModified ? nullptr : contentType, cacheControl);
+  out.print("ETag: "); out.println(etag);
+  out.println("Vary: Accept-Encoding");
+  if (!notModified) {
+    if (gzip) {
+      out.println("Content-Encoding: gzip");
+    }
+    out.print("Content-Length: "); out.println((unsigned)length);
+  }
+  out.println(); // End of headers
+  if (!notModified) {
+    _http->sendStable(body, length); // Flash, or the configured logo
+  }
+  finishResponse(*_http, _http->uri().c_str());
+}
 
-  client.stop(); // Close connection
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Update request handled, response sent.");
+void WiFiProvisioner::handleAssetRequest(const PortalAsset &asset) {
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Handling asset request '%s'.", asset.path);
+  bool sendGzip = acceptsGzip(_http->header("Accept-Encoding").c_str());
+
+  char etag[24];
+  snprintf(etag, sizeof(etag), "\"%s%s\"", asset.version, sendGzip ? "-gz" : "");
+  // Only the URL the current page links to may be cached for good
+  bool current = strcmp(_http->arg("v").c_str(), asset.version) == 0;
+
+  if (sendGzip) {
+    sendStaticResponse(asset.contentType, etag, current ? kImmutableCacheControl : "no-cache",
+                       asset.gzip, asset.gzipLength, true);
+  } else {
+    sendStaticResponse(asset.contentType, etag, current ? kImmutableCacheControl : "no-cache",
+                       (const uint8_t *)asset.text, asset.textLength, false);
+  }
 }
 
+void WiFiProvisioner::handleLogoRequest() {
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Handling logo request '/logo.svg'.");
+  const char *logo = _config.SVG_LOGO ? _config.SVG_LOGO : "";
+
+  char version[9];
+  snprintf(version, sizeof(version), "%08x", (unsigned)hashString(logo));
+  char etag[12];
+  snprintf(etag, sizeof(etag), "\"%s\"", version);
+  bool current = strcmp(_http->arg("v").c_str(), version) == 0;
 
+  sendStaticResponse("image/svg+xml", etag, current ? kImmutableCacheControl : "no-cache",
+                     (const uint8_t *)logo, strlen(logo), false);
+}
+
+void WiFiProvisioner::handleUpdateRequest() {
+   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Handling update request '/update'.");
+  // A manual refresh asks for a new scan; the cached result is sent right
+  // away and the page polls again while "scanning" is set
+  if (_http->hasArg("refresh") && (!_scanValid || millis() - _scanTime >= kMinRescanInterval)) {
+    startNetworkScan();
+  }
+  // Fixed once, so both passes of the writer see the same age
+  unsigned long age = (millis() - _scanTime) / 1000; // seconds
+
+  sendJsonResponse(*_http, 200, "Update", [&](wifiprov::JsonWriter &json) {
+    json.beginObject()
+        // Determine which fields to show based on config
+        .member("show_code", _config.SHOW_INPUT_FIELD)
+        .member("show_login", _config.SHOW_LOGIN_FIELDS)
+        .key("network");
+    if (_scanValid) {
+      writeNetworks(json, _networks);
+      json.member("age", age);
+    } else {
+      json.beginArray().endArray();
+    }
+    json.member("scanning", _scanRunning).endObject();
+  });
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Update request handled, response sent.");
+}
 
-// --- handleConfigureRequest (Remains largely the same, added logging) ---
 void WiFiProvisioner::handleConfigureRequest() {
    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Handling configure request '/configure'.");
-  if (!_server->hasArg("plain")) {
+  size_t bodyLength = 0;
+  const char *body = _http->body(&bodyLength);
+  if (!body) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
-                               "Configure request missing 'plain' argument (body).");
+                               "Configure request has no body.");
     sendBadRequestResponse();
     return;
   }
 
-  String requestBody = _server->arg("plain");
-   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Request body: %s", requestBody.c_str());
-
-  JsonDocument doc; // Use StaticJsonDocument if size is predictable
-  auto error = deserializeJson(doc, requestBody);
-  if (error) {
+  // Decoded straight from the request buffer into fixed fields; oversized
+  // values are refused at the first byte that does not fit
+  wifiprov::ProvisionRequest request;
+  wifiprov::ProvisionRequestParser parser(request, _config.INPUT_LENGTH > 0 ? _config.INPUT_LENGTH : 0);
+  if (!parser.feed(body, bodyLength) || !parser.finish()) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
-                               "JSON parsing failed: %s", error.c_str());
+                               "Configure request rejected: %s", parser.error());
     sendBadRequestResponse();
     return;
   }
 
-  // Extract data from JSON
-  const char *ssid_connect = doc["ssid"];
-  const char *pass_connect = doc["password"]; // Might be null
-  const char *input_connect = doc["code"];     // Might be null
-  const char *username_connect = doc["username"]; // Might be null
-  const char *service_pass_connect = doc["service_password"]; // Might be null
+  using wifiprov::ProvisionRequest;
+  const char *ssid_connect = request.ssid;
+  const char *pass_connect = request.optional(request.password, ProvisionRequest::kPassword);
+  const char *input_connect = request.optional(request.code, ProvisionRequest::kCode);
+  const char *username_connect = request.optional(request.username, ProvisionRequest::kUsername);
+  const char *service_pass_connect = request.optional(request.servicePassword, ProvisionRequest::kServicePassword);
 
   // Log received data, masking passwords if desired
   WIFI_PROVISIONER_DEBUG_LOG(
       WIFI_PROVISIONER_LOG_INFO, "Received config - SSID: '%s', Pass: '%s', Code: '%s', User: '%s', SrvPass: '%s'",
-      ssid_connect ? ssid_connect : "NULL", pass_connect ? "***" : "NULL", // Mask password
+      ssid_connect, pass_connect ? "***" : "NULL", // Mask password
       input_connect ? input_connect : "NULL", username_connect ? username_connect : "NULL",
       service_pass_connect ? "***" : "NULL"); // Mask password
 
   // --- Basic Validation ---
-  if (!ssid_connect || strlen(ssid_connect) == 0) {
+  if (strlen(ssid_connect) == 0) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
                                "SSID missing or empty in configure request.");
     sendBadRequestResponse(); // Send 400 Bad Request
@@ -476,73 +1456,185 @@ void WiFiProvisioner::handleConfigureRequest() {
   }
 
   // --- Connection Logic ---
+  // One attempt at a time; a double submit or a second client is told
+  // what is already going on
+  if (_connectPhase != ConnectPhase::Idle && _connectPhase != ConnectPhase::Failed &&
+      _connectPhase != ConnectPhase::Reconnecting) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "Configure request while a connect attempt is active.");
+    sendConnectStatus(409, "Configure");
+    return;
+  }
+
+  // A form takes over from any stored networks still queued
+  cancelStoredJoins();
+
+  // Kept for the input check and onSuccess, which run from handle()
+  _pending = request;
+
    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Disconnecting existing WiFi connection before attempting new one.");
   WiFi.disconnect(false, true); // Disconnect, keep AP mode, don't erase SDK creds yet
   delay(_wifiDelay);
 
-  if (!connect(ssid_connect, pass_connect)) { // connect() handles logging internally
-    handleUnsuccessfulConnection("ssid"); // Send failure response {success: false, reason: "ssid"}
-    // Keep server running to allow user retry
-    return;
+  // connect() handles logging internally
+  const char *password = _pending.optional(_pending.password, ProvisionRequest::kPassword);
+  wifiprov::ConnectHint hint;
+  bool hinted = findConnectHint(_pending.ssid, password, hint);
+  wifiprov::ConnectFailure failure = connect(_pending.ssid, password, hinted ? &hint : nullptr);
+  _connectReported = false;
+  if (failure != wifiprov::ConnectFailure::None) {
+    _connectPhase = ConnectPhase::Failed;
+    _connectReason = wifiprov::connectFailureName(failure);
+  } else {
+    _connectPhase = ConnectPhase::Associating;
+    _connectStart = millis();
   }
 
-   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "WiFi connection successful to SSID: %s", ssid_connect);
+  // Answer right away; handle() drives the attempt and the page follows it
+  // on /status
+  sendConnectStatus(202, "Configure");
+}
 
-  // --- Input Validation (if applicable) ---
-  if (_config.SHOW_INPUT_FIELD && inputCheckCallback) {
-     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Performing input check for code: %s", input_connect ? input_connect : "NULL");
-      // Pass empty string "" if input_connect is NULL or points to an empty string
-      if (!inputCheckCallback(input_connect ? input_connect : "")) {
-         WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
-                                   "Input check callback failed for device key.");
-          handleUnsuccessfulConnection("code"); // Send {success: false, reason: "code"}
-          WiFi.disconnect(false, true); // Disconnect WiFi if check fails
-          // Keep server running
-          return;
+/**
+ * @brief Advances a connect attempt started by /configure. Called from
+ * handle(), so the server keeps serving while the station associates.
+ */
+void WiFiProvisioner::updateConnectAttempt() {
+  switch (_connectPhase) {
+  case ConnectPhase::Associating:
+  case ConnectPhase::Dhcp: {
+    bool settled = _station->wait(0);
+    if (!settled && millis() - _connectStart < _wifiConnectionTimeout) {
+      if (_connectPhase == ConnectPhase::Associating && _station->associated()) {
+        WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Associated, waiting for DHCP.");
+        _connectPhase = ConnectPhase::Dhcp;
       }
-      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Input check successful.");
-  } else {
-       WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Input check skipped (not required, field hidden, or no callback).");
+      return;
+    }
+    _station->end();
+
+    wifiprov::ConnectFailure failure = _station->failure();
+    if (failure == wifiprov::ConnectFailure::NoApFound && _station->hinted()) {
+      // The access point moved or is gone; let the driver look everywhere
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
+                                 "SSID '%s' not at its scanned access point, retrying with a full scan.",
+                                 _pending.ssid);
+      failure = connect(_pending.ssid,
+                        _pending.optional(_pending.password, wifiprov::ProvisionRequest::kPassword),
+                        nullptr);
+      if (failure == wifiprov::ConnectFailure::None) {
+        _connectPhase = ConnectPhase::Associating;
+        _connectStart = millis();
+        return;
+      }
+    }
+    if (failure != wifiprov::ConnectFailure::None) {
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR,
+                                 "WiFi connection to SSID '%s' failed after %lums: %s",
+                                 _pending.ssid, millis() - _connectStart,
+                                 wifiprov::connectFailureName(failure));
+      // The driver would keep retrying the SSID and stall the portal's
+      // scans; a resubmitted form starts a fresh attempt anyway
+      WiFi.disconnect();
+      _connectPhase = ConnectPhase::Failed;
+      _connectReason = wifiprov::connectFailureName(failure);
+      return;
+    }
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
+                               "Successfully connected to SSID: '%s' in %lums. IP Address: %s",
+                               _pending.ssid, millis() - _connectStart,
+                               WiFi.localIP().toString().c_str());
+    // The input check runs on the next pass, so /status can show it first
+    _connectPhase = ConnectPhase::Validating;
+    return;
   }
 
+  case ConnectPhase::Reconnecting: {
+    // Stored networks, tried behind the portal; the page is not told
+    if (_storedScanPending) {
+      return; // updateNetworkScan() starts the first one
+    }
+    if (!_station->wait(0) && millis() - _connectStart < _wifiConnectionTimeout) {
+      return;
+    }
+    _station->end();
+    wifiprov::ConnectFailure failure = _station->failure();
+    if (failure != wifiprov::ConnectFailure::None) {
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "Stored network '%s' not joined behind the portal: %s",
+                                 _pending.ssid, wifiprov::connectFailureName(failure));
+      // Counted by handle(); the store is written from the application's task
+      if (!_joinFailures || xQueueSend(_joinFailures, _pending.ssid, 0) != pdTRUE) {
+        WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "Failed join of '%s' not counted.", _pending.ssid);
+      }
+      if (passwordRejected(failure)) {
+        _storedSkip |= 1u << _storedJoins[_storedJoinNext - 1].index;
+      }
+      _pending.clear();
+      // The driver keeps retrying the SSID otherwise, and the next attempt
+      // or the scan stalls
+      WiFi.disconnect();
+      if (!nextStoredJoin()) {
+        startNetworkScan(); // The attempts stopped the portal's scan
+      }
+      return;
+    }
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
+                               "Joined stored network '%s' behind the portal in %lums.",
+                               _pending.ssid, millis() - _connectStart);
+    _serverLoopFlag = true; // handle() stores it and closes the portal
+    return;
+  }
 
-  // --- Optional Service Login Validation ---
-  // if (_config.SHOW_LOGIN_FIELDS && serviceLoginCheckCallback) {
-  //    if (!serviceLoginCheckCallback(username_connect ? username_connect : "", service_pass_connect ? service_pass_connect : "")) {
-  //       WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "Service login check callback failed.");
-  //       handleUnsuccessfulConnection("login"); // Send {success: false, reason: "login"}
-  //       WiFi.disconnect(false, true);
-  //       return;
-  //    }
-  //    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Service login check successful.");
-  // }
+  case ConnectPhase::Validating:
+    // --- Input Validation (if applicable) ---
+    if (_config.SHOW_INPUT_FIELD && inputCheckCallback) {
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Performing input check for code: %s", _pending.code);
+      if (!inputCheckCallback(_pending.code)) {
+        WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
+                                   "Input check callback failed for device key.");
+        WiFi.disconnect(false, true); // Disconnect WiFi if check fails
+        _connectPhase = ConnectPhase::Failed;
+        _connectReason = "code";
+        return;
+      }
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Input check successful.");
+    } else {
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Input check skipped (not required, field hidden, or no callback).");
+    }
+    _connectPhase = ConnectPhase::Done;
+    _connectDoneTime = millis();
+    return;
 
-  // --- Success ---
-  handleSuccesfulConnection(); // Send {success: true} response to client immediately
+  case ConnectPhase::Done:
+    // Keep serving until the page has seen the result
+    if (!_connectReported && millis() - _connectDoneTime < kConnectLinger) {
+      return;
+    }
+    // handle() runs onSuccess on the application's task and shuts down
+    if (!_serverLoopFlag) {
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Provisioning complete. Setting loop flag to stop server.");
+      _serverLoopFlag = true;
+    }
+    return;
 
-   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Provisioning fully successful, calling onSuccess callback.");
-  if (onSuccessCallback) {
-    onSuccessCallback(ssid_connect, pass_connect, input_connect,
-                      username_connect, service_pass_connect);
+  default:
+    return;
   }
-
-  // --- Stop Provisioning Process ---
-   // Short delay can sometimes help client process the {success:true} before server shuts down fully
-   delay(500);
-
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Provisioning complete. Setting loop flag to stop server.");
-  _serverLoopFlag = true; // Signal loop() to exit and release resources
 }
 
-
-bool WiFiProvisioner::connect(const char *ssid, const char *password) {
+/**
+ * @brief Starts a station connect attempt without waiting for it; the
+ * outcome arrives through _station and is picked up by updateConnectAttempt().
+ * With a `hint`, the network is joined through that access point directly.
+ */
+wifiprov::ConnectFailure WiFiProvisioner::connect(const char *ssid, const char *password,
+                                                  const wifiprov::ConnectHint *hint) {
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
                              "Attempting to connect to SSID: '%s'", ssid ? ssid : "NULL");
 
   if (!ssid || strlen(ssid) == 0) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR,
                                "connect() called with invalid SSID.");
-    return false;
+    return wifiprov::ConnectFailure::NoApFound;
   }
 
    // Ensure mode is STA or AP+STA. If only AP, switch to STA.
@@ -551,7 +1643,7 @@ bool WiFiProvisioner::connect(const char *ssid, const char *password) {
         WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Setting WiFi mode to WIFI_STA for connection attempt.");
         if (!WiFi.mode(WIFI_STA)) {
              WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "Failed to set WiFi mode to STA.");
-             return false;
+             return wifiprov::ConnectFailure::AssocFailed;
         }
         delay(_wifiDelay);
    } else {
@@ -559,135 +1651,216 @@ bool WiFiProvisioner::connect(const char *ssid, const char *password) {
    }
 
 
-  // Use WiFi.begin(ssid, password) which handles NULL or empty password correctly
-   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Calling WiFi.begin()...");
-   WiFi.begin(ssid, password ? password : ""); // Pass empty string if password is NULL
-
-  // Wait for connection with timeout
-  unsigned long startTime = millis();
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Waiting up to %dms for WiFi connection...", _wifiConnectionTimeout);
-  int lastStatus = -1; // Track status changes
-
-  while (WiFi.status() != WL_CONNECTED) {
-     int currentStatus = WiFi.status();
-     if(currentStatus != lastStatus) {
-         #ifdef WIFI_PROVISIONER_DEBUG // Only print status changes if debugging
-         const char* statusStr = "";
-         switch(currentStatus) {
-             case WL_NO_SHIELD: statusStr = "WL_NO_SHIELD"; break;
-             case WL_IDLE_STATUS: statusStr = "WL_IDLE_STATUS"; break;
-             case WL_NO_SSID_AVAIL: statusStr = "WL_NO_SSID_AVAIL"; break;
-             case WL_SCAN_COMPLETED: statusStr = "WL_SCAN_COMPLETED"; break;
-             case WL_CONNECTED: statusStr = "WL_CONNECTED"; break; // Should not print here, but include
-             case WL_CONNECT_FAILED: statusStr = "WL_CONNECT_FAILED"; break;
-             case WL_CONNECTION_LOST: statusStr = "WL_CONNECTION_LOST"; break;
-             case WL_DISCONNECTED: statusStr = "WL_DISCONNECTED"; break;
-             default: statusStr = "UNKNOWN"; break;
-         }
-         WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "WiFi Status: %d (%s)", currentStatus, statusStr);
-         #endif
-         lastStatus = currentStatus;
-     }
-
-     // Check for permanent failures
-     if (currentStatus == WL_NO_SSID_AVAIL || currentStatus == WL_CONNECT_FAILED) {
-         WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "WiFi connection failed permanently. Status: %d", currentStatus);
-         // Don't disconnect here, let the caller handle it based on failure reason
-         return false;
-     }
-
-    // Check timeout
-    if (millis() - startTime >= _wifiConnectionTimeout) {
-      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR,
-                                 "WiFi connection timeout reached for SSID: '%s'. Last Status: %d",
-                                 ssid, currentStatus);
-      // Don't disconnect here, let the caller handle it
+   // A background scan would hold the radio while we try to associate
+   stopNetworkScan();
+   if (!_station) {
+     _station = new wifiprov::StationConnector();
+   }
+   if (WiFi.getMode() == WIFI_AP_STA) {
+     // The radio has one channel; move the portal there first, on our terms
+     alignSoftApChannel(hint ? hint->channel : 0);
+   }
+   if (hint) {
+     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG,
+                                "Calling WiFi.begin() on channel %u, BSSID %02x:%02x:%02x:%02x:%02x:%02x...",
+                                hint->channel, hint->bssid[0], hint->bssid[1], hint->bssid[2],
+                                hint->bssid[3], hint->bssid[4], hint->bssid[5]);
+   } else {
+     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Calling WiFi.begin()...");
+   }
+   // Pass empty string if password is NULL
+   if (!_station->begin(ssid, password ? password : "", hint)) {
+     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "Failed to allocate connect event group.");
+     return wifiprov::ConnectFailure::Timeout;
+   }
+
+  return wifiprov::ConnectFailure::None;
+}
+
+
+/**
+ * @brief Readies the soft AP for a station connect. It moves to `channel`
+ * (0 = unknown, stay) with channel switch announcements, which stay on so
+ * a move the driver makes itself on association is announced too.
+ */
+void WiFiProvisioner::alignSoftApChannel(uint8_t channel) {
+  wifi_config_t config;
+  if (esp_wifi_get_config(WIFI_IF_AP, &config) != ESP_OK) {
+    return;
+  }
+  uint8_t from = config.ap.channel;
+  bool move = channel != 0 && channel != from;
+  if (!move && config.ap.csa_count == kApCsaCount) {
+    return;
+  }
+  config.ap.csa_count = kApCsaCount;
+  if (move) {
+    config.ap.channel = channel;
+  }
+  if (esp_wifi_set_config(WIFI_IF_AP, &config) != ESP_OK) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "Could not update the soft AP config.");
+    return;
+  }
+  if (move) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
+                               "Moved soft AP from channel %u to %u (%u station(s) on it).",
+                               from, channel, WiFi.softAPgetStationNum());
+    _apMoveTime = millis();
+    _apMoved = true;
+  }
+}
+
+/**
+ * @brief Where `ssid` was last seen: its strongest access point in the
+ * latest scan, else where the store or the driver's saved config last
+ * joined it.
+ */
+bool WiFiProvisioner::findConnectHint(const char *ssid, const char *password,
+                                      wifiprov::ConnectHint &hint) const {
+  const wifiprov::NetworkEntry *entry = _scanValid ? _networks.find(ssid) : nullptr;
+  if (entry) {
+    // Security that does not fit the password means a different network of
+    // that name, or a typo; either way the driver should look for itself
+    if (entry->secured != (password && password[0])) {
       return false;
     }
-     delay(500); // Check status roughly twice per second
-     yield(); // Allow background tasks
+    memcpy(hint.bssid, entry->bssid, sizeof(hint.bssid));
+    hint.channel = entry->channel;
+    return true;
+  }
+  wifiprov::StoredNetwork stored;
+  bool known = _credentials.find(ssid, stored) && stored.channel;
+  if (known) {
+    memcpy(hint.bssid, stored.bssid, sizeof(hint.bssid));
+    hint.channel = stored.channel;
   }
+  memset(&stored, 0, sizeof(stored));
+  return known || wifiprov::StationConnector::storedHint(ssid, hint);
+}
 
-  // Connected successfully
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
-                             "Successfully connected to SSID: '%s'. IP Address: %s", ssid, WiFi.localIP().toString().c_str());
-  return true;
+/**
+ * @brief Saves the network the station has just joined, with the access
+ * point it joined through, for autoConnect().
+ */
+void WiFiProvisioner::rememberNetwork(const char *ssid, const char *password) {
+  if (!_config.SAVE_CREDENTIALS) {
+    return;
+  }
+  // A WPA/WPA2-Personal network is stored by its PMK, derived once here on
+  // the application's task: later joins skip the driver's own PBKDF2 run
+  // and the passphrase is not kept. WPA3 (SAE) needs the passphrase itself.
+  char psk[wifiprov::kPskLength + 1];
+  wifi_ap_record_t ap;
+  if (password && !wifiprov::isPsk(password) && esp_wifi_sta_get_ap_info(&ap) == ESP_OK &&
+      (ap.authmode == WIFI_AUTH_WPA_PSK || ap.authmode == WIFI_AUTH_WPA2_PSK ||
+       ap.authmode == WIFI_AUTH_WPA_WPA2_PSK)) {
+    unsigned long start = millis();
+    uint8_t pmk[wifiprov::kPmkLength];
+    if (wifiprov::derivePmk(ssid, password, pmk)) {
+      wifiprov::formatPsk(pmk, psk);
+      password = psk;
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "PMK for '%s' derived in %lums.", ssid,
+                                 millis() - start);
+    }
+    memset(pmk, 0, sizeof(pmk));
+  }
+  if (!_credentials.save(ssid, password, WiFi.BSSID(), (uint8_t)WiFi.channel())) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "Could not store network '%s'.", ssid);
+  }
+  memset(psk, 0, sizeof(psk));
 }
 
+void WiFiProvisioner::forgetCredentials() { _credentials.clear(); }
+
+/**
+ * @brief Blocking join outside the portal. A hinted attempt that finds no
+ * access point is retried once with a full scan.
+ */
+bool WiFiProvisioner::reconnect(const char *ssid, const char *password, unsigned long timeoutMs) {
+  wifiprov::ConnectHint hint;
+  bool useHint = ssid && findConnectHint(ssid, password, hint);
+  for (;;) {
+    unsigned long start = millis();
+    if (connect(ssid, password, useHint ? &hint : nullptr) != wifiprov::ConnectFailure::None) {
+      return false;
+    }
+    _station->wait(timeoutMs);
+    _station->end();
+    wifiprov::ConnectFailure failure = _station->failure();
+    if (failure == wifiprov::ConnectFailure::None) {
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Reconnected to SSID '%s' in %lums.",
+                                 ssid, millis() - start);
+      return true;
+    }
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "Reconnect to SSID '%s' failed: %s",
+                               ssid, wifiprov::connectFailureName(failure));
+    if (failure != wifiprov::ConnectFailure::NoApFound || !_station->hinted()) {
+      return false;
+    }
+    useHint = false;
+  }
+}
 
 void WiFiProvisioner::sendBadRequestResponse() {
-  WiFiClient client = _server->client();
-   if (!client) {
+  Print *out = _http->beginResponse();
+   if (!out) {
         WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "No client for Bad Request response.");
         return;
    }
 
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "Sending 400 Bad Request response.");
-  client.println("HTTP/1.1 400 Bad Request");
-  client.println("Content-Type: text/plain");
-  client.println("Cache-Control: no-cache, no-store, must-revalidate");
-  client.println("Pragma: no-cache");
-  client.println("Expires: -1");
-  client.println("Connection: close");
-  client.println("Content-Length: 12"); // Length of "Bad Request\n"
-  client.println();
-  client.println("Bad Request"); // Simple body
+  sendStandardHeaders(*_http, *out, 400, "text/plain");
+  out->println("Content-Length: 13"); // Length of "Bad Request\r\n"
+  out->println();
+  out->println("Bad Request"); // Simple body
 
-  client.stop();
+  finishResponse(*_http, "Bad Request");
 }
 
 
-void WiFiProvisioner::handleSuccesfulConnection() {
-   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Sending successful connection response {success: true}.");
-  JsonDocument doc; // Small JSON, StaticJsonDocument<32> would work
-  doc["success"] = true;
-
-  WiFiClient client = _server->client();
-   if (!client) {
-        WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "No client for successful connection response.");
-        return;
-   }
-
-   size_t jsonLength = measureJson(doc);
-   sendStandardHeaders(client, 200, "application/json");
-   client.print("Content-Length: "); client.println(jsonLength);
-   client.println(); // End headers
-   serializeJson(doc, client);
-
-  // Client will see {success: true} and display its own success page
-  client.stop();
-   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Successful connection response sent.");
+/**
+ * @brief Reports the connect attempt's phase. Final phases are remembered
+ * as seen, which lets a successful attempt shut the portal down.
+ */
+void WiFiProvisioner::handleStatusRequest() {
+  if (_apMoved) {
+    // The page polls /status throughout a connect, so this is when the
+    // phone was back after the move
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
+                               "Portal client back %lums after the soft AP channel move.",
+                               millis() - _apMoveTime);
+    _apMoved = false;
+  }
+  sendConnectStatus(200, "Status");
+  if (_connectPhase == ConnectPhase::Done || _connectPhase == ConnectPhase::Failed) {
+    _connectReported = true;
+  }
 }
 
-
-void WiFiProvisioner::handleUnsuccessfulConnection(const char *reason) {
-   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "Sending unsuccessful connection response {success: false, reason: %s}.", reason ? reason : "unknown");
-  JsonDocument doc; // StaticJsonDocument<64> likely enough
-  doc["success"] = false;
-  doc["reason"] = reason ? reason : "unknown";
-
-  WiFiClient client = _server->client();
-   if (!client) {
-        WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "No client for unsuccessful connection response.");
-        return;
-   }
-
-  size_t jsonLength = measureJson(doc);
-  sendStandardHeaders(client, 200, "application/json"); // Still 200 OK, payload indicates error
-  client.print("Content-Length: "); client.println(jsonLength);
-  client.println(); // End headers
-  serializeJson(doc, client);
-
-  client.stop(); // Client JS should handle showing error based on reason
-   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Unsuccessful connection response sent.");
-
-  // Optionally disconnect WiFi if connection failed due to bad credentials etc.
-  // WiFi.disconnect(false, true); // Keep AP running for retry
+/**
+ * @brief Sends {"phase": ..., "elapsed": ms} for the current connect
+ * attempt, with "reason" once it has failed.
+ */
+void WiFiProvisioner::sendConnectStatus(int statusCode, const char *label) {
+  // A stored network tried behind the portal is no attempt of the page's
+  static const char *const kPhaseNames[] = {"idle", "associating", "dhcp",
+                                            "validating", "done", "failed", "idle"};
+  unsigned long elapsed = millis() - _connectStart;
+  sendJsonResponse(*_http, statusCode, label, [&](wifiprov::JsonWriter &json) {
+    json.beginObject().member("phase", kPhaseNames[(int)_connectPhase]);
+    if (_connectPhase != ConnectPhase::Idle && _connectPhase != ConnectPhase::Reconnecting) {
+      json.member("elapsed", elapsed);
+    }
+    if (_connectPhase == ConnectPhase::Failed) {
+      json.member("reason", _connectReason);
+    }
+    json.endObject();
+  });
 }
 
-
 void WiFiProvisioner::handleResetRequest() {
    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Handling factory reset request '/factoryreset'.");
+  _credentials.clear();
   if (factoryResetCallback) {
      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Calling factory reset callback.");
     factoryResetCallback(); // Execute user-defined reset actions (e.g., clear preferences)
@@ -697,38 +1870,71 @@ void WiFiProvisioner::handleResetRequest() {
   }
 
 
-  WiFiClient client = _server->client();
-   if (!client) {
+  Print *out = _http->beginResponse();
+   if (!out) {
        WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR, "No client for factory reset response.");
        return;
    }
    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Sending factory reset success response.");
 
   // Send a simple 200 OK response to acknowledge the reset was triggered
-  sendStandardHeaders(client, 200, "text/plain");
-  client.println("Content-Length: 13"); // "Reset Success"
-  client.println();
-  client.print("Reset Success");
+  sendStandardHeaders(*_http, *out, 200, "text/plain");
+  out->println("Content-Length: 13"); // "Reset Success"
+  out->println();
+  out->print("Reset Success");
 
-  client.stop();
+  finishResponse(*_http, "Reset");
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Factory reset response sent.");
 
-  // It's generally recommended to restart the ESP32 after a factory reset
-  // You might want a small delay before restarting
-   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Restarting device after factory reset in 1 second...");
+  // Restart after a factory reset, with time for the reply to reach the page
+   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Restarting device after factory reset in 5 seconds...");
    delay(5000);
    ESP.restart();
 }
 
+/**
+ * @brief Answers a connectivity check or a request for a foreign URL with a
+ * redirect to the portal, or with a tiny page that links to it (`stub`).
+ */
+void WiFiProvisioner::handleProbeRequest(bool stub) {
+  Print *response = _http->beginResponse();
+  if (!response) {
+    return;
+  }
+  String portalUrl = "http://" + _apIP.toString() + "/";
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Probe %s%s -> %s.",
+                             _http->hostHeader().c_str(), _http->uri().c_str(),
+                             stub ? "stub" : "302");
+
+  Print &out = *response;
+  if (stub) {
+    char body[160];
+    int length = snprintf(body, sizeof(body),
+                          "<html><head><meta http-equiv=\"refresh\" content=\"0;url=%s\"></head>"
+                          "<body><a href=\"%s\">Portal</a></body></html>",
+                          portalUrl.c_str(), portalUrl.c_str());
+    sendStandardHeaders(*_http, out, 200, "text/html");
+    out.print("Content-Length: "); out.println(length);
+    out.println();
+    out.write((const uint8_t *)body, length);
+  } else {
+    sendStandardHeaders(*_http, out, 302, nullptr);
+    out.print("Location: "); out.println(portalUrl);
+    out.println("Content-Length: 0");
+    out.println();
+  }
+  finishResponse(*_http, "Probe");
+}
+
 // Sends a 204 No Content response for favicon requests to prevent errors
 void WiFiProvisioner::handleFaviconRequest() {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO, "Handling favicon request '/favicon.ico'.");
-    WiFiClient client = _server->client();
-    if (client) {
-        client.println("HTTP/1.1 204 No Content");
-        client.println("Connection: close");
-        client.println();
-        client.stop();
+    Print *out = _http->beginResponse();
+    if (out) {
+        out->println("HTTP/1.1 204 No Content");
+        out->println(_http->keepAlive() ? "Connection: keep-alive" : "Connection: close");
+        out->println();
+        finishResponse(*_http, "Favicon");
         WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG, "Sent 204 No Content for favicon.");
     } else {
         WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN, "No client for favicon request.");
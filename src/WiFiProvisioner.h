@@ -1,11 +1,27 @@
 #ifndef WIFIPROVISIONER_H
 #define WIFIPROVISIONER_H
 
+#include "internal/captive_dns.h"
+#include "internal/credential_store.h"
+#include "internal/network_list.h"
+#include "internal/provision_request.h"
+#include "internal/service_task.h"
 #include <IPAddress.h>
+#include <WString.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
 #include <functional>
 
-class WebServer;
-class DNSServer;
+struct PortalAsset;
+
+namespace wifiprov {
+class HttpTransport;
+class SharedBuffer;
+class StationConnector;
+class IdleWaiter;
+struct ConnectHint;
+enum class ConnectFailure : uint8_t;
+} // namespace wifiprov
 
 class WiFiProvisioner {
 public:
@@ -29,6 +45,18 @@ public:
     const char *USERNAME_TEXT;           // Text for username field
     const char *SERVICE_PASSWORD_TEXT;   // Text for service password field
     bool SHOW_LOGIN_FIELDS;              // Whether to show login fields
+    unsigned long SCAN_INTERVAL_MS = 30000; // Background rescan period, 0 = only on refresh
+    uint8_t MAX_NETWORKS = 20;           // Networks listed, strongest first (max WIFI_PROVISIONER_MAX_NETWORKS)
+    uint16_t MAX_IDLE_MS = 0;            // Longest sleep between idle portal passes, 0 = poll every 1 ms
+    bool SERVICE_TASKS = false;          // Serve DNS and HTTP from their own FreeRTOS tasks
+    uint8_t DNS_TASK_PRIORITY = 3;       // DNS task priority
+    uint16_t DNS_TASK_STACK = 3072;      // DNS task stack size in bytes
+    int8_t DNS_TASK_CORE = 0;            // Core for the DNS task, -1 = either
+    uint8_t HTTP_TASK_PRIORITY = 2;      // HTTP task priority
+    uint16_t HTTP_TASK_STACK = 8192;     // HTTP task stack; onInputCheck runs on it
+    int8_t HTTP_TASK_CORE = 0;           // Core for the HTTP task, -1 = either
+    bool MULTI_CLIENT_HTTP = true;       // Serve several clients at once; false = Arduino WebServer
+    bool SAVE_CREDENTIALS = true;        // Store the joined network in NVS for autoConnect()
 
     Config(
         const char *apName = "ESP32 Wi-Fi Provisioning",
@@ -69,40 +97,139 @@ public:
 
   Config &getConfig();
 
+  // Blocks until provisioning completes; begin() + handle() in a loop.
   bool startProvisioning();
 
+  // Joins the stored network, or runs the portal until it is provisioned.
+  // True once connected either way.
+  bool autoConnect(unsigned long timeoutMs = 10000);
+  // Erases the network autoConnect() uses; /factoryreset does this too.
+  void forgetCredentials();
+
+  // Non-blocking use: begin() brings the portal up, handle() is called from
+  // the application's loop while isActive(), end() takes it down early.
+  bool begin();
+  void handle();
+  bool isActive() const;
+  void end();
+
+  // Answers `domain` with `address` instead of the portal; 0.0.0.0 makes it
+  // NXDOMAIN. Call before begin().
+  WiFiProvisioner &addDnsOverride(const char *domain, IPAddress address);
+
+  // Joins a known network without the portal, e.g. at boot. Goes straight
+  // to the access point the last scan or join found for `ssid`, and falls
+  // back to an all-channel scan if it is not there. Blocks up to
+  // `timeoutMs` per attempt.
+  bool reconnect(const char *ssid, const char *password, unsigned long timeoutMs = 10000);
+
   WiFiProvisioner &onProvision(ProvisionCallback callback);
   WiFiProvisioner &onInputCheck(InputCheckCallback callback);
   WiFiProvisioner &onFactoryReset(FactoryResetCallback callback);
   WiFiProvisioner &onSuccess(SuccessCallback callback);
 
 private:
-  void loop();
-  bool connect(const char *ssid, const char *password);
+  wifiprov::ConnectFailure connect(const char *ssid, const char *password,
+                                   const wifiprov::ConnectHint *hint);
+  wifiprov::ConnectFailure joinStoredNetwork(const wifiprov::StoredNetwork &network,
+                                             const wifiprov::ConnectHint &hint,
+                                             unsigned long timeoutMs);
+  void queueStoredNetworks(int scanCount);
+  bool nextStoredJoin();
+  void cancelStoredJoins();
+  void noteStoredJoinFailures();
+  void alignSoftApChannel(uint8_t channel);
+  bool runPortal();
+  void rememberNetwork(const char *ssid, const char *password);
+  bool findConnectHint(const char *ssid, const char *password, wifiprov::ConnectHint &hint) const;
   void releaseResources();
   void handleRootRequest();
   void handleResetRequest();
   void handleUpdateRequest();
   void handleConfigureRequest();
   void sendBadRequestResponse();
-  void handleSuccesfulConnection();
-  void handleUnsuccessfulConnection(const char *reason);
+  void handleStatusRequest();
+  void sendConnectStatus(int statusCode, const char *label);
+  void updateConnectAttempt();
+  void servePortal();
+  bool startServiceTasks();
+  void stopServiceTasks();
   void handleFaviconRequest();
+  void handleProbeRequest(bool stub);
+  void handleAssetRequest(const PortalAsset &asset);
+  void handleLogoRequest();
+  void sendStaticResponse(const char *contentType, const char *etag,
+                          const char *cacheControl, const uint8_t *body,
+                          size_t length, bool gzip);
+  void startNetworkScan();
+  void updateNetworkScan();
+  void stopNetworkScan();
+  void buildPageCache();
+  void releasePageCache();
   ProvisionCallback provisionCallback;
   InputCheckCallback inputCheckCallback;
   SuccessCallback onSuccessCallback;
   FactoryResetCallback factoryResetCallback;
 
   Config _config;
-  WebServer *_server;
-  DNSServer *_dnsServer;
+  wifiprov::HttpTransport *_http;
+  wifiprov::CaptiveDns _dns;
   IPAddress _apIP;
   IPAddress _netMsk;
   uint16_t _dnsPort;
   unsigned int _serverPort;
   unsigned int _wifiDelay;
   unsigned int _wifiConnectionTimeout;
-  bool _serverLoopFlag;
+  volatile bool _serverLoopFlag; // Also read across the service tasks
+  wifiprov::StationConnector *_station; // Created on first connect()
+  wifiprov::IdleWaiter *_idle; // Paces startProvisioning() while the portal is up
+  wifiprov::ServiceTask _dnsTask;
+  wifiprov::ServiceTask _httpTask;
+  wifiprov::CredentialStore _credentials;
+
+  // Connect attempt started by /configure and advanced by handle(). The
+  // station driver does not report the handshake separately, so
+  // Associating covers authentication as well. Reconnecting is
+  // autoConnect() trying stored networks behind the portal.
+  enum class ConnectPhase : uint8_t { Idle, Associating, Dhcp, Validating, Done, Failed, Reconnecting };
+  ConnectPhase _connectPhase;
+  const char *_connectReason; // Sent by /status once Failed
+  unsigned long _connectStart;
+  unsigned long _connectDoneTime;
+  bool _connectReported; // /status has delivered the final phase
+  wifiprov::ProvisionRequest _pending; // Fields of the accepted /configure
+  unsigned long _apMoveTime; // millis() when the soft AP last changed channel
+  bool _apMoved; // Set until a /status request shows the page is back
+
+  // Latest background scan, merged per SSID
+  wifiprov::NetworkList _networks;
+  unsigned long _scanTime; // millis() when _networks was taken
+  uint32_t _scanGeneration; // Bumped per completed scan, part of the page key
+  bool _scanValid;
+  bool _scanRunning;
+
+  // Plain and gzip-compressed renders of the portal page, keyed by a config
+  // fingerprint. Shared, so a response still sending an old render keeps it
+  // alive.
+  wifiprov::SharedBuffer *_pagePlain;
+  wifiprov::SharedBuffer *_pageGzip;
+  uint32_t _pageKey;
+
+  // Stored networks autoConnect() tries behind the portal, best first, as
+  // Reconnecting attempts. Ranked by the portal's first scan.
+  struct StoredJoin {
+    uint8_t index;   // Into the stored list
+    uint8_t channel; // Of the access point seen; 0 to join by SSID
+    uint8_t bssid[6];
+  };
+  StoredJoin _storedJoins[wifiprov::CredentialStore::kCapacity];
+  uint8_t _storedJoinCount;
+  uint8_t _storedJoinNext;
+  uint32_t _storedSkip; // Stored networks left out, one bit per list index
+  bool _storedScanPending; // Waiting for the scan before the first attempt
+  // SSIDs of failed stored joins, from servePortal() (possibly on the HTTP
+  // task) to handle(), which counts them in the store
+  QueueHandle_t _joinFailures;
 };
 
 #endif // WIFIPROVISIONER_H
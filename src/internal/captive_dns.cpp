@@ -0,0 +1,242 @@
+#include "captive_dns.h"
+#include <ctype.h>
+#include <lwip/sockets.h>
+#include <string.h>
+
+namespace wifiprov {
+
+namespace {
+
+constexpr size_t kHeaderSize = 12;
+constexpr size_t kMaxNameLength = 255;
+// Bounds one processPending() call so a flood cannot starve HTTP
+constexpr size_t kMaxPerCall = 32;
+
+constexpr uint16_t kFlagResponse = 0x8000;
+constexpr uint16_t kFlagAuthoritative = 0x0400;
+constexpr uint16_t kFlagRecursionDesired = 0x0100;
+
+constexpr uint8_t kRcodeNoError = 0;
+constexpr uint8_t kRcodeFormErr = 1;
+constexpr uint8_t kRcodeNxDomain = 3;
+constexpr uint8_t kRcodeNotImp = 4;
+constexpr uint8_t kRcodeRefused = 5;
+
+constexpr uint16_t kTypeA = 1;
+constexpr uint16_t kTypeAny = 255;
+constexpr uint16_t kClassIn = 1;
+constexpr uint16_t kClassAny = 255;
+
+// SOA for negative answers: owner is the queried name (pointer to offset
+// 12), empty MNAME/RNAME, and a minimum that sets the negative TTL
+const uint8_t kSoaRecord[] = {
+    0xC0, 0x0C,                                   // Name: the question's QNAME
+    0x00, 0x06, 0x00, 0x01,                       // Type SOA, class IN
+    0x00, 0x00, 0x00, CaptiveDns::kTtl,           // TTL
+    0x00, 0x16,                                   // RDLENGTH 22
+    0x00, 0x00,                                   // MNAME, RNAME: root
+    0x00, 0x00, 0x00, 0x01,                       // Serial
+    0x00, 0x00, 0x0E, 0x10,                       // Refresh 3600
+    0x00, 0x00, 0x02, 0x58,                       // Retry 600
+    0x00, 0x09, 0x3A, 0x80,                       // Expire 604800
+    0x00, 0x00, 0x00, CaptiveDns::kTtl,           // Minimum: negative TTL
+};
+
+uint16_t read16(const uint8_t *p) { return (uint16_t)(p[0] << 8 | p[1]); }
+
+void write16(uint8_t *p, uint16_t v) {
+  p[0] = v >> 8;
+  p[1] = v & 0xFF;
+}
+
+} // namespace
+
+CaptiveDns::CaptiveDns() : _fd(-1), _queries(0), _answerRecord{}, _overrideCount(0) {}
+
+CaptiveDns::~CaptiveDns() { end(); }
+
+bool CaptiveDns::begin(uint16_t port, const IPAddress &address) {
+  end();
+
+  const uint8_t record[] = {
+      0xC0, 0x0C,                         // Name: the question's QNAME
+      0x00, 0x01, 0x00, 0x01,             // Type A, class IN
+      0x00, 0x00, 0x00, kTtl,             // TTL
+      0x00, 0x04,                         // RDLENGTH
+      address[0], address[1], address[2], address[3],
+  };
+  memcpy(_answerRecord, record, sizeof(_answerRecord));
+
+  _fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (_fd < 0) {
+    return false;
+  }
+  int reuse = 1;
+  setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+  struct sockaddr_in local;
+  memset(&local, 0, sizeof(local));
+  local.sin_family = AF_INET;
+  local.sin_port = htons(port);
+  local.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(_fd, (struct sockaddr *)&local, sizeof(local)) < 0) {
+    end();
+    return false;
+  }
+  _queries = 0;
+  return true;
+}
+
+void CaptiveDns::end() {
+  if (_fd >= 0) {
+    close(_fd);
+    _fd = -1;
+  }
+}
+
+bool CaptiveDns::addOverride(const char *domain, const IPAddress &address) {
+  if (!domain || _overrideCount >= WIFI_PROVISIONER_DNS_OVERRIDES) {
+    return false;
+  }
+  size_t len = strlen(domain);
+  if (len > 0 && domain[len - 1] == '.') {
+    --len; // "example.com." and "example.com" are the same name
+  }
+  Override &entry = _overrides[_overrideCount];
+  if (len == 0 || len >= sizeof(entry.domain)) {
+    return false;
+  }
+  for (size_t i = 0; i < len; ++i) {
+    entry.domain[i] = (char)tolower((unsigned char)domain[i]);
+  }
+  entry.domain[len] = '\0';
+  for (int i = 0; i < 4; ++i) {
+    entry.address[i] = address[i];
+  }
+  ++_overrideCount;
+  return true;
+}
+
+size_t CaptiveDns::processPending() {
+  if (_fd < 0) {
+    return 0;
+  }
+  size_t handled = 0;
+  while (handled < kMaxPerCall) {
+    struct sockaddr_in from;
+    socklen_t fromLen = sizeof(from);
+    // Leave room behind the question for the record we append
+    int len = recvfrom(_fd, _packet, sizeof(_packet) - sizeof(kSoaRecord), MSG_DONTWAIT,
+                       (struct sockaddr *)&from, &fromLen);
+    if (len <= 0) {
+      break; // Queue drained
+    }
+    ++handled;
+    ++_queries;
+    size_t replyLen = answer((size_t)len);
+    if (replyLen > 0) {
+      sendto(_fd, _packet, replyLen, 0, (struct sockaddr *)&from, fromLen);
+    }
+  }
+  return handled;
+}
+
+size_t CaptiveDns::answer(size_t len) {
+  // The reply is built in place: header and question are the query's own
+  // bytes, followed by at most one record
+  uint8_t *p = _packet;
+  if (len < kHeaderSize) {
+    return 0;
+  }
+  uint16_t flags = read16(p + 2);
+  if (flags & kFlagResponse) {
+    return 0; // Not a query; never answer answers
+  }
+
+  uint16_t opcode = (flags >> 11) & 0x0F;
+  uint8_t rcode = kRcodeNoError;
+  const uint8_t *record = nullptr;
+  size_t recordLen = 0;
+  bool authority = false;
+  size_t end = kHeaderSize;
+
+  if (opcode != 0) {
+    rcode = kRcodeNotImp;
+  } else if (read16(p + 4) != 1) {
+    rcode = kRcodeFormErr;
+  } else {
+    // Walk the QNAME; queries carry no compression pointers
+    size_t pos = kHeaderSize;
+    while (pos < len && p[pos] != 0 && !(p[pos] & 0xC0)) {
+      pos += p[pos] + 1;
+    }
+    if (pos + 5 > len || p[pos] != 0 || pos - kHeaderSize + 1 > kMaxNameLength) {
+      rcode = kRcodeFormErr;
+    } else {
+      uint16_t qtype = read16(p + pos + 1);
+      uint16_t qclass = read16(p + pos + 3);
+      end = pos + 5;
+
+      const Override *entry = _overrideCount ? findOverride(p + kHeaderSize) : nullptr;
+      bool nxdomain = entry && !(entry->address[0] | entry->address[1] |
+                                 entry->address[2] | entry->address[3]);
+      if (qclass != kClassIn && qclass != kClassAny) {
+        rcode = kRcodeRefused;
+      } else if (nxdomain) {
+        rcode = kRcodeNxDomain;
+        record = kSoaRecord;
+        recordLen = sizeof(kSoaRecord);
+        authority = true;
+      } else if (qtype == kTypeA || qtype == kTypeAny) {
+        record = _answerRecord;
+        recordLen = sizeof(_answerRecord);
+      } else {
+        // NODATA: the name exists, but has no record of this type
+        record = kSoaRecord;
+        recordLen = sizeof(kSoaRecord);
+        authority = true;
+      }
+
+      if (record) {
+        memcpy(p + end, record, recordLen);
+        if (entry && !authority) {
+          memcpy(p + end + recordLen - 4, entry->address, 4);
+        }
+        end += recordLen;
+      }
+    }
+  }
+
+  bool question = end > kHeaderSize;
+  write16(p + 2, kFlagResponse | kFlagAuthoritative | (flags & kFlagRecursionDesired) |
+                     (opcode << 11) | rcode);
+  write16(p + 4, question ? 1 : 0);                 // QDCOUNT
+  write16(p + 6, record && !authority ? 1 : 0);     // ANCOUNT
+  write16(p + 8, record && authority ? 1 : 0);      // NSCOUNT
+  write16(p + 10, 0);                               // ARCOUNT: no EDNS
+  return end;
+}
+
+const CaptiveDns::Override *CaptiveDns::findOverride(const uint8_t *qname) const {
+  // Rebuild the dotted, lower-case name once, then compare
+  char name[kMaxNameLength + 1];
+  size_t n = 0;
+  for (const uint8_t *label = qname; *label; label += *label + 1) {
+    if (n > 0) {
+      name[n++] = '.';
+    }
+    for (uint8_t i = 1; i <= *label; ++i) {
+      name[n++] = (char)tolower(label[i]);
+    }
+  }
+  name[n] = '\0';
+
+  for (size_t i = 0; i < _overrideCount; ++i) {
+    if (strcmp(_overrides[i].domain, name) == 0) {
+      return &_overrides[i];
+    }
+  }
+  return nullptr;
+}
+
+} // namespace wifiprov
@@ -0,0 +1,74 @@
+#ifndef WIFIPROVISIONER_CAPTIVE_DNS_H
+#define WIFIPROVISIONER_CAPTIVE_DNS_H
+
+#include <IPAddress.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace wifiprov {
+
+// Number of per-domain overrides a CaptiveDns can hold.
+#ifndef WIFI_PROVISIONER_DNS_OVERRIDES
+#define WIFI_PROVISIONER_DNS_OVERRIDES 8
+#endif
+
+/**
+ * @brief Minimal authoritative DNS responder for a captive portal.
+ *
+ * Every A query is answered with the portal address unless a per-domain
+ * override applies. Other types (AAAA, HTTPS, SVCB, ...) get an immediate
+ * NODATA answer carrying an SOA, so clients cache the negative result
+ * instead of retrying. Answers are built by copying the question and
+ * appending a record template prepared in begin(). Each
+ * processPending() call drains every datagram waiting on the socket.
+ */
+class CaptiveDns {
+public:
+  static constexpr uint32_t kTtl = 60; // Seconds, for answers and negative caching
+
+  CaptiveDns();
+  ~CaptiveDns();
+
+  CaptiveDns(const CaptiveDns &) = delete;
+  CaptiveDns &operator=(const CaptiveDns &) = delete;
+
+  // Opens a non-blocking UDP socket on `port`; A queries resolve to `address`.
+  bool begin(uint16_t port, const IPAddress &address);
+  void end();
+  bool running() const { return _fd >= 0; }
+  // The socket queries arrive on, to wait for; -1 while stopped.
+  int fd() const { return _fd; }
+
+  // Resolves `domain` (and nothing below it) to `address` instead of the
+  // portal; 0.0.0.0 answers NXDOMAIN. False once the table is full.
+  bool addOverride(const char *domain, const IPAddress &address);
+  void clearOverrides() { _overrideCount = 0; }
+
+  // Answers every query currently queued. Returns how many were handled.
+  size_t processPending();
+
+  // Total queries answered since begin().
+  uint32_t queries() const { return _queries; }
+
+private:
+  struct Override {
+    char domain[64]; // Lower case, no trailing dot
+    uint8_t address[4];
+  };
+
+  // Turns the `len`-byte query in _packet into its reply; returns the reply
+  // length, 0 to drop.
+  size_t answer(size_t len);
+  const Override *findOverride(const uint8_t *qname) const;
+
+  int _fd;
+  uint32_t _queries;
+  uint8_t _answerRecord[16]; // Pointer to QNAME, A, IN, TTL, 4, address
+  Override _overrides[WIFI_PROVISIONER_DNS_OVERRIDES];
+  size_t _overrideCount;
+  uint8_t _packet[576];
+};
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_CAPTIVE_DNS_H
@@ -0,0 +1,258 @@
+#include "credential_store.h"
+#include <Preferences.h>
+#include <string.h>
+#include <time.h>
+
+namespace wifiprov {
+
+namespace {
+
+const char *const kNamespace = "wifiprov";
+const char *const kKey = "network";
+// Bumped whenever the blob layout changes
+constexpr uint8_t kVersion = 2;
+// Times before this mean the clock has not been set since boot
+constexpr time_t kClockValid = 1609459200; // 2021-01-01
+
+// Blob: version, count, then per network: SSID length, SSID, password
+// length, password, BSSID, channel, failures, lastSuccess (little endian)
+constexpr size_t kMaxEntry = 1 + 32 + 1 + 64 + 6 + 1 + 1 + 4;
+constexpr size_t kMaxBlob = 2 + CredentialStore::kCapacity * kMaxEntry;
+
+// Version 1 kept a single network as this struct, written as is
+struct RecordV1 {
+  uint8_t version;
+  struct {
+    char ssid[33];
+    char password[65];
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint8_t failures;
+    uint32_t lastSuccess;
+  } network;
+};
+
+// A blob as read from or written to NVS; wiped once out of scope
+struct Blob {
+  uint8_t data[kMaxBlob > sizeof(RecordV1) ? kMaxBlob : sizeof(RecordV1)];
+  size_t length = 0;
+  bool stale = false; // Converted from an older layout, so rewritten on the next store
+  ~Blob() { memset(data, 0, sizeof(data)); }
+};
+
+bool writeBlob(const Blob &blob) {
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) {
+    return false;
+  }
+  bool ok = prefs.putBytes(kKey, blob.data, blob.length) == blob.length;
+  prefs.end();
+  return ok;
+}
+
+// Decodes the network at `p` and moves past it. False if the blob ends or
+// is malformed there.
+bool readEntry(const uint8_t *&p, const uint8_t *end, StoredNetwork &network) {
+  memset(&network, 0, sizeof(network));
+  if (end - p < 1 || p[0] == 0 || p[0] >= sizeof(network.ssid) || end - p < 2 + p[0]) {
+    return false;
+  }
+  memcpy(network.ssid, p + 1, p[0]);
+  p += 1 + p[0];
+  if (p[0] >= sizeof(network.password) || end - p < 1 + p[0] + 12) {
+    return false;
+  }
+  memcpy(network.password, p + 1, p[0]);
+  p += 1 + p[0];
+  memcpy(network.bssid, p, sizeof(network.bssid));
+  p += sizeof(network.bssid);
+  network.channel = *p++;
+  network.failures = *p++;
+  network.lastSuccess = (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 |
+                        (uint32_t)p[3] << 24;
+  p += 4;
+  return true;
+}
+
+uint8_t *writeEntry(uint8_t *p, const StoredNetwork &network) {
+  size_t length = strlen(network.ssid);
+  *p++ = length;
+  memcpy(p, network.ssid, length);
+  p += length;
+  length = strlen(network.password);
+  *p++ = length;
+  memcpy(p, network.password, length);
+  p += length;
+  memcpy(p, network.bssid, sizeof(network.bssid));
+  p += sizeof(network.bssid);
+  *p++ = network.channel;
+  *p++ = network.failures;
+  for (int shift = 0; shift < 32; shift += 8) {
+    *p++ = network.lastSuccess >> shift;
+  }
+  return p;
+}
+
+size_t decode(const Blob &blob, StoredNetwork *networks) {
+  const uint8_t *p = blob.data + 2;
+  const uint8_t *end = blob.data + blob.length;
+  size_t count = 0;
+  while (count < blob.data[1] && readEntry(p, end, networks[count])) {
+    ++count;
+  }
+  return count;
+}
+
+void encode(const StoredNetwork *networks, size_t count, Blob &blob) {
+  blob.data[0] = kVersion;
+  blob.data[1] = count;
+  uint8_t *p = blob.data + 2;
+  for (size_t i = 0; i < count; ++i) {
+    p = writeEntry(p, networks[i]);
+  }
+  blob.length = p - blob.data;
+}
+
+// Converts the version 1 record in `blob` to a one-network blob
+bool migrateV1(Blob &blob) {
+  RecordV1 record;
+  memcpy(&record, blob.data, sizeof(record));
+  bool ok = record.network.ssid[0] &&
+            memchr(record.network.ssid, '\0', sizeof(record.network.ssid)) &&
+            memchr(record.network.password, '\0', sizeof(record.network.password));
+  if (ok) {
+    StoredNetwork network;
+    memset(&network, 0, sizeof(network));
+    strcpy(network.ssid, record.network.ssid);
+    strcpy(network.password, record.network.password);
+    memcpy(network.bssid, record.network.bssid, sizeof(network.bssid));
+    network.channel = record.network.channel;
+    network.failures = record.network.failures;
+    network.lastSuccess = record.network.lastSuccess;
+    encode(&network, 1, blob);
+    blob.stale = true;
+    memset(&network, 0, sizeof(network));
+  }
+  memset(&record, 0, sizeof(record));
+  return ok;
+}
+
+bool readBlob(Blob &blob) {
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, true)) {
+    return false; // Namespace not created yet
+  }
+  size_t length = prefs.getBytesLength(kKey);
+  bool ok = length >= 2 && length <= sizeof(blob.data) &&
+            prefs.getBytes(kKey, blob.data, length) == length;
+  prefs.end();
+  if (ok && blob.data[0] == 1 && length == sizeof(RecordV1)) {
+    return migrateV1(blob);
+  }
+  ok = ok && blob.data[0] == kVersion && blob.data[1] <= CredentialStore::kCapacity;
+  blob.length = ok ? length : 0;
+  return ok;
+}
+
+// Writes `networks` unless the stored blob already says the same
+bool store(const StoredNetwork *networks, size_t count, const Blob &stored) {
+  Blob blob;
+  encode(networks, count, blob);
+  if (!stored.stale && blob.length == stored.length &&
+      memcmp(blob.data, stored.data, blob.length) == 0) {
+    return true;
+  }
+  return writeBlob(blob);
+}
+
+} // namespace
+
+size_t CredentialStore::load(StoredNetwork *networks) const {
+  Blob blob;
+  return readBlob(blob) ? decode(blob, networks) : 0;
+}
+
+bool CredentialStore::find(const char *ssid, StoredNetwork &network) const {
+  Blob blob;
+  if (!readBlob(blob)) {
+    return false;
+  }
+  const uint8_t *p = blob.data + 2;
+  for (size_t i = 0; i < blob.data[1] && readEntry(p, blob.data + blob.length, network); ++i) {
+    if (strcmp(network.ssid, ssid) == 0) {
+      return true;
+    }
+  }
+  memset(&network, 0, sizeof(network));
+  return false;
+}
+
+bool CredentialStore::save(const char *ssid, const char *password, const uint8_t *bssid,
+                           uint8_t channel) {
+  size_t ssidLength = strlen(ssid);
+  size_t passwordLength = password ? strlen(password) : 0;
+  if (ssidLength == 0 || ssidLength >= sizeof(StoredNetwork::ssid) ||
+      passwordLength >= sizeof(StoredNetwork::password)) {
+    return false;
+  }
+
+  Blob stored;
+  readBlob(stored);
+  StoredNetwork networks[kCapacity + 1];
+  size_t count = stored.length ? decode(stored, networks + 1) : 0;
+
+  // The joined network goes first; its old entry, if any, drops out
+  StoredNetwork &joined = networks[0];
+  memset(&joined, 0, sizeof(joined));
+  memcpy(joined.ssid, ssid, ssidLength);
+  if (passwordLength) {
+    memcpy(joined.password, password, passwordLength);
+  }
+  if (bssid && channel) {
+    memcpy(joined.bssid, bssid, sizeof(joined.bssid));
+    joined.channel = channel;
+  }
+  time_t now = time(nullptr);
+  size_t kept = 1;
+  for (size_t i = 1; i <= count; ++i) {
+    if (strcmp(networks[i].ssid, ssid) == 0) {
+      joined.lastSuccess = networks[i].lastSuccess;
+    } else if (kept < kCapacity) {
+      networks[kept++] = networks[i];
+    }
+  }
+  if (now >= kClockValid) {
+    joined.lastSuccess = (uint32_t)now;
+  }
+
+  bool ok = store(networks, kept, stored);
+  memset(networks, 0, sizeof(networks));
+  return ok;
+}
+
+void CredentialStore::noteFailure(const char *ssid) {
+  Blob stored;
+  if (!readBlob(stored)) {
+    return;
+  }
+  StoredNetwork networks[kCapacity];
+  size_t count = decode(stored, networks);
+  for (size_t i = 0; i < count; ++i) {
+    if (strcmp(networks[i].ssid, ssid) == 0 && networks[i].failures < UINT8_MAX) {
+      networks[i].failures++;
+      store(networks, count, stored);
+      break;
+    }
+  }
+  memset(networks, 0, sizeof(networks));
+}
+
+void CredentialStore::clear() {
+  Preferences prefs;
+  if (prefs.begin(kNamespace, false)) {
+    prefs.remove(kKey);
+    prefs.end();
+  }
+}
+
+} // namespace wifiprov
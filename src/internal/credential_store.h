@@ -0,0 +1,58 @@
+#ifndef WIFIPROVISIONER_CREDENTIAL_STORE_H
+#define WIFIPROVISIONER_CREDENTIAL_STORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace wifiprov {
+
+// Networks the credential store remembers; the one joined longest ago
+// makes way for a new one.
+#ifndef WIFI_PROVISIONER_MAX_STORED_NETWORKS
+#define WIFI_PROVISIONER_MAX_STORED_NETWORKS 8
+#endif
+
+/**
+ * @brief A network the device has joined, with where it joined it.
+ */
+struct StoredNetwork {
+  char ssid[33];
+  char password[65];    // Passphrase, or the PMK as 64 hex digits
+  uint8_t bssid[6];
+  uint8_t channel;      // 0 if no access point is known
+  uint8_t failures;     // Boot-time joins that failed since the last success
+  uint32_t lastSuccess; // Unix time of the last join, 0 if the clock was not set
+};
+
+/**
+ * @brief The networks autoConnect() uses, kept in NVS.
+ *
+ * The list is one versioned blob in the "wifiprov" namespace, most recently
+ * joined first, with each string stored at its own length, so eight
+ * networks typically take a few hundred bytes and a load is a single read.
+ * The single-network record of version 1 is read as a list of one and
+ * rewritten on the next change; a blob from any other layout is ignored
+ * rather than misread. Writes are
+ * skipped when nothing changed, which keeps a device that reboots often
+ * from wearing its flash.
+ */
+class CredentialStore {
+public:
+  static constexpr size_t kCapacity = WIFI_PROVISIONER_MAX_STORED_NETWORKS;
+
+  // Fills `networks` (room for kCapacity), most recently joined first.
+  // Returns how many were stored.
+  size_t load(StoredNetwork *networks) const;
+  // Looks one network up without loading the whole list.
+  bool find(const char *ssid, StoredNetwork &network) const;
+  // Records a successful join through `bssid` on `channel` and moves the
+  // network to the front.
+  bool save(const char *ssid, const char *password, const uint8_t *bssid, uint8_t channel);
+  // Counts a failed join of a stored network.
+  void noteFailure(const char *ssid);
+  void clear();
+};
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_CREDENTIAL_STORE_H
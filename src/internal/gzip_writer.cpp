@@ -0,0 +1,266 @@
+#include "gzip_writer.h"
+#include <stdlib.h>
+#include <string.h>
+
+namespace wifiprov {
+
+namespace {
+// Nibble-wise CRC-32 table; 64 bytes of flash instead of 1 KB.
+const uint32_t kCrcNibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+    0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+// RFC 1951 section 3.2.5 length and distance tables.
+const uint16_t kLengthBase[29] = {3,  4,  5,  6,   7,   8,   9,   10,  11, 13,
+                                  15, 17, 19, 23,  27,  31,  35,  43,  51, 59,
+                                  67, 83, 99, 115, 131, 163, 195, 227, 258};
+const uint8_t kLengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                  2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+const uint16_t kDistBase[30] = {1,    2,    3,    4,    5,    7,     9,    13,
+                                17,   25,   33,   49,   65,   97,    129,  193,
+                                257,  385,  513,  769,  1025, 1537,  2049, 3073,
+                                4097, 6145, 8193, 12289, 16385, 24577};
+const uint8_t kDistExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                                6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+constexpr unsigned kHashBits = 12;
+constexpr unsigned kMinMatch = 3;
+constexpr unsigned kMaxMatch = 258;
+constexpr size_t kWindowSize = 32768;
+// Below this size a match search rarely pays for the hash table allocation.
+constexpr size_t kMinSearchLength = 64;
+
+inline uint32_t hash3(const uint8_t *p) {
+  uint32_t v = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+  return (v * 2654435761u) >> (32 - kHashBits);
+}
+} // namespace
+
+uint32_t crc32Update(uint32_t crc, const uint8_t *data, size_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *data++;
+    crc = (crc >> 4) ^ kCrcNibble[crc & 0x0F];
+    crc = (crc >> 4) ^ kCrcNibble[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+GzipWriter::GzipWriter()
+    : _buf(nullptr), _length(0), _capacity(0), _bitBuffer(0), _bitCount(0),
+      _crc(0), _inputSize(0), _failed(false) {}
+
+GzipWriter::~GzipWriter() { free(_buf); }
+
+bool GzipWriter::begin(size_t sizeHint) {
+  free(_buf);
+  _buf = nullptr;
+  _length = _capacity = 0;
+  _bitBuffer = 0;
+  _bitCount = 0;
+  _crc = 0;
+  _inputSize = 0;
+  _failed = false;
+
+  if (!reserve(sizeHint < 32 ? 32 : sizeHint)) {
+    return false;
+  }
+  // ID1 ID2 CM=deflate FLG=0 MTIME=0 XFL=0 OS=unknown
+  static const uint8_t header[10] = {0x1F, 0x8B, 8, 0, 0, 0, 0, 0, 0, 0xFF};
+  memcpy(_buf, header, sizeof(header));
+  _length = sizeof(header);
+  return true;
+}
+
+bool GzipWriter::reserve(size_t extra) {
+  if (_failed) {
+    return false;
+  }
+  if (_length + extra <= _capacity) {
+    return true;
+  }
+  size_t newCapacity = _capacity + _capacity / 2;
+  if (newCapacity < _length + extra) {
+    newCapacity = _length + extra;
+  }
+  uint8_t *grown = (uint8_t *)realloc(_buf, newCapacity);
+  if (!grown) {
+    _failed = true;
+    return false;
+  }
+  _buf = grown;
+  _capacity = newCapacity;
+  return true;
+}
+
+void GzipWriter::putBits(uint32_t bits, uint8_t count) {
+  _bitBuffer |= bits << _bitCount;
+  _bitCount += count;
+  while (_bitCount >= 8) {
+    if (reserve(1)) {
+      _buf[_length++] = (uint8_t)_bitBuffer;
+    }
+    _bitBuffer >>= 8;
+    _bitCount -= 8;
+  }
+}
+
+// Huffman codes are packed starting with their most significant bit.
+void GzipWriter::putHuffman(uint32_t code, uint8_t count) {
+  uint32_t reversed = 0;
+  for (uint8_t i = 0; i < count; ++i) {
+    reversed = (reversed << 1) | ((code >> i) & 1);
+  }
+  putBits(reversed, count);
+}
+
+void GzipWriter::putLiteral(uint8_t value) {
+  if (value < 144) {
+    putHuffman(0x30 + value, 8);
+  } else {
+    putHuffman(0x190 + (value - 144), 9);
+  }
+}
+
+void GzipWriter::putMatch(unsigned length, unsigned distance) {
+  unsigned code = 28;
+  while (kLengthBase[code] > length) {
+    --code;
+  }
+  unsigned symbol = 257 + code;
+  if (symbol < 280) {
+    putHuffman(symbol - 256, 7);
+  } else {
+    putHuffman(0xC0 + (symbol - 280), 8);
+  }
+  putBits(length - kLengthBase[code], kLengthExtra[code]);
+
+  code = 29;
+  while (kDistBase[code] > distance) {
+    --code;
+  }
+  putHuffman(code, 5);
+  putBits(distance - kDistBase[code], kDistExtra[code]);
+}
+
+void GzipWriter::alignToByte() {
+  if (_bitCount > 0) {
+    putBits(0, 8 - _bitCount);
+  }
+}
+
+bool GzipWriter::deflate(const uint8_t *data, size_t len) {
+  if (_failed || !_buf) {
+    return false;
+  }
+  _crc = crc32Update(_crc, data, len);
+  _inputSize += len;
+
+  if (len == 0) {
+    return true;
+  }
+  uint32_t *head = nullptr;
+  if (len >= kMinSearchLength) {
+    head = (uint32_t *)calloc(1u << kHashBits, sizeof(uint32_t));
+    if (!head) {
+      _failed = true;
+      return false;
+    }
+  }
+
+  // Non-final block using the fixed Huffman tables (BFINAL=0, BTYPE=01).
+  putBits(0, 1);
+  putBits(1, 2);
+
+  size_t i = 0;
+  while (i < len && !_failed) {
+    unsigned best = 0;
+    size_t distance = 0;
+    if (head && i + kMinMatch <= len) {
+      uint32_t h = hash3(data + i);
+      size_t candidate = head[h];
+      head[h] = i + 1; // 0 marks an empty slot
+      if (candidate != 0 && i - (candidate - 1) <= kWindowSize) {
+        const uint8_t *a = data + candidate - 1;
+        const uint8_t *b = data + i;
+        size_t limit = len - i < kMaxMatch ? len - i : kMaxMatch;
+        while (best < limit && a[best] == b[best]) {
+          ++best;
+        }
+        distance = i - (candidate - 1);
+      }
+    }
+
+    if (best >= kMinMatch) {
+      putMatch(best, distance);
+      // Index the positions inside the match so later repeats can find them.
+      for (size_t j = i + 1; j < i + best && j + kMinMatch <= len; ++j) {
+        head[hash3(data + j)] = j + 1;
+      }
+      i += best;
+    } else {
+      putLiteral(data[i]);
+      ++i;
+    }
+  }
+  free(head);
+
+  putHuffman(0, 7); // end of block
+  // Sync flush: an empty stored block leaves the stream byte aligned.
+  putBits(0, 3);
+  alignToByte();
+  static const uint8_t syncMarker[4] = {0x00, 0x00, 0xFF, 0xFF};
+  if (reserve(sizeof(syncMarker))) {
+    memcpy(_buf + _length, syncMarker, sizeof(syncMarker));
+    _length += sizeof(syncMarker);
+  }
+  return !_failed;
+}
+
+bool GzipWriter::appendDeflated(const uint8_t *deflated, size_t deflatedLen,
+                                const uint8_t *plain, size_t plainLen) {
+  if (_failed || !_buf || !reserve(deflatedLen)) {
+    return false;
+  }
+  memcpy(_buf + _length, deflated, deflatedLen);
+  _length += deflatedLen;
+  _crc = crc32Update(_crc, plain, plainLen);
+  _inputSize += plainLen;
+  return true;
+}
+
+uint8_t *GzipWriter::finish(size_t *outLength) {
+  if (!_buf) {
+    return nullptr;
+  }
+  // Empty final block (BFINAL=1, BTYPE=01, end of block).
+  putBits(1, 1);
+  putBits(1, 2);
+  putHuffman(0, 7);
+  alignToByte();
+
+  if (reserve(8)) {
+    uint32_t trailer[2] = {_crc, _inputSize};
+    for (int word = 0; word < 2; ++word) {
+      for (int shift = 0; shift < 32; shift += 8) {
+        _buf[_length++] = (uint8_t)(trailer[word] >> shift);
+      }
+    }
+  }
+  if (_failed) {
+    return nullptr;
+  }
+
+  // Return the slack; the result lives as long as the provisioning session.
+  uint8_t *result = (uint8_t *)realloc(_buf, _length);
+  if (!result) {
+    result = _buf;
+  }
+  *outLength = _length;
+  _buf = nullptr;
+  _length = _capacity = 0;
+  return result;
+}
+
+} // namespace wifiprov
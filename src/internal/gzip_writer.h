@@ -0,0 +1,65 @@
+#ifndef WIFIPROVISIONER_GZIP_WRITER_H
+#define WIFIPROVISIONER_GZIP_WRITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace wifiprov {
+
+/**
+ * @brief Updates a running CRC-32 (IEEE 802.3, as used by gzip) with `len`
+ * bytes. Start with crc = 0.
+ */
+uint32_t crc32Update(uint32_t crc, const uint8_t *data, size_t len);
+
+/**
+ * @brief Builds a single gzip member in a heap buffer.
+ *
+ * Data passed to deflate() is compressed with greedy LZ77 matching and the
+ * fixed Huffman tables from RFC 1951, which keeps the encoder small enough to
+ * run on the device. Every call ends on a byte boundary (sync flush), so
+ * separately compressed pieces, including ones precompressed at build time
+ * and added with appendDeflated(), can be concatenated into one stream.
+ *
+ * Any allocation failure poisons the writer; finish() then returns nullptr.
+ */
+class GzipWriter {
+public:
+  GzipWriter();
+  ~GzipWriter();
+
+  GzipWriter(const GzipWriter &) = delete;
+  GzipWriter &operator=(const GzipWriter &) = delete;
+
+  // Starts a new member, reserving `sizeHint` output bytes up front.
+  bool begin(size_t sizeHint);
+  // Compresses `len` bytes and appends them to the stream.
+  bool deflate(const uint8_t *data, size_t len);
+  // Appends an already compressed, sync-flushed raw deflate piece whose
+  // uncompressed form is `plain` (needed for the CRC and size trailer).
+  bool appendDeflated(const uint8_t *deflated, size_t deflatedLen,
+                      const uint8_t *plain, size_t plainLen);
+  // Closes the stream and hands the buffer to the caller (free() it).
+  uint8_t *finish(size_t *outLength);
+
+private:
+  bool reserve(size_t extra);
+  void putBits(uint32_t bits, uint8_t count);
+  void putHuffman(uint32_t code, uint8_t count);
+  void putLiteral(uint8_t value);
+  void putMatch(unsigned length, unsigned distance);
+  void alignToByte();
+
+  uint8_t *_buf;
+  size_t _length;
+  size_t _capacity;
+  uint32_t _bitBuffer;
+  uint8_t _bitCount;
+  uint32_t _crc;
+  uint32_t _inputSize;
+  bool _failed;
+};
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_GZIP_WRITER_H
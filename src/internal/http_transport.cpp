@@ -0,0 +1,26 @@
+#include "http_transport.h"
+#include "idle_waiter.h"
+#include <new>
+#include <stdlib.h>
+
+namespace wifiprov {
+
+SharedBuffer *SharedBuffer::adopt(uint8_t *data, size_t length) {
+  SharedBuffer *buffer = new (std::nothrow) SharedBuffer(data, length);
+  if (!buffer) {
+    free(data);
+  }
+  return buffer;
+}
+
+SharedBuffer::~SharedBuffer() { free(_data); }
+
+void SharedBuffer::release() {
+  if (--_refs == 0) {
+    delete this;
+  }
+}
+
+void HttpTransport::watchSockets(IdleWaiter &waiter) { waiter.watchBlind(); }
+
+} // namespace wifiprov
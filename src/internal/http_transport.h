@@ -0,0 +1,101 @@
+#ifndef WIFIPROVISIONER_HTTP_TRANSPORT_H
+#define WIFIPROVISIONER_HTTP_TRANSPORT_H
+
+#include <Print.h>
+#include <WString.h>
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace wifiprov {
+
+enum class HttpMethod : uint8_t { Get, Post };
+
+class IdleWaiter;
+
+/**
+ * @brief A malloc()ed buffer shared by reference count, so a response that
+ * is still being sent keeps the bytes alive after their owner replaced them.
+ * Not thread-safe: retain and release from the task that runs the server.
+ */
+class SharedBuffer {
+public:
+  // Takes ownership of `data`, which must come from malloc(). The caller
+  // holds the first reference. Frees `data` and returns null if out of memory.
+  static SharedBuffer *adopt(uint8_t *data, size_t length);
+
+  void retain() { ++_refs; }
+  void release();
+
+  const uint8_t *data() const { return _data; }
+  size_t length() const { return _length; }
+
+private:
+  SharedBuffer(uint8_t *data, size_t length) : _data(data), _length(length), _refs(1) {}
+  ~SharedBuffer();
+
+  uint8_t *_data;
+  size_t _length;
+  uint16_t _refs;
+};
+
+// What a finished response cost, for the debug log
+struct ResponseStats {
+  uint32_t bytes;    // Payload bytes sent or queued
+  uint32_t segments; // Socket writes so far
+};
+
+/**
+ * @brief The HTTP server the portal runs on. Handlers are plain callbacks
+ * that read the current request through the accessors below and answer it
+ * through beginResponse() / sendStable() / endResponse(). Responses are
+ * complete HTTP messages, status line and headers included.
+ */
+class HttpTransport {
+public:
+  using Handler = std::function<void()>;
+
+  virtual ~HttpTransport() {}
+
+  // Starts listening. False if the server could not be set up.
+  virtual bool begin() = 0;
+  virtual void end() = 0;
+  // Accepts, reads, dispatches and writes whatever is ready; never waits
+  // for a client that is not.
+  virtual void poll() = 0;
+  // Adds the sockets whose readiness means work for the next poll(). A
+  // backend that cannot expose them makes the wait back off instead.
+  virtual void watchSockets(IdleWaiter &waiter);
+
+  // False if the route could not be added (a full route table).
+  virtual bool on(const char *path, HttpMethod method, Handler handler) = 0;
+  virtual void onNotFound(Handler handler) = 0;
+  // Request headers the handlers read, besides Host.
+  virtual void collectHeaders(const char *const *names, size_t count) = 0;
+
+  // --- The request being handled ---
+  virtual String uri() = 0;
+  virtual String hostHeader() = 0;
+  virtual String header(const char *name) = 0;
+  // Query arguments; "plain" is the request body.
+  virtual bool hasArg(const char *name) = 0;
+  virtual String arg(const char *name) = 0;
+  // The request body, valid until the handler returns; null if it has none.
+  virtual const char *body(size_t *length) = 0;
+
+  // --- Its response ---
+  // Whether the connection stays open after this response. If so the
+  // response must say "Connection: keep-alive" and carry a Content-Length.
+  virtual bool keepAlive() = 0;
+  // Returns where to write the response, or null if the client is gone.
+  virtual Print *beginResponse() = 0;
+  // Appends a body that outlives the handler: flash, or a buffer pinned by
+  // `owner`. Multiplexed backends send it later without copying. Nothing
+  // may be written after it.
+  virtual void sendStable(const uint8_t *data, size_t length, SharedBuffer *owner = nullptr) = 0;
+  virtual ResponseStats endResponse() = 0;
+};
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_HTTP_TRANSPORT_H
@@ -0,0 +1,80 @@
+#include "idle_waiter.h"
+#include <Arduino.h>
+
+namespace wifiprov {
+
+IdleWaiter::IdleWaiter()
+    : _maxFd(-1), _busy(false), _blind(false), _backoffMs(1), _wakeups(0), _socketWakeups(0) {
+  FD_ZERO(&_read);
+  FD_ZERO(&_write);
+}
+
+void IdleWaiter::watchRead(int fd) {
+  if (fd < 0) {
+    return;
+  }
+  FD_SET(fd, &_read);
+  if (fd > _maxFd) {
+    _maxFd = fd;
+  }
+}
+
+void IdleWaiter::watchWrite(int fd) {
+  if (fd < 0) {
+    return;
+  }
+  FD_SET(fd, &_write);
+  if (fd > _maxFd) {
+    _maxFd = fd;
+  }
+}
+
+void IdleWaiter::wait(uint32_t maxIdleMs) {
+  ++_wakeups;
+  if (maxIdleMs == 0) {
+    delay(1);
+  } else {
+    uint32_t timeout = maxIdleMs;
+    if (_busy) {
+      timeout = 1;
+    } else if (_blind) {
+      timeout = _backoffMs < maxIdleMs ? _backoffMs : maxIdleMs;
+      _backoffMs = timeout * 2; // Back off while nothing happens
+    }
+
+    int ready;
+    if (_maxFd < 0) {
+      delay(timeout);
+      ready = 0;
+    } else {
+      timeval tv;
+      tv.tv_sec = timeout / 1000;
+      tv.tv_usec = (timeout % 1000) * 1000;
+      ready = select(_maxFd + 1, &_read, &_write, nullptr, &tv);
+    }
+    if (ready > 0) {
+      ++_socketWakeups;
+    }
+    if (ready > 0 || _busy) {
+      _backoffMs = 1;
+    }
+  }
+
+  FD_ZERO(&_read);
+  FD_ZERO(&_write);
+  _maxFd = -1;
+  _busy = false;
+  _blind = false;
+}
+
+uint32_t IdleWaiter::takeWakeups(uint32_t *socketWakeups) {
+  uint32_t wakeups = _wakeups;
+  if (socketWakeups) {
+    *socketWakeups = _socketWakeups;
+  }
+  _wakeups = 0;
+  _socketWakeups = 0;
+  return wakeups;
+}
+
+} // namespace wifiprov
@@ -0,0 +1,59 @@
+#ifndef WIFIPROVISIONER_IDLE_WAITER_H
+#define WIFIPROVISIONER_IDLE_WAITER_H
+
+#include <lwip/sockets.h>
+#include <stdint.h>
+
+namespace wifiprov {
+
+/**
+ * @brief Paces a polling server loop so it sleeps instead of spinning.
+ *
+ * Before each wait the loop adds the sockets it serves; wait() then blocks
+ * in select() until one has data (or, for a response still going out,
+ * room to write) or the caller's limit passes. The limit only bounds how
+ * late the loop notices work without a socket, such as a finished scan.
+ * The task blocks meanwhile, which lets the idle task (and light sleep,
+ * where power management is enabled) have the CPU.
+ *
+ * Work that cannot be watched this way makes the wait back off instead:
+ * 1 ms after any wakeup, doubling per quiet pass up to the limit.
+ */
+class IdleWaiter {
+public:
+  IdleWaiter();
+
+  IdleWaiter(const IdleWaiter &) = delete;
+  IdleWaiter &operator=(const IdleWaiter &) = delete;
+
+  // Ends the next wait after 1 ms at most, e.g. while a connect attempt
+  // has to be polled.
+  void noteActivity() { _busy = true; }
+  // Ends the next wait when `fd` has data, or room to write.
+  void watchRead(int fd);
+  void watchWrite(int fd);
+  // Some of the next pass's work has no socket to watch; back off.
+  void watchBlind() { _blind = true; }
+
+  // Sleeps until a watched socket is ready or `maxIdleMs` passes, then
+  // forgets what was watched. `maxIdleMs` == 0 keeps the old fixed 1 ms
+  // poll.
+  void wait(uint32_t maxIdleMs);
+
+  // Passes since the last call, and how many of them a socket ended.
+  uint32_t takeWakeups(uint32_t *socketWakeups = nullptr);
+
+private:
+  fd_set _read;
+  fd_set _write;
+  int _maxFd; // -1 while nothing is watched
+  bool _busy;
+  bool _blind;
+  uint32_t _backoffMs;
+  uint32_t _wakeups;
+  uint32_t _socketWakeups;
+};
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_IDLE_WAITER_H
@@ -0,0 +1,121 @@
+#include "json_writer.h"
+#include <stdio.h>
+
+namespace wifiprov {
+
+void JsonWriter::separate() {
+  if (_afterKey) {
+    _afterKey = false;
+    return;
+  }
+  if (_depth == 0) {
+    return;
+  }
+  uint32_t bit = 1u << (_depth - 1);
+  if (_hasItems & bit) {
+    _out.write(',');
+  }
+  _hasItems |= bit;
+}
+
+JsonWriter &JsonWriter::open(char bracket) {
+  separate();
+  _out.write(bracket);
+  if (_depth < 32) {
+    ++_depth;
+    _hasItems &= ~(1u << (_depth - 1));
+  }
+  return *this;
+}
+
+JsonWriter &JsonWriter::close(char bracket) {
+  _out.write(bracket);
+  if (_depth > 0) {
+    --_depth;
+  }
+  return *this;
+}
+
+JsonWriter &JsonWriter::key(const char *name) {
+  separate();
+  writeString(name);
+  _out.write(':');
+  _afterKey = true;
+  return *this;
+}
+
+JsonWriter &JsonWriter::value(const char *text) {
+  separate();
+  if (text) {
+    writeString(text);
+  } else {
+    _out.write((const uint8_t *)"null", 4);
+  }
+  return *this;
+}
+
+JsonWriter &JsonWriter::value(long number) {
+  separate();
+  char buf[24];
+  int len = snprintf(buf, sizeof(buf), "%ld", number);
+  _out.write((const uint8_t *)buf, len);
+  return *this;
+}
+
+JsonWriter &JsonWriter::value(unsigned long number) {
+  separate();
+  char buf[24];
+  int len = snprintf(buf, sizeof(buf), "%lu", number);
+  _out.write((const uint8_t *)buf, len);
+  return *this;
+}
+
+JsonWriter &JsonWriter::value(bool flag) {
+  separate();
+  if (flag) {
+    _out.write((const uint8_t *)"true", 4);
+  } else {
+    _out.write((const uint8_t *)"false", 5);
+  }
+  return *this;
+}
+
+void JsonWriter::writeString(const char *text) {
+  static const char hex[] = "0123456789abcdef";
+  _out.write('"');
+  const char *run = text;
+  const char *p = text;
+  for (; *p; ++p) {
+    uint8_t c = (uint8_t)*p;
+    if (c >= 0x20 && c != '"' && c != '\\' && c != '<') {
+      continue;
+    }
+    // Flush the plain run before the character that needs escaping
+    _out.write((const uint8_t *)run, p - run);
+    char escape[6] = {'\\', 0, 0, 0, 0, 0};
+    size_t len = 2;
+    switch (c) {
+    case '"': escape[1] = '"'; break;
+    case '\\': escape[1] = '\\'; break;
+    case '\n': escape[1] = 'n'; break;
+    case '\r': escape[1] = 'r'; break;
+    case '\t': escape[1] = 't'; break;
+    case '\b': escape[1] = 'b'; break;
+    case '\f': escape[1] = 'f'; break;
+    default:
+      escape[1] = 'u';
+      escape[2] = '0';
+      escape[3] = '0';
+      escape[4] = hex[c >> 4];
+      escape[5] = hex[c & 0x0F];
+      len = 6;
+      break;
+    }
+    _out.write((const uint8_t *)escape, len);
+    run = p + 1;
+  }
+  _out.write((const uint8_t *)run, p - run);
+  _out.write('"');
+}
+
+} // namespace wifiprov
@@ -0,0 +1,102 @@
+#ifndef WIFIPROVISIONER_JSON_WRITER_H
+#define WIFIPROVISIONER_JSON_WRITER_H
+
+#include <Print.h>
+#include <string.h>
+
+namespace wifiprov {
+
+/**
+ * @brief Writes JSON straight to a Print, with no document in between.
+ *
+ * Commas and nesting are tracked in a bit stack, so the writer holds no
+ * heap memory; nesting is limited to 32 levels. Strings are escaped per
+ * RFC 8259. '<' is written as \u003c as well, so output can be embedded in
+ * an HTML <script> element as is.
+ *
+ * To send a Content-Length, run the same emitting code once into a
+ * ByteCounter and once into the response.
+ */
+class JsonWriter {
+public:
+  explicit JsonWriter(Print &out) : _out(out), _depth(0), _hasItems(0), _afterKey(false) {}
+
+  JsonWriter &beginObject() { return open('{'); }
+  JsonWriter &endObject() { return close('}'); }
+  JsonWriter &beginArray() { return open('['); }
+  JsonWriter &endArray() { return close(']'); }
+
+  JsonWriter &key(const char *name);
+  JsonWriter &value(const char *text); // nullptr is written as null
+  JsonWriter &value(long number);
+  JsonWriter &value(unsigned long number);
+  JsonWriter &value(int number) { return value((long)number); }
+  JsonWriter &value(unsigned int number) { return value((unsigned long)number); }
+  JsonWriter &value(bool flag);
+
+  template <typename T> JsonWriter &member(const char *name, T v) {
+    key(name);
+    return value(v);
+  }
+
+private:
+  JsonWriter &open(char bracket);
+  JsonWriter &close(char bracket);
+  void separate();
+  void writeString(const char *text);
+
+  Print &_out;
+  uint8_t _depth;
+  uint32_t _hasItems; // bit n: level n already has an element
+  bool _afterKey;
+};
+
+/**
+ * @brief A Print that only counts what is written to it.
+ */
+class ByteCounter : public Print {
+public:
+  ByteCounter() : _count(0) {}
+  size_t write(uint8_t) override {
+    ++_count;
+    return 1;
+  }
+  size_t write(const uint8_t *, size_t len) override {
+    _count += len;
+    return len;
+  }
+  using Print::write;
+  size_t count() const { return _count; }
+
+private:
+  size_t _count;
+};
+
+/**
+ * @brief A Print into a fixed caller-owned buffer. Bytes past its end are
+ * dropped, so a length other than the measured one means an overflow.
+ */
+class BufferPrint : public Print {
+public:
+  BufferPrint(uint8_t *buffer, size_t capacity) : _buffer(buffer), _capacity(capacity), _length(0) {}
+  size_t write(uint8_t byte) override { return write(&byte, 1); }
+  size_t write(const uint8_t *data, size_t len) override {
+    if (len > _capacity - _length) {
+      len = _capacity - _length;
+    }
+    memcpy(_buffer + _length, data, len);
+    _length += len;
+    return len;
+  }
+  using Print::write;
+  size_t length() const { return _length; }
+
+private:
+  uint8_t *_buffer;
+  size_t _capacity;
+  size_t _length;
+};
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_JSON_WRITER_H
@@ -0,0 +1,77 @@
+#include "network_list.h"
+#include <string.h>
+
+namespace wifiprov {
+
+void NetworkList::clear(size_t limit) {
+  _count = 0;
+  _limit = (limit == 0 || limit > kCapacity) ? kCapacity : limit;
+}
+
+void NetworkList::add(const uint8_t *ssid, int8_t rssi, bool secured,
+                      uint8_t channel, const uint8_t *bssid) {
+  const char *name = (const char *)ssid;
+  if (!name[0]) {
+    return; // Hidden network; the page has its own field for those
+  }
+
+  NetworkEntry *slot = nullptr;
+  for (size_t i = 0; i < _count; ++i) {
+    if (strncmp(_entries[i].ssid, name, sizeof(_entries[i].ssid)) == 0) {
+      if (rssi <= _entries[i].rssi) {
+        return; // Already have a stronger access point for this SSID
+      }
+      slot = &_entries[i];
+      break;
+    }
+  }
+
+  if (!slot) {
+    if (_count < _limit) {
+      slot = &_entries[_count++];
+    } else {
+      // Full: replace the weakest entry if this one beats it
+      NetworkEntry *weakest = &_entries[0];
+      for (size_t i = 1; i < _count; ++i) {
+        if (_entries[i].rssi < weakest->rssi) {
+          weakest = &_entries[i];
+        }
+      }
+      if (rssi <= weakest->rssi) {
+        return;
+      }
+      slot = weakest;
+    }
+    strncpy(slot->ssid, name, sizeof(slot->ssid) - 1);
+    slot->ssid[sizeof(slot->ssid) - 1] = '\0';
+  }
+
+  slot->rssi = rssi;
+  slot->secured = secured;
+  slot->channel = channel;
+  memcpy(slot->bssid, bssid, sizeof(slot->bssid));
+}
+
+void NetworkList::sort() {
+  // Insertion sort; the table is small and usually nearly ordered
+  for (size_t i = 1; i < _count; ++i) {
+    NetworkEntry entry = _entries[i];
+    size_t j = i;
+    while (j > 0 && _entries[j - 1].rssi < entry.rssi) {
+      _entries[j] = _entries[j - 1];
+      --j;
+    }
+    _entries[j] = entry;
+  }
+}
+
+const NetworkEntry *NetworkList::find(const char *ssid) const {
+  for (size_t i = 0; i < _count; ++i) {
+    if (strncmp(_entries[i].ssid, ssid, sizeof(_entries[i].ssid)) == 0) {
+      return &_entries[i];
+    }
+  }
+  return nullptr;
+}
+
+} // namespace wifiprov
@@ -0,0 +1,59 @@
+#ifndef WIFIPROVISIONER_NETWORK_LIST_H
+#define WIFIPROVISIONER_NETWORK_LIST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace wifiprov {
+
+// Upper bound for Config::MAX_NETWORKS; sizes the fixed scan table.
+#ifndef WIFI_PROVISIONER_MAX_NETWORKS
+#define WIFI_PROVISIONER_MAX_NETWORKS 32
+#endif
+
+/**
+ * @brief One SSID from a scan, represented by its strongest access point.
+ * `channel` and `bssid` are kept so a connect can go straight to that AP.
+ */
+struct NetworkEntry {
+  char ssid[33];
+  int8_t rssi;
+  uint8_t channel;
+  uint8_t bssid[6];
+  bool secured;
+};
+
+/**
+ * @brief Scan results merged by SSID, strongest first, in a fixed table.
+ *
+ * add() keeps one entry per SSID at its best RSSI. Once `limit` SSIDs are
+ * held, a new one only gets in by displacing the weakest, so the table
+ * always holds the strongest networks seen no matter how many access
+ * points the scan returned.
+ */
+class NetworkList {
+public:
+  static constexpr size_t kCapacity = WIFI_PROVISIONER_MAX_NETWORKS;
+
+  NetworkList() : _count(0), _limit(kCapacity) {}
+
+  // Empties the list and sets how many SSIDs it keeps (clamped to kCapacity).
+  void clear(size_t limit);
+  void add(const uint8_t *ssid, int8_t rssi, bool secured, uint8_t channel,
+           const uint8_t *bssid);
+  // Orders the entries by RSSI, strongest first.
+  void sort();
+
+  const NetworkEntry *find(const char *ssid) const;
+  size_t size() const { return _count; }
+  const NetworkEntry &operator[](size_t i) const { return _entries[i]; }
+
+private:
+  NetworkEntry _entries[kCapacity];
+  size_t _count;
+  size_t _limit;
+};
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_NETWORK_LIST_H
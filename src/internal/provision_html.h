@@ -1,1490 +1,1207 @@
+// Generated by extras/tools/build_portal_assets.py from extras/portal.
+// Do not edit by hand; change the source and re-run the script.
 #ifndef PROVISION_HTML_H
 #define PROVISION_HTML_H
 
 #include <Arduino.h>
 
-// HTML content is broken into parts to avoid compiler limits and allow injection.
-
-// Part 1: Head and start of body/styles
-static constexpr const char index_html1[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-  <head>
-    <title>)rawliteral";
-// Config: HTML_TITLE injected here
-static constexpr const char index_html2[] PROGMEM = R"rawliteral(</title>
-    <meta charset="UTF-8" />
-    <meta
-      name="viewport"
-      content="width=device-width, initial-scale=1.0, maximum-scale=1"
-    />
-    <style>
-      :root {
-        --card-background: #ffffff;
-        --background-color: #f9f9f9;
-        --font-color: #1a1f36;
-        --theme-color: )rawliteral";
-// Config: THEME_COLOR injected here
-static constexpr const char index_html3[] PROGMEM = R"rawliteral(;
-        --shadow-color: rgba(0, 0, 0, 0.1);
-        --border-color: #cccccc;
-        /* Define theme color RGB parts for focus ring */
-         --theme-color-r: 30; /* Default: dodgerblue */
-         --theme-color-g: 144;
-         --theme-color-b: 255;
-      }
-
-      /* ... (Rest of CSS is unchanged from previous correct version) ... */
-       * {
-        font-family: Poppins, sans-serif;
-        color: var(--font-color);
-      }
-
-      body {
-        touch-action: manipulation;
-        color: var(--font-color);
-        background-color: var(--background-color);
-        margin: 2rem 0;
-        display: flex;
-        flex-direction: column;
-        align-items: center;
-        justify-content: center;
-        min-height: 100vh;
-        box-sizing: border-box; /* Prevent padding/margins from causing overflow */
-      }
-
-      table {
-        border-collapse: collapse;
-        width: 100%;
-        margin-bottom: 0.5rem;
-        margin-top: 0.5rem;
-      }
-
-      th,
-      td {
-        padding: 0.75rem;
-        text-align: left;
-        vertical-align: middle; /* Align radio buttons nicely */
-      }
-
-      th {
-        font-weight: bold;
-        color: #333333;
-      }
-
-      .header {
-        text-align: center;
-        width: 100%; /* Ensure header takes full width */
-        padding: 0 1rem; /* Add some padding */
-        box-sizing: border-box;
-      }
-
-      /* Radio Button Styles */
-      @supports (-webkit-appearance: none) or (-moz-appearance: none) {
-        input[type="radio"] {
-          --active: var(--theme-color);
-          --active-inner: var(--card-background);
-          --border: var(--border-color); /* Use variable */
-          --border-hover: var(--theme-color);
-          --background: var(--card-background);
-          -webkit-appearance: none;
-          -moz-appearance: none;
-          height: 1.3125rem;
-          outline: none;
-          display: inline-block;
-          vertical-align: middle;
-          position: relative;
-          margin: 0;
-          cursor: pointer;
-          border: 1px solid var(--bc, var(--border)); /* Use variable */
-          background: var(--b, var(--background));
-          transition: background 0.3s, border-color 0.3s, box-shadow 0.2s;
-          -webkit-tap-highlight-color: transparent; /* Remove tap highlight */
-        }
-        input[type="radio"]:after {
-            content: '';
-            display: block;
-            left: 0;
-            top: 0;
-            position: absolute;
-            transition: transform .3s ease, opacity .2s ease;
-        }
-        input[type="radio"]:checked {
-            --b: var(--active);
-            --bc: var(--active);
-            --d-o: .3s;
-            --d-t: .6s;
-            --d-t-e: cubic-bezier(.2, .85, .32, 1.2);
-        }
-        input[type="radio"]:disabled {
-            --b: var(--disabled-inner); /* Adjust disabled appearance if needed */
-            cursor: not-allowed;
-            opacity: .7; /* Slightly faded */
-         }
-        input[type="radio"]:disabled:checked {
-            --b: var(--disabled);
-            --bc: var(--border); /* Keep border */
-         }
-        input[type="radio"]:disabled + label {
-            cursor: not-allowed;
-        }
-        input[type="radio"]:hover:not(:checked):not(:disabled) {
-           --bc: var(--border-hover);
-        }
-        input[type="radio"]:focus {
-          box-shadow: 0 0 0 2px rgba(var(--theme-color-r), var(--theme-color-g), var(--theme-color-b), 0.2);
-         }
-        input[type="radio"]:not(.switch) {
-          width: 1.3125rem; /* Match height */
-        }
-        input[type="radio"]:not(.switch):after {
-            opacity: var(--o, 0);
-         }
-         input[type="radio"]:not(.switch):checked {
-            --o: 1;
-         }
-
-        input[type="radio"] + label {
-          font-size: 1em; /* Adjust label size */
-          line-height: 1.3125rem; /* Match radio height */
-          display: inline-block; /* Keep label inline */
-          vertical-align: middle;
-          cursor: pointer;
-          margin-left: .5rem; /* Space between radio and label */
-        }
-
-
-         /* Specific styles for circle radio */
-        input[type="radio"].circle { /* Added class for clarity */
-            border-radius: 50%;
-        }
-        input[type="radio"].circle:after {
-            width: 1.3125rem; /* Match radio size */
-            height: 1.3125rem;
-            border-radius: 50%;
-            background: var(--active-inner);
-            opacity: 0;
-            transform: scale(0.7); /* Inner circle smaller */
-            box-sizing: border-box; /* Include border in size */
-            border: 2px solid var(--active-inner); /* Match background */
-        }
-         input[type="radio"].circle:checked:after {
-            background: var(--active); /* Fill with active color */
-             border-color: var(--active-inner); /* Border contrasts */
-            opacity: 1;
-            transform: scale(0.5); /* Adjust final size */
-        }
-
-
-      }
-
-      @supports (not (-webkit-appearance: none)) and
-        (not (-moz-appearance: none)) {
-        input[type="radio"]:checked {
-          accent-color: var(--theme-color);
-        }
-      }
-
-
-      a:disabled,
-      input:disabled,
-      button:disabled {
-        cursor: not-allowed;
-        pointer-events: none;
-        opacity: 0.5;
-      }
-
-      .signal,
-      .radiossid {
-        text-align: center;
-      }
-
-      .card {
-        background-color: var(--card-background);
-        box-shadow: 0 0.25rem 0.75rem var(--shadow-color);
-        border-radius: 0.75rem;
-        max-width: 50rem;
-        width: calc(100% - 2rem); /* Reduced margin for smaller screens */
-        padding: 1.5rem; /* Slightly reduced padding */
-        margin: 1rem auto; /* Center card horizontally */
-        text-align: center;
-        box-sizing: border-box;
-      }
-
-      .container {
-        padding-top: 1.25rem;
-        text-align: center;
-      }
-
-      #hidden-network-selector {
-        /* Adjusted margins for better spacing */
-        margin: 1rem 10% 0;
-        text-align: left;
-      }
-       #hidden-network-selector p { /* Style the label text */
-          margin-bottom: 0.5rem;
-          font-weight: bold;
-      }
-      #hidden-network-selector div { /* Style the radio container */
-          display: flex;
-          align-items: center;
-      }
-       #hidden-network-selector input[type="radio"] { /* Add margin to radio */
-          margin-right: 0.5rem;
-      }
-
-      .icon_button {
-        -webkit-tap-highlight-color: transparent;
-        background-color: transparent;
-        background-repeat: no-repeat;
-        border: none;
-        cursor: pointer;
-        overflow: hidden;
-        outline: none;
-        padding: 0; /* Remove default padding */
-        vertical-align: middle; /* Align icon better */
-      }
-
-      .icn-spinner {
-        animation: spin-animation 0.5s infinite linear; /* Added linear */
-        display: inline-block;
-      }
-
-      @keyframes spin-animation {
-        0% {
-          transform: rotate(0deg);
-        }
-
-        100% {
-          transform: rotate(359deg);
-        }
-      }
-
-      .textinput {
-        width: 100%; /* Make inputs take full width of container */
-        box-sizing: border-box;
-        /* max-width: 18.75rem; remove max width */
-        padding: 0.75rem; /* Increased padding */
-        border: 1px solid var(--border-color); /* Thinner border */
-        -webkit-border-radius: 0.3125rem;
-        border-radius: 0.3125rem;
-        -webkit-transition: 0.5s;
-        transition: 0.5s;
-        outline: none;
-        margin-top: 0.25rem; /* Add space below label */
-      }
-      
-      /* Specific padding for password to accommodate eye icon */
-      .password-container input[type="password"],
-      .password-container input[type="text"] {
-           padding-right: 2.5rem; /* Make space for the icon */
-      }
-
-
-      /* Container for password input and eye icon */
-      .password-container {
-        position: relative;
-        width: 75%; /* Match other inputs */
-        max-width: 18.75rem; /* Re-apply max-width here */
-        margin: 0 auto; /* Center the container */
-      }
-
-      .password-container .icon_button {
-          position: absolute;
-          right: 0.5rem; /* Position icon inside */
-          top: 50%;
-          transform: translateY(-50%); /* Center vertically */
-          height: 100%; /* Ensure button is clickable */
-          display: flex; /* Use flex to center svg */
-          align-items: center;
-      }
-
-
-      .textinput:focus {
-        border-color: var(--theme-color);
-        box-shadow: 0 0 0 2px rgba(var(--theme-color-r), var(--theme-color-g), var(--theme-color-b), 0.2);
-      }
-
-      label {
-        display: block;
-        font-size: 0.9rem;
-        font-weight: bold; /* Make labels bolder */
-        padding-bottom: 0.125rem;
-        text-align: left; /* Align labels left */
-        width: 75%; /* Match input width */
-        max-width: 18.75rem; /* Match input width */
-        margin: 0 auto; /* Center label */
-      }
-      /* Specific label override for radio buttons */
-      td label, #hidden-network-selector label {
-         width: auto;
-         margin: 0;
-         font-weight: normal;
-         cursor: pointer;
-         display: inline; /* Keep label inline with radio */
-         text-align: left;
-      }
-
-
-      #footer .copyright {
-        width: 100%;
-        margin: 2.5em 0 2em 0;
-        font-size: 0.8em;
-        text-align: center;
-      }
-
-      .error-message {
-        color: #cc0033;
-        display: block;
-        font-size: 0.75rem;
-        line-height: 0.9375rem;
-        margin: 0.3125rem auto 0; /* Center error message */
-        text-align: left; /* Align text left */
-        width: 75%; /* Match input width */
-        max-width: 18.75rem; /* Match input width */
-        min-height: 0.9375rem; /* Reserve space */
-      }
-
-      .error input[type="text"],
-      .error input[type="password"] {
-        background-color: #fce4e4;
-        border-color: #cc0033;
-      }
-
-      .btn-process {
-        -webkit-tap-highlight-color: transparent;
-        background-color: var(--theme-color);
-        box-shadow: 0 0.25rem 0.5rem var(--shadow-color),
-          0 0.5rem 1.5rem var(--shadow-color);
-        font-size: 1rem;
-        font-weight: bold; /* Bolder text */
-        border: none;
-        outline: none;
-        padding: 0.75rem 1.5rem; /* More padding */
-        border-radius: 0.3125rem;
-        color: #fff;
-        cursor: pointer;
-        transition: background-color 0.2s ease, transform 0.1s ease; /* Add transitions */
-      }
-      .btn-process:hover:not(:disabled) {
-           background-color: color-mix(in srgb, var(--theme-color) 85%, black); /* Darken on hover */
-      }
-       .btn-process:active:not(:disabled) {
-           transform: translateY(1px); /* Press down effect */
-           box-shadow: 0 0.1rem 0.3rem var(--shadow-color);
-      }
-
-
-      .connect-header {
-        margin-top: 0rem;
-        margin-bottom: 1rem; /* Add space below header */
-        padding: 0;
-        text-align: center;
-      }
-
-      /* Spinner animation (unchanged) */
-      #connecting-ring:after {
-        content: "";
-        display: inline-block;
-        width: 1em;
-        margin-left: 0.5rem;
-        height: 1em;
-        vertical-align: middle;
-        border-radius: 50%;
-        border: 0.1875rem solid #fff;
-        border-color: #fff transparent #fff transparent;
-        animation: ring 1.2s linear infinite;
-      }
-
-      @keyframes ring {
-        0% {
-          transform: rotate(0deg);
-        }
-
-        100% {
-          transform: rotate(360deg);
-        }
-      }
-      
-       /* Success Checkmark animation (unchanged) */
-      .wrapper {
-        display: flex;
-        justify-content: center;
-        align-items: center;
-      }
-
-      .checkmark__circle {
-        stroke-dasharray: 166;
-        stroke-dashoffset: 166;
-        stroke-width: 2;
-        stroke-miterlimit: 10;
-        stroke: #7ac142;
-        fill: none;
-        animation: stroke 0.6s cubic-bezier(0.65, 0, 0.45, 1) forwards;
-      }
-
-      .checkmark {
-        width: 3.5rem;
-        height: 3.5rem;
-        border-radius: 50%;
-        display: block;
-        stroke-width: 2;
-        stroke: #fff;
-        stroke-miterlimit: 10;
-        margin-top: 3rem;
-        box-shadow: inset 0rem 0rem 0rem #7ac142;
-        animation: fill 0.4s ease-in-out 0.4s forwards,
-          scale 0.3s ease-in-out 0.9s both;
-      }
-
-      .checkmark__check {
-        transform-origin: 50% 50%;
-        stroke-dasharray: 48;
-        stroke-dashoffset: 48;
-        animation: stroke 0.3s cubic-bezier(0.65, 0, 0.45, 1) 0.8s forwards;
-      }
-
-      @keyframes stroke {
-        100% {
-          stroke-dashoffset: 0;
-        }
-      }
-
-      @keyframes scale {
-        0%,
-        100% {
-          transform: none;
-        }
-
-        50% {
-          transform: scale3d(1.1, 1.1, 1);
-        }
-      }
-
-      @keyframes fill {
-        100% {
-          box-shadow: inset 0rem 0rem 0rem 1.875rem #7ac142;
-        }
-      }
-      
-      /* Media Query for smaller screens */
-       @media (max-width: 600px) {
-           body {
-               margin: 1rem 0; /* Reduce body margin */
-           }
-           .card {
-               width: calc(100% - 1rem); /* Make card almost full width */
-               padding: 1rem; /* Reduce card padding */
-               margin: 0.5rem auto;
-           }
-            .textinput, label, .error-message, .password-container {
-               width: 90%; /* Increase width for inputs/labels */
-               max-width: none; /* Remove max-width */
-           }
-            #hidden-network-selector {
-               margin: 1rem 5% 0; /* Adjust margins */
-           }
-            th, td {
-                padding: 0.5rem; /* Reduce table padding */
-            }
-       }
-    </style>
-  </head>
-
-  <body>
-    <div class="header">
-      <div id="logo-container">)rawliteral";
-// Config: SVG_LOGO injected here
-static constexpr const char index_html4[] PROGMEM = R"rawliteral(</div>
-      <h2 id="app-title" style="margin-top: 0.5rem; margin-bottom: 0rem"></h2>
-      <h4 id="app-subtitle" style="margin-top: 0.2rem"></h4>
-      <p
-        id="info-text"
-        style="
-          opacity: 0.5;
-          word-wrap: break-word;
-          overflow-wrap: break-word;
-          max-width: 90%;
-          margin: 0 auto;
-          text-align: center;
-        "
-      ></p>
-    </div>
-    <div id="main-card" class="card">
-      <form id="network_form" name="network_form">
-        <h3 class="connect-header">Connect to Wifi</h3>
-        <div style="overflow-x: auto">
-          <table>
-            <thead>
-              <tr>
-                <th class="radiossid">
-                  <button
-                    class="icon_button"
-                    type="button"
-                    title="Refresh Network List"
-                    onclick="loadSSID();"
-                  >
-                    <svg
-                      xmlns="http://www.w3.org/2000/svg"
-                      id="refresh-icon"
-                      style="vertical-align: -0.125em"
-                      width="1em"
-                      height="1em"
-                      preserveaspectratio="xMidYMid meet"
-                      viewbox="0 0 1536 1536"
-                    >
-                      <path
-                        fill="var(--font-color)"
-                        d="M1511 928q0 5-1 7q-64 268-268 434.5T764 1536q-146 0-282.5-55T238 1324l-129 129q-19 19-45 19t-45-19t-19-45V960q0-26 19-45t45-19h448q26 0 45 19t19 45t-19 45l-137 137q71 66 161 102t187 36q134 0 250-65t186-179q11-17 53-117q8-23 30-23h192q13 0 22.5 9.5t9.5 22.5zm25-800v448q0 26-19 45t-45 19h-448q-26 0-45-19t-19-45t19-45l138-138Q969 256 768 256q-134 0-250 65T332 500q-11 17-53 117q-8 23-30 23H50q-13 0-22.5-9.5T18 608v-7q65-268 270-434.5T768 0q146 0 284 55.5T1297 212l130-129q19-19 45-19t45 19t19 45z"
-                      ></path>
-                    </svg>
-                  </button>
-                </th>
-                <th>SSID</th>
-                <th class="signal">Signal</th>
-              </tr>
-            </thead>
-            <tbody id="table-body">
-              <!-- Network rows will be inserted here by JS -->
-              <tr><td colspan="3" style="text-align: center; color: grey;">Initializing...</td></tr> <!-- Initial placeholder -->
-            </tbody>
-          </table>
-        </div>
-        <div id="hidden-network-selector">
-          <p>Hidden Network?</p>
-          <div>
-            <input
-              type="radio"
-              id="hiddennetwork_radio"
-              name="ssid"
-              value="hiddennetwork"
-              class="circle"
-              onclick="onRadio(this);"
-            />
-             <label for="hiddennetwork_radio">Specify Hidden Network</label>
-          </div>
-        </div>
-        <div class="container" id="hiddenNetwork" style="display: none">
-          <label for="ssid">Network SSID</label>
-          <div id="error-ssid-input">
-            <input
-              type="text"
-              name="hidden_ssid"
-              id="ssid"
-              class="textinput"
-              placeholder="SSID"
-              aria-label="Hidden Network SSID"
-            />
-            <div id="error-ssid-message" class="error-message"></div>
-          </div>
-        </div>
-        <div class="container" id="hiddenPassword" style="display: none">
-          <label for="password">Network Password</label>
-          <div id="error-password-input" class="password-container">
-            <input
-              type="password"
-              name="password"
-              id="password"
-              class="textinput"
-              placeholder="Password"
-              aria-label="Network Password"
-            />
-            <button
-                class="icon_button"
-                type="button"
-                title="Show/Hide Password"
-                onclick="togglePassShow('password', 'eye_icon');"
-              >
-                <svg
-                  xmlns="http://www.w3.org/2000/svg"
-                  style="vertical-align: middle;" width="1em" height="1em"
-                  preserveaspectratio="xMidYMid meet"
-                  viewbox="0 0 24 24"
-                >
-                  <path
-                    id="eye_icon"
-                    fill="var(--font-color)"
-                    d="M10.94 6.08A6.93 6.93 0 0 1 12 6c3.18 0 6.17 2.29 7.91 6a15.23 15.23 0 0 1-.9 1.64a1 1 0 0 0-.16.55a1 1 0 0 0 1.86.5a15.77 15.77 0 0 0 1.21-2.3a1 1 0 0 0 0-.79C19.9 6.91 16.1 4 12 4a7.77 7.77 0 0 0-1.4.12a1 1 0 1 0 .34 2ZM3.71 2.29a1 1 0 0 0-1.42 1.42l3.1 3.09a14.62 14.62 0 0 0-3.31 4.8a1 1 0 0 0 0 .8C4.1 17.09 7.9 20 12 20a9.26 9.26 0 0 0 5.05-1.54l3.24 3.25a1 1 0 0 0 1.42 0a1 1 0 0 0 0-1.42Zm6.36 9.19l2.45 2.45A1.81 1.81 0 0 1 12 14a2 2 0 0 1-2-2a1.81 1.81 0 0 1 .07-.52ZM12 18c-3.18 0-6.17-2.29-7.9-6a12.09 12.09 0 0 1 2.7-3.79L8.57 10A4 4 0 0 0 14 15.43L15.59 17A7.24 7.24 0 0 1 12 18Z"
-                  ></path>
-                </svg></button
-            >
-          </div>
-          <div id="error-password-message" class="error-message"></div>
-        </div>
-)rawliteral"; // End of index_html7
-
-// --- Reinstated index_html8 for the code input block ---
-static constexpr const char index_html8[] PROGMEM = R"rawliteral(
-        <!-- Device Key Input Block -->
-        <div class="container" id="codeinputBlock" style="display: none">
-          <label id="label-code" for="code"></label> <!-- Label text set by JS -->
-          <div id="error-code-input">
-            <input
-              type="text"
-              name="code"
-              id="code"
-              class="textinput"
-              placeholder="" <!-- Placeholder set by JS -->
-              aria-label="Device Key"
-               maxlength="4" <!-- Maxlength set by JS constant -->
-            />
-          </div>
-          <div id="error-code-message" class="error-message"></div>
-        </div>
-)rawliteral"; // End of index_html8
-
-// --- index_html9_part1 is now empty, effectively merged into index_html8 ---
-// static constexpr const char index_html9_part1[] PROGMEM = R"rawliteral()rawliteral";
-
-// --- Username block ---
-static constexpr const char index_html9_username_block[] PROGMEM = R"rawliteral(
-        <!-- Service Username Input Block -->
-        <div class="container" id="loginFieldsBlock" style="display: none">
-          <label id="label-username" for="username"></label> <!-- Label text set by JS -->
-          <div id="error-username-input">
-            <input
-              type="text"
-              name="username"
-              id="username"
-              class="textinput"
-              placeholder="" <!-- Placeholder set by JS -->
-              aria-label="Service Username"
-            />
-          </div>
-          <div id="error-username-message" class="error-message"></div>
-        </div>
-)rawliteral";
-
-// --- Service password block ---
-static constexpr const char index_html9_service_password_block[] PROGMEM =
-    R"rawliteral(
-        <!-- Service Password Input Block -->
-        <div class="container" id="servicePasswordBlock" style="display: none">
-          <label id="label-service-password" for="service_password"></label> <!-- Label text set by JS -->
-          <div id="error-service_password-input" class="password-container">
-            <input
-              type="password"
-              name="service_password"
-              id="service_password"
-              class="textinput"
-              placeholder="" <!-- Placeholder set by JS -->
-              aria-label="Service Password"
-            />
-             <button
-                class="icon_button"
-                type="button"
-                title="Show/Hide Service Password"
-                onclick="togglePassShow('service_password', 'service_eye_icon');"
-              >
-                <svg
-                  xmlns="http://www.w3.org/2000/svg"
-                   style="vertical-align: middle;" width="1em" height="1em"
-                  preserveaspectratio="xMidYMid meet"
-                  viewbox="0 0 24 24"
-                >
-                  <path
-                    id="service_eye_icon"
-                    fill="var(--font-color)"
-                    d="M10.94 6.08A6.93 6.93 0 0 1 12 6c3.18 0 6.17 2.29 7.91 6a15.23 15.23 0 0 1-.9 1.64a1 1 0 0 0-.16.55a1 1 0 0 0 1.86.5a15.77 15.77 0 0 0 1.21-2.3a1 1 0 0 0 0-.79C19.9 6.91 16.1 4 12 4a7.77 7.77 0 0 0-1.4.12a1 1 0 1 0 .34 2ZM3.71 2.29a1 1 0 0 0-1.42 1.42l3.1 3.09a14.62 14.62 0 0 0-3.31 4.8a1 1 0 0 0 0 .8C4.1 17.09 7.9 20 12 20a9.26 9.26 0 0 0 5.05-1.54l3.24 3.25a1 1 0 0 0 1.42 0a1 1 0 0 0 0-1.42Zm6.36 9.19l2.45 2.45A1.81 1.81 0 0 1 12 14a2 2 0 0 1-2-2a1.81 1.81 0 0 1 .07-.52ZM12 18c-3.18 0-6.17-2.29-7.9-6a12.09 12.09 0 0 1 2.7-3.79L8.57 10A4 4 0 0 0 14 15.43L15.59 17A7.24 7.24 0 0 1 12 18Z"
-                  ></path>
-                </svg></button
-            >
-          </div>
-          <div id="error-service_password-message" class="error-message"></div>
-        </div>
-)rawliteral";
-
-// --- Part 2: Submit button and start of footer ---
-static constexpr const char index_html9_part2[] PROGMEM = R"rawliteral(
-        <!-- Submit Button -->
-        <div class="container">
-          <button
-            class="btn-process"
-            id="submit-btn"
-            type="submit"
-            form="network_form"
-          >
-            Connect <span id="connecting-ring" style="display: none"></span>
-          </button>
-          <div id="error-submit-message" class="error-message"></div>
-        </div>
-      </form>
-    </div>
-    
-    <!-- Footer -->
-    <footer id="footer">
-      <p class="copyright" style="opacity: 0.5">
-        <a
-          role="link"
-          style="color: inherit; -webkit-tap-highlight-color: transparent;"
-          id="factorylink"
-          href="javascript:factoryReset()"
-          >Factory Reset</a
-        >
-      </p>
-      <p id="copyright" class="copyright" style="opacity: 0.5"></p> <!-- Footer text injected via JS -->
-    </footer>
-    
-    <!-- JavaScript Section -->
-    <script>
-      // --- SVG Icons ---
-      const svgs = {
-        10: `d="m6.67 14.86l3.77 4.7c.8 1 2.32 1 3.12 0l3.78-4.7C17.06 14.65 15.03 13 12 13s-5.06 1.65-5.33 1.86z"/><path fill="var(--font-color)" fill-opacity=".3" d="M23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0L23.64 7z"/></svg>`,
-        11: `fill-opacity=".3" d="M15.5 14.5c0-2.8 2.2-5 5-5c.36 0 .71.04 1.05.11L23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0l1.94-2.42V14.5z"/><path fill="var(--font-color)" d="M15.5 14.5c0-.23.04-.46.07-.68c-.92-.43-2.14-.82-3.57-.82c-3 0-5.1 1.7-5.3 1.9l3.74 4.66c.8 1 2.32 1 3.12 0l1.94-2.42V14.5zM23 16v-1.5c0-1.4-1.1-2.5-2.5-2.5S18 13.1 18 14.5V16c-.5 0-1 .5-1 1v4c0 .5.5 1 1 1h5c.5 0 1-.5 1-1v-4c0-.5-.5-1-1-1zm-1 0h-3v-1.5c0-.8.7-1.5 1.5-1.5s1.5.7 1.5 1.5V16z"/></svg>`,
-        20: `fill-opacity=".3" d="M23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0L23.64 7z"/><path fill="var(--font-color)" d="m4.79 12.52l5.65 7.04c.8 1 2.32 1 3.12 0l5.65-7.05C18.85 12.24 16.1 10 12 10s-6.85 2.24-7.21 2.52z"/></svg>`,
-        21: `fill-opacity=".3" d="M15.5 14.5c0-2.8 2.2-5 5-5c.36 0 .71.04 1.05.11L23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0l1.94-2.42V14.5z"/><path fill="var(--font-color)" d="M15.5 14.5c0-1.34.51-2.53 1.34-3.42C15.62 10.51 13.98 10 12 10c-4.1 0-6.8 2.2-7.2 2.5l5.64 7.05c.8 1 2.32 1 3.12 0l1.94-2.42V14.5zM23 16v-1.5c0-1.4-1.1-2.5-2.5-2.5S18 13.1 18 14.5V16c-.5 0-1 .5-1 1v4c0 .5.5 1 1 1h5c.5 0 1-.5 1-1v-4c0-.5-.5-1-1-1zm-1 0h-3v-1.5c0-.8.7-1.5 1.5-1.5s1.5.7 1.5 1.5V16z"/></svg>`,
-        30: `fill-opacity=".3" d="M23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0L23.64 7z"/><path fill="var(--font-color)" d="m3.53 10.95l6.91 8.61c.8 1 2.32 1 3.12 0l6.91-8.61C20.04 10.62 16.81 8 12 8s-8.04 2.62-8.47 2.95z"/></svg>`,
-        31: `fill-opacity=".3" d="M15.5 14.5c0-2.8 2.2-5 5-5c.36 0 .71.04 1.05.11L23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0l1.94-2.42V14.5z"/><path fill="var(--font-color)" d="M15.5 14.5a4.92 4.92 0 0 1 3.27-4.68C17.29 8.98 14.94 8 12 8c-4.81 0-8.04 2.62-8.47 2.95l6.91 8.61c.8 1 2.32 1 3.12 0l1.94-2.42V14.5zM23 16v-1.5c0-1.4-1.1-2.5-2.5-2.5S18 13.1 18 14.5V16c-.5 0-1 .5-1 1v4c0 .5.5 1 1 1h5c.5 0 1-.5 1-1v-4c0-.5-.5-1-1-1zm-1 0h-3v-1.5c0-.8.7-1.5 1.5-1.5s1.5.7 1.5 1.5V16z"/></svg>`,
-        40: `d="M23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0L23.64 7z"/></svg>`,
-        41: `d="M23.21 8.24C20.22 5.6 16.3 4 12 4S3.78 5.6.79 8.24C.35 8.63.32 9.3.73 9.71l5.62 5.63l4.94 4.95c.39.39 1.02.39 1.42 0l2.34-2.34V15c0-.45.09-.88.23-1.29c.54-1.57 2.01-2.71 3.77-2.71h2.94l1.29-1.29c.4-.41.37-1.08-.07-1.47z"/><path fill="var(--font-color)" d="M22 16v-1c0-1.1-.9-2-2-2s-2 .9-2 2v1c-.55 0-1 .45-1 1v3c0 .55.45 1 1 1h4c.55 0 1-.45 1-1v-3c0-.55-.45-1-1-1zm-1 0h-2v-1c0-.55.45-1 1-1s1 .45 1 1v1z"/></svg>`,
-      };
-      const eye_open = `M21.92 11.6C19.9 6.91 16.1 4 12 4s-7.9 2.91-9.92 7.6a1 1 0 0 0 0 .8C4.1 17.09 7.9 20 12 20s7.9-2.91 9.92-7.6a1 1 0 0 0 0-.8ZM12 18c-3.17 0-6.17-2.29-7.9-6C5.83 8.29 8.83 6 12 6s6.17 2.29 7.9 6c-1.73 3.71-4.73 6-7.9 6Zm0-10a4 4 0 1 0 4 4a4 4 0 0 0-4-4Zm0 6a2 2 0 1 1 2-2a2 2 0 0 1-2 2Z`;
-      const eye_close = `M10.94 6.08A6.93 6.93 0 0 1 12 6c3.18 0 6.17 2.29 7.91 6a15.23 15.23 0 0 1-.9 1.64a1 1 0 0 0-.16.55a1 1 0 0 0 1.86.5a15.77 15.77 0 0 0 1.21-2.3a1 1 0 0 0 0-.79C19.9 6.91 16.1 4 12 4a7.77 7.77 0 0 0-1.4.12a1 1 0 1 0 .34 2ZM3.71 2.29a1 1 0 0 0-1.42 1.42l3.1 3.09a14.62 14.62 0 0 0-3.31 4.8a1 1 0 0 0 0 .8C4.1 17.09 7.9 20 12 20a9.26 9.26 0 0 0 5.05-1.54l3.24 3.25a1 1 0 0 0 1.42 0a1 1 0 0 0 0-1.42Zm6.36 9.19l2.45 2.45A1.81 1.81 0 0 1 12 14a2 2 0 0 1-2-2a1.81 1.81 0 0 1 .07-.52ZM12 18c-3.18 0-6.17-2.29-7.9-6a12.09 12.09 0 0 1 2.7-3.79L8.57 10A4 4 0 0 0 14 15.43L15.59 17A7.24 7.24 0 0 1 12 18Z`;
-
-      // --- DOM Element References ---
-      const table = document.getElementById("table-body");
-      const form = document.getElementById("network_form");
-      const code_listener = document.getElementById("code");
-      const ssid_listener = document.getElementById("ssid"); // Hidden SSID input
-      const password_listener = document.getElementById("password"); // Network password input
-      const username_listener = document.getElementById("username"); // Service username input
-      const service_password_listener = document.getElementById("service_password"); // Service password input
-
-      // --- Add Event Listeners ---
-      if(form) form.addEventListener("submit", submitForm);
-      if(code_listener) code_listener.addEventListener("input", updateValue);
-      if(ssid_listener) ssid_listener.addEventListener("input", updateValue);
-      if(password_listener) password_listener.addEventListener("input", updateValue);
-      if(username_listener) username_listener.addEventListener("input", updateValue);
-      if(service_password_listener) service_password_listener.addEventListener("input", updateValue);
-
-      // --- Injected Constants (Values are injected by C++ code here) ---
-)rawliteral";
-// Config: PROJECT_TITLE injected here
-// Merged into index_html4
-// static constexpr const char index_html5[] PROGMEM = R"rawliteral(`;)rawliteral";
-// Config: PROJECT_SUB_TITLE injected here
-// Merged into index_html4
-// static constexpr const char index_html6[] PROGMEM = R"rawliteral(`;)rawliteral";
-// Config: PROJECT_INFO injected here
-// Merged into index_html4
-// static constexpr const char index_html7[] PROGMEM = R"rawliteral(`;)rawliteral";
-
-// --- JavaScript constants split for injection ---
-static constexpr const char js_const_part1[] PROGMEM = R"rawliteral(
-      const title_logo = `)rawliteral";
-// Config: SVG_LOGO injected here (duplicate for JS)
-static constexpr const char js_const_part1a[] PROGMEM = R"rawliteral(`; const title_text = `)rawliteral";
-// Config: PROJECT_TITLE injected here (duplicate for JS)
-static constexpr const char js_const_part1b[] PROGMEM = R"rawliteral(`; const title_sub = `)rawliteral";
-// Config: PROJECT_SUB_TITLE injected here (duplicate for JS)
-static constexpr const char js_const_part1c[] PROGMEM = R"rawliteral(`; const title_info = `)rawliteral";
-// Config: PROJECT_INFO injected here (duplicate for JS)
-
-static constexpr const char js_const_part1d[] PROGMEM = R"rawliteral(`; const input_name_text = `)rawliteral";
-// Config: INPUT_TEXT injected here
-static constexpr const char js_const_part2[] PROGMEM = R"rawliteral(`; const input_lenght = )rawliteral";
-// Config: INPUT_LENGTH injected here (as number)
-static constexpr const char js_const_part3[] PROGMEM = R"rawliteral(; const connection_successful_text = `)rawliteral";
-// Config: CONNECTION_SUCCESSFUL injected here
-static constexpr const char js_const_part4[] PROGMEM = R"rawliteral(`; const footer_text = `)rawliteral";
-// Config: FOOTER_TEXT injected here
-static constexpr const char js_const_part5[] PROGMEM = R"rawliteral(`; const reset_confirmation_text = `)rawliteral";
-// Config: RESET_CONFIRMATION_TEXT injected here
-static constexpr const char js_const_part6[] PROGMEM = R"rawliteral(`; const username_text = `)rawliteral";
-// Config: USERNAME_TEXT injected here
-static constexpr const char js_const_part7[] PROGMEM = R"rawliteral(`; const service_password_text = `)rawliteral";
-// Config: SERVICE_PASSWORD_TEXT injected here
-static constexpr const char js_const_part8[] PROGMEM = R"rawliteral(`; const show_input_field = )rawliteral"; // Added show_input_field here
-// Config: SHOW_INPUT_FIELD injected here (as boolean literal 'true' or 'false')
-static constexpr const char js_const_part8a[] PROGMEM = R"rawliteral(; const show_login_fields = )rawliteral";
-// Config: SHOW_LOGIN_FIELDS injected here (as boolean literal 'true' or 'false')
-static constexpr const char js_const_part9[] PROGMEM = R"rawliteral(; const reset_show = )rawliteral";
-// Config: SHOW_RESET_FIELD injected here (as boolean literal 'true' or 'false')
-
-// --- End of JS const definition; rest of HTML/JS follows ---
-static constexpr const char index_html13[] PROGMEM = R"rawliteral(
-;
-      
-      // --- Initialization on DOM ready ---
-      window.addEventListener("DOMContentLoaded", (event) => {
-          
-         // Set theme color RGB variables for focus ring (parse from hex)
-         try {
-             const style = getComputedStyle(document.documentElement);
-             const hex = style.getPropertyValue('--theme-color').trim();
-             if (hex && hex.startsWith('#') && (hex.length === 7 || hex.length === 4)) {
-                const fullHex = hex.length === 4 ? `#${hex[1]}${hex[1]}${hex[2]}${hex[2]}${hex[3]}${hex[3]}` : hex;
-                const r = parseInt(fullHex.substring(1, 3), 16);
-                const g = parseInt(fullHex.substring(3, 5), 16);
-                const b = parseInt(fullHex.substring(5, 7), 16);
-                document.documentElement.style.setProperty('--theme-color-r', r);
-                document.documentElement.style.setProperty('--theme-color-g', g);
-                document.documentElement.style.setProperty('--theme-color-b', b);
-             } else {
-                 console.warn("Could not parse --theme-color for focus ring:", hex);
-             }
-         } catch(e) { console.error("Error setting theme color RGB variables:", e); }
-
-
-        // Use JS constants defined above to set text content, placeholders etc.
-        const logoContainer = document.getElementById("logo-container");
-        const appTitle = document.getElementById("app-title");
-        const appSubtitle = document.getElementById("app-subtitle");
-        const infoText = document.getElementById("info-text");
-        const codeInput = document.getElementById("code");
-        const codeLabel = document.getElementById("label-code");
-        const userLabel = document.getElementById("label-username");
-        const userInput = document.getElementById("username");
-        const servicePassLabel = document.getElementById("label-service-password");
-        const servicePassInput = document.getElementById("service_password");
-        const copyrightText = document.getElementById("copyright");
-        const resetLink = document.getElementById("factorylink");
-
-        if(logoContainer) logoContainer.innerHTML = title_logo;
-        if(appTitle) appTitle.textContent = title_text;
-        if(appSubtitle) appSubtitle.textContent = title_sub;
-        if(infoText) infoText.textContent = title_info;
-
-         if(codeInput) {
-             codeInput.setAttribute("maxlength", input_lenght);
-             codeInput.placeholder = input_name_text;
-         }
-         if(codeLabel) codeLabel.textContent = input_name_text;
-
-         if(userLabel) userLabel.textContent = username_text;
-         if(userInput) userInput.placeholder = username_text;
-
-         if(servicePassLabel) servicePassLabel.textContent = service_password_text;
-         if(servicePassInput) servicePassInput.placeholder = service_password_text;
-
-
-        if(copyrightText) copyrightText.textContent = footer_text;
-
-        if (!reset_show && resetLink) {
-          resetLink.style.display = "none";
-        }
-      });
-
-      // --- Load networks on page load ---
-      window.addEventListener("load", (event) => {
-        loadSSID(); // Initial network scan on load
-      });
-
-     // --- (Rest of JavaScript functions are unchanged) ---
-     
-      function updateValue(e) {
-        // Clear error message for the input field being typed in
-        showError(e.target.id, "", false);
-      }
-
-      function isRadioChecked() {
-        // Check if any network radio button (including hidden) is checked
-        return Array.from(
-          document.querySelectorAll('input[name="ssid"]')
-        ).some((radio) => radio.checked);
-      }
-
-      function showError(name, message, state) {
-        // Show/hide error message and styling for a given input field name
-         // Use lowercase name consistently
-        const fieldName = name ? name.toLowerCase() : '';
-        if (!fieldName) return; // Exit if name is invalid
-        
-        // Find input block and message element by convention
-        const block = document.getElementById(`error-${fieldName}-input`);
-        const messageElem = document.getElementById(`error-${fieldName}-message`);
-
-        // Toggle error class on the container for styling input
-        // Check if block exists before trying to access classList
-        if (block) {
-             block.classList.toggle("error", state);
-         } else if (fieldName === 'submit') {
-             // Handle submit error display differently if needed, e.g., show it directly
-             const submitErrorElem = document.getElementById('error-submit-message');
-             if(submitErrorElem) submitErrorElem.textContent = state ? message : "";
-         }
-
-        // Set error message text
-        if (messageElem) messageElem.textContent = state ? message : "";
-      }
-
-
-      function resetErrors() {
-        // Clear errors for all potentially visible fields
-        ["submit", "code", "password", "ssid", "username", "service_password"].forEach((field) => {
-          showError(field, "", false);
-        });
-      }
-
-      function connectingState(state) {
-        // Update submit button text and state (disabled/enabled) + spinner visibility
-        const ring = document.getElementById("connecting-ring");
-        const submitBtn = document.getElementById("submit-btn");
-
-        if (!submitBtn) { // Safety check
-          return;
-        }
-
-        const buttonTxt = state ? "Connecting" : "Connect";
-        // Update spinner visibility directly
-        if(ring) ring.style.display = state ? "inline-block" : "none"; // Use inline-block
-        
-        // Set button text content without overwriting the span
-        let textNode = Array.from(submitBtn.childNodes).find(node => node.nodeType === Node.TEXT_NODE && node.textContent.trim() !== '');
-        if (textNode) {
-            textNode.textContent = buttonTxt + (state ? ' ' : ''); // Add space before spinner
-        } else {
-             // If no text node, prepend it
-             submitBtn.insertBefore(document.createTextNode(buttonTxt + (state ? ' ' : '')), submitBtn.firstChild);
-        }
-
-        submitBtn.disabled = state;
-      }
-
-
-      function submitForm(event) {
-        event.preventDefault(); // Prevent default form submission
-
-        // --- Validation ---
-        const validations = [
-          // 1. Check if a network is selected (either listed or hidden)
-          {
-            condition: !isRadioChecked(),
-            field: "submit", // General form error
-            message: "Please select a WiFi network or specify a hidden one.",
-          },
-          // 2. Validate 'Device Key' if it's visible AND configured to be shown
-           {
-            condition: isCodeVisible() && show_input_field, // Check both visibility and config flag
-            field: "code",
-            message: (() => {
-                const value = code_listener ? code_listener.value.trim() : '';
-                // Only require if field is configured to be shown (show_input_field)
-                if (!value && show_input_field) {
-                    return `${input_name_text} is required.`;
-                }
-                // Check length only if there is a value
-                if (value && value.length > input_lenght) {
-                    return `${input_name_text} cannot exceed ${input_lenght} characters.`;
-                }
-                return null; // No error
-            })(),
-           },
-           // 3. Validate 'Username' if login fields are visible AND configured to be shown
-          {
-            condition: isLoginVisible() && show_login_fields && (!username_listener || !username_listener.value.trim()),
-            field: "username",
-            message: `${username_text} is required.`,
-          },
-           // 4. Validate 'Service Password' if login fields are visible AND configured to be shown
-          {
-            condition: isLoginVisible() && show_login_fields && (!service_password_listener || !service_password_listener.value),
-            field: "service_password",
-            message: `${service_password_text} is required.`,
-          },
-          // 5. Validate 'Hidden SSID' if hidden network is selected
-          {
-            condition: isHidden() && (!ssid_listener || !ssid_listener.value.trim()),
-            field: "ssid", // ID of the hidden SSID input
-            message: "Hidden Network SSID is required.",
-          },
-          // 6. Validate 'Network Password' if required (selected network is secured OR hidden network is selected)
-          {
-             condition: (isAuth() || isHidden()) && (!password_listener || !password_listener.value), // Don't trim password
-             field: "password", // ID of the network password input
-             message: "Network Password is required.",
-          },
-        ];
-
-        let hasErrors = false;
-        resetErrors(); // Clear previous errors first
-
-        validations.forEach(({ condition, field, message }) => {
-           // Only validate if the message function returns a non-null message
-           const errorMessage = typeof message === 'function' ? message() : message;
-          if (condition && errorMessage) {
-            showError(field, errorMessage, true);
-            hasErrors = true;
-          }
-        });
-
-        if (hasErrors) return; // Stop if validation failed
-
-        // --- If validation passes ---
-        connectingState(true); // Show connecting status
-        disableForm(true); // Disable form elements
-
-        // --- Prepare Payload ---
-        let payload = {};
-
-        // Get SSID (either selected radio or hidden input)
-        if (isHidden()) {
-          payload.ssid = ssid_listener ? ssid_listener.value.trim() : '';
-        } else {
-          const selectedRadio = document.querySelector(
-            'input[name="ssid"]:checked' // Ensure it's checked
-          );
-          if (selectedRadio) { // Should always be true if validation passed
-              payload.ssid = selectedRadio.value;
-          } else {
-             // Fallback/error - should not happen if validation is correct
-             console.error("No SSID selected despite passing validation");
-             showError("submit", "Internal Error: No SSID selected.", true);
-             connectingState(false);
-             disableForm(false);
-             return;
-          }
-        }
-
-
-        // Get Network Password if needed
-        if ((isAuth() || isHidden()) && password_listener && password_listener.value) {
-          payload.password = password_listener.value;
-        }
-
-        // Get Device Key if visible AND configured to be shown
-        if (isCodeVisible() && show_input_field && code_listener) {
-          payload.code = code_listener.value.trim(); // Trim device key if needed
-        }
-        
-        // Get Login Credentials if visible AND configured to be shown
-        if (isLoginVisible() && show_login_fields) {
-           payload.username = username_listener ? username_listener.value.trim() : ''; // Trim username
-           payload.service_password = service_password_listener ? service_password_listener.value : ''; // Don't trim password
-        }
-
-        // --- Send Request ---
-        console.log("Sending payload:", JSON.stringify(payload)); // Log for debugging
-        fetch("/configure", {
-          method: "POST",
-          headers: { "Content-Type": "application/json" },
-          body: JSON.stringify(payload),
-        })
-          .then((response) => {
-             if (!response.ok) {
-                 // Try to get error text if available
-                 return response.text().then(text => {
-                      console.error("Configure request failed:", response.status, text);
-                     throw new Error(`Connection request failed: ${response.status}`);
-                 });
-             }
-            return response.json();
-          })
-          .then((jsonResponse) => {
-            console.log("Received response:", jsonResponse); // Log for debugging
-            if (jsonResponse.success) {
-              successPage(payload.ssid); // Show success page
-            } else {
-              // Handle specific errors based on 'reason'
-              const reason = jsonResponse.reason || 'Unknown';
-              console.warn("Connection failed. Reason:", reason);
-
-              if (reason === "code") {
-                showError("code", `Invalid ${input_name_text}`, true);
-              } else if (reason === "ssid") {
-                 // Could be wrong password or SSID unreachable/doesn't exist
-                 if (isAuth() || isHidden()) { // Check if password was expected
-                    showError("password", "Invalid password or cannot connect.", true);
-                 } else {
-                     showError("submit", `Could not connect to '${payload.ssid}'. Network may be out of range.`, true);
-                 }
-              } else if (reason === "login") { // Handle potential login failure reason
-                  showError("username", "Invalid service username or password.", true); // Show general login error
-                  showError("service_password", "Invalid service username or password.", true);
-              }
-               else {
-                // Generic error
-                showError( "submit", `Connection failed. Please check credentials and try again.`, true);
-              }
-               connectingState(false); // Re-enable form on error
-               disableForm(false);
-            }
-          })
-          .catch((error) => {
-              console.error("Fetch error during configure:", error);
-              showError("submit", `Error during connection. Please check device logs.`, true);
-              connectingState(false); // Re-enable form on fetch error
-              disableForm(false);
-           });
-      }
-
-
-      function successPage(ssid_text) {
-        // Replace card content with success message and checkmark animation
-        const card = document.getElementById("main-card");
-        if (!card) return; // Safety check
-        card.innerHTML = `
-       <div class="wrapper">
-          <svg class="checkmark" xmlns="http://www.w3.org/2000/svg" viewBox="0 0 52 52"> <circle class="checkmark__circle" cx="26" cy="26" r="25" fill="none"/> <path class="checkmark__check" fill="none" d="M14.1 27.2l7.1 7.2 16.7-16.8"/></svg>
-       </div>
-       <div class="container" style="padding: 1rem;">
-         <h2 style="color:#7ac142;word-break: break-word;">Success</h2>
-         <p style="color:#7ac142;word-break: break-word;font-size:1.2rem;margin-bottom: 0.5rem;">Successfully connected to</p>
-         <p style="color:#7ac142;word-break: break-word;margin-top: 0rem; font-weight: bold;">${ssid_text}</p>
-         <p style="opacity: 0.5; margin-top: 1rem;">${connection_successful_text}</p>
-         <p style="opacity: 0.5;">You can close this window now.</p>
-       </div>
-       `;
-        // Optionally hide the footer or other elements
-        const footer = document.getElementById("footer");
-        if(footer) footer.style.display = 'none';
-      }
-
-
-      function onRadio(element) {
-        // When a radio button is clicked (either listed SSID or 'Hidden Network')
-        if (!element) return;
-        resetErrors(); // Clear any existing errors
-
-        const isHiddenNetwork = element.id === "hiddennetwork_radio";
-        const isListedNetwork = !isHiddenNetwork;
-
-        // Show/hide the input field for the hidden SSID name
-        showssidField(isHiddenNetwork);
-
-        // Determine if the selected network requires a password
-        let needsPassword = false;
-        if (isHiddenNetwork) {
-            needsPassword = true; // Assume hidden networks always need a password for simplicity
-        } else if (isListedNetwork) {
-            // Check the data-auth attribute of the selected listed network
-            needsPassword = element.dataset.auth && parseInt(element.dataset.auth) > 0;
-        }
-        
-        // Show/hide the network password input field
-        showpasswordField(needsPassword);
-
-        // Uncheck other radio buttons if 'Hidden Network' is selected
-        if (isHiddenNetwork) {
-          const radios = document.querySelectorAll(
-            'input[name="ssid"]:not(#hiddennetwork_radio)'
-          );
-          radios.forEach((radio) => (radio.checked = false));
-        } else {
-             // If a listed network is selected, uncheck 'Hidden Network'
-             const hiddenRadio = document.getElementById("hiddennetwork_radio");
-             if(hiddenRadio) hiddenRadio.checked = false;
-        }
-      }
-
-
-      function disableForm(state) {
-        // Disable or enable all form elements (inputs, buttons)
-        if (!form) return;
-        Array.from(form.elements).forEach((el) => (el.disabled = state));
-        // Also disable/enable the factory reset link
-        disableLinks(state);
-      }
-
-      function refreshSpin(state) {
-         // Show/hide the spinning animation on the refresh button
-        const icon = document.getElementById("refresh-icon");
-        if(icon) icon.classList.toggle("icn-spinner", state);
-      }
-
-      function loadSSID() {
-        console.log("loadSSID called - fetching /update"); // Debug log
-        disableForm(true); // Disable form during scan
-        refreshSpin(true); // Show spinner
-        resetErrors(); // Clear errors
-        
-         // Clear existing table rows and show scanning message
-         if(table) table.innerHTML = '<tr><td colspan="3" style="text-align: center; color: grey;">Scanning for networks...</td></tr>';
-
-        // Add cache buster to prevent browser caching of the result
-        const url = "/update?t=" + Date.now(); 
-
-        fetch(url) // Use the URL with cache buster
-          .then((response) => {
-            console.log("Fetch response status:", response.status); // Debug log
-            if (!response.ok) {
-                // Log response text for more details on failure
-                 return response.text().then(text => {
-                     console.error(`Network scan request failed: ${response.status} ${response.statusText}`, text);
-                     throw new Error(`Network scan failed (${response.status})`);
-                 });
-             }
-            return response.json(); // Attempt to parse JSON
-          })
-          .then((jsonResponse) => {
-             console.log("Received network data JSON:", jsonResponse); // Debug log
-             if (!table) return; // Safety check
-             // Clear existing table rows again
-             table.innerHTML = ''; 
-
-            // Check if network data is valid array
-            if (jsonResponse.network && Array.isArray(jsonResponse.network) && jsonResponse.network.length > 0) {
-                 console.log(`Processing ${jsonResponse.network.length} networks...`); // Debug log
-                 jsonResponse.network.forEach(({ ssid, authmode, rssi }) => {
-                     // Basic validation of data before adding row
-                     if (typeof ssid === 'string' && typeof authmode === 'number' && typeof rssi === 'number') {
-                         addTableRow(ssid, authmode, rssi); // Add row for each network
-                     } else {
-                         console.warn("Received invalid network data item:", { ssid, authmode, rssi });
-                     }
-                 });
-                 console.log("Finished processing networks."); // Debug log
-             } else {
-                 console.log("No networks found or network data is empty/invalid.");
-                 table.innerHTML = '<tr><td colspan="3" style="text-align: center; color: grey;">No WiFi networks found. Try refreshing.</td></tr>';
-             }
-             
-            // Show/hide fields based on JSON response (use injected boolean constants for logic elsewhere)
-            // Use !! to ensure boolean conversion
-            showcodeField(!!jsonResponse.show_code); 
-            showLoginFields(!!jsonResponse.show_login);
-            console.log("showcodeField called with:", !!jsonResponse.show_code); // Debug
-            console.log("showLoginFields called with:", !!jsonResponse.show_login); // Debug
-          })
-          .catch((error) => {
-            console.error("Error during network scan fetch/processing:", error); // More specific error log
-            showError("submit", `Error fetching networks. Please refresh.`, true);
-            if(table) table.innerHTML = '<tr><td colspan="3" style="text-align: center; color: red;">Error loading networks. Refresh or check device.</td></tr>'; // Show error in table
-          })
-          .finally(() => {
-            refreshSpin(false); // Hide spinner
-            disableForm(false); // Re-enable form
-             console.log("loadSSID finished"); // Debug log
-          });
-      }
-
-
-      function addTableRow(ssid, authmode, rssi) {
-        // Add a row to the network table
-         if (!table) return; // Safety check
-        const locked = authmode > 0 ? 1 : 0; // Use 1 for locked, 0 for open
-         // Ensure RSSI level is within 0-4 range expected by svgs object keys
-         const safeSignalLevel = Math.max(0, Math.min(4, rssi || 0)); // Default to 0 if rssi is undefined/null
-        const iconKey = `${safeSignalLevel}${locked}`;
-        const iconPath = svgs[iconKey]; // Get the correct SVG path
-
-         let iconHtml = '<!-- Icon N/A -->'; // Default if icon not found
-         if (iconPath) {
-             // Note: iconPath already includes the closing </svg> tag in the svgs object
-             iconHtml = `<svg xmlns="http://www.w3.org/2000/svg" style="vertical-align: middle;" width="1.2em" height="1.2em" preserveAspectRatio="xMidYMid meet" viewBox="0 0 24 24"><path fill="var(--font-color)" ${iconPath}`;
-         } else {
-              console.warn(`No SVG found for signal key ${iconKey} (RSSI level ${safeSignalLevel}, locked: ${locked})`);
-         }
-
-
-        // Use textContent for SSID to prevent potential XSS if SSID contains HTML
-        const safeSSID = document.createElement('span');
-        safeSSID.textContent = ssid;
-         // Create a safer ID by replacing non-alphanumeric chars with underscores + random suffix
-         const uniqueId = `ssid-${ssid.replace(/[^a-zA-Z0-9]/g, '_')}-${Math.random().toString(36).substring(2, 7)}`;
-
-
-        table.innerHTML += `
-       <tr>
-           <td class="radiossid">
-             <input type="radio" name="ssid" value="${ssid}" data-auth="${authmode}" onclick="onRadio(this)" id="${uniqueId}" class="circle">
-           </td>
-            <td><label for="${uniqueId}">${safeSSID.innerHTML}</label></td>
-           <td class="signal">${iconHtml}</td>
-       </tr>
-       `;
-      }
-
-       // Updated function to handle multiple password fields
-      function togglePassShow(inputId, iconId) {
-          const input = document.getElementById(inputId);
-          const iconPath = document.getElementById(iconId); // Get the path element
-          if (!input || !iconPath) {
-             console.warn("Could not find input or icon element for togglePassShow:", inputId, iconId);
-             return;
-          }
-
-          const isPassword = input.type === "password";
-          input.type = isPassword ? "text" : "password";
-          iconPath.setAttribute("d", isPassword ? eye_open : eye_close); // Set the 'd' attribute of the path
-      }
-
-
-      function showssidField(state) {
-          // Show/hide hidden SSID input block
-           const elem = document.getElementById("hiddenNetwork");
-           if(elem) elem.style.display = state ? "" : "none";
-      }
-
-      function showpasswordField(state) {
-         // Show/hide network password input block
-          const elem = document.getElementById("hiddenPassword");
-           if(elem) elem.style.display = state ? "" : "none";
-      }
-
-      function showcodeField(state) {
-        // Show/hide device key input block
-          const elem = document.getElementById("codeinputBlock");
-           if(elem) elem.style.display = state ? "" : "none";
-           console.log("codeinputBlock display set to:", state ? "" : "none"); // Debug
-      }
-
-      function showLoginFields(state) {
-         // Show/hide both username and service password blocks
-        const userBlock = document.getElementById("loginFieldsBlock");
-        const passBlock = document.getElementById("servicePasswordBlock");
-         if(userBlock) userBlock.style.display = state ? "" : "none";
-         if(passBlock) passBlock.style.display = state ? "" : "none";
-         console.log("loginFieldsBlock display set to:", state ? "" : "none"); // Debug
-      }
-
-      function isLoginVisible() {
-         // Check if the username block is visible (implies both login fields are)
-         const userBlock = document.getElementById("loginFieldsBlock");
-        return userBlock ? userBlock.style.display !== "none" : false;
-      }
-
-
-      function isHidden() {
-          // Check if the 'Hidden Network' radio is selected
-          const hiddenRadio = document.getElementById("hiddennetwork_radio");
-          return hiddenRadio ? hiddenRadio.checked : false;
-      }
-
-      function isAuth() {
-        // Check if the currently selected *listed* network requires authentication
-        const selectedRadio = document.querySelector(
-          'input[name="ssid"]:checked:not(#hiddennetwork_radio)' // Exclude hidden radio
-        );
-        // Check data-auth attribute (0 = open, >0 = secured)
-        return selectedRadio ? parseInt(selectedRadio.dataset.auth || "0") > 0 : false;
-      }
-
-      function isCodeVisible() {
-          // Check if device key input block is visible
-          const codeBlock = document.getElementById("codeinputBlock");
-          return codeBlock ? codeBlock.style.display !== "none" : false;
-      }
-      function isPasswordVisible() {
-         // Check if network password input block is visible
-          const passBlock = document.getElementById("hiddenPassword");
-          return passBlock ? passBlock.style.display !== "none" : false;
-      }
-      function isSsidVisible() {
-         // Check if hidden SSID input block is visible
-          const ssidBlock = document.getElementById("hiddenNetwork");
-          return ssidBlock ? ssidBlock.style.display !== "none" : false;
-      }
-
-      function disableLinks(state) {
-         // Disable/enable the factory reset link
-        const link = document.getElementById("factorylink");
-         if(link) link.style.pointerEvents = state ? "none" : "";
-         if(link) link.style.opacity = state ? "0.5" : "1"; // Visually fade when disabled
-      }
-
-
-      function factoryReset() {
-        // Show confirmation dialog for factory reset
-        const card = document.getElementById("main-card");
-         if (!card) return; // Safety check
-        card.innerHTML = `
-               <div id="factory-reset-section">
-                 <h3 style="padding-top: 1rem; margin: 0rem;">Factory Reset</h3>
-                 <p>Are you sure you want to reset the device to factory settings?</p>
-                 <p style="color: gray; margin-top: 1rem;">${reset_confirmation_text}</p>
-                 <div style="display: flex; justify-content: center; gap: 1rem; margin-top: 1.5rem;">
-                    <button
-                      id="cancelReset"
-                      class="btn-process"
-                      style="background-color: gray;"
-                      onclick="cancelFactoryReset();"
-                      >
-                      Cancel <span id="cancel-spinner" style="display: none;"></span>
-                    </button>
-                    <button
-                      id="resetYes"
-                      class="btn-process"
-                      style="background-color: #cc0033;" /* Red color for reset */
-                      onclick="startFactoryReset();"
-                      >
-                      Reset <span id="connecting-ring" style="display: none;"></span>
-                    </button>
-                 </div>
-                 <p id="reset-feedback" class="error-message"></p>
-               </div>
-             `;
-             // Hide footer during confirmation
-              const footer = document.getElementById("footer");
-              if(footer) footer.style.display = 'none';
-      }
-
-      function disableFactoryResetButtons(state) {
-          // Disable/enable reset confirmation buttons
-          const yesButton = document.getElementById("resetYes");
-          const noButton = document.getElementById("cancelReset");
-          if(yesButton) yesButton.disabled = state;
-          if(noButton) noButton.disabled = state;
-           disableLinks(state); // Also disable link if needed
-      }
-
-
-      function startFactoryReset() {
-        disableFactoryResetButtons(true); // Disable buttons
-
-        const resetButton = document.getElementById("resetYes");
-        const factoryResetSection = document.getElementById("factory-reset-section");
-        const feedback = document.getElementById("reset-feedback");
-
-        if(!resetButton || !factoryResetSection || !feedback) return; // Safety check
-
-        // Show spinner on reset button
-        resetButton.innerHTML = `Resetting<span id="connecting-ring" style="display: inline-block;"></span>`;
-        feedback.textContent = ""; // Clear previous feedback
-
-        fetch("/factoryreset", { method: "POST" })
-          .then((response) => {
-             if (!response.ok) {
-                 // Try to get error text if available
-                 return response.text().then(text => {
-                      console.error("Factory reset request failed:", response.status, text);
-                     throw new Error(`Reset request failed: ${response.status}`);
-                 });
-             }
-             // Don't expect JSON, just success status
-             return response.text(); // Consume body
-          })
-          .then(() => {
-                // Show success message within the existing structure
-               factoryResetSection.innerHTML = `
-                 <div class="wrapper">
-                   <svg class="checkmark" xmlns="http://www.w3.org/2000/svg" viewBox="0 0 52 52">
-                     <circle class="checkmark__circle" cx="26" cy="26" r="25" fill="none" />
-                     <path class="checkmark__check" fill="none" d="M14.1 27.2l7.1 7.2 16.7-16.8" />
-                   </svg>
-                 </div>
-                 <div class="container" style="padding: 1rem;">
-                   <h2 style="color:#7ac142;word-break: break-word;">Reset Success</h2>
-                   <p style="color: gray;word-break: break-word;font-size:1.2rem;margin-bottom: 0.5rem;">Factory reset successful.</p>
-                   <p style="opacity: 0.5;">Device will restart. Reconnect to AP to configure again.</p>
-                 </div>
-               `;
-               // No automatic redirect, user needs to reconnect after ESP32 restart (implied)
-          })
-          .catch((error) => {
-            console.error("Factory reset error:", error);
-            feedback.textContent = `Error during reset. Check device logs.`;
-            disableFactoryResetButtons(false); // Re-enable buttons on error
-             if(resetButton) resetButton.innerHTML = 'Reset <span id="connecting-ring" style="display: none;"></span>'; // Reset button text
-          });
-      }
-
-      function cancelFactoryReset() {
-        // Simply reload the page to cancel the reset confirmation
-        disableFactoryResetButtons(true); // Disable buttons while reloading
-        const spinner = document.getElementById("cancel-spinner");
-        if(spinner) spinner.style.display = "inline-block"; // Show spinner on cancel
-
-        // Add a small delay before reloading to show spinner
-        setTimeout(() => {
-             window.location.href = "/"; // Reload the root page
-        }, 300);
-      }
-    </script>
-  </body>
-</html>
-)rawliteral";
+// Config values injected between the static page chunks.
+enum class PageSlot : uint8_t {
+  HTML_TITLE,
+  THEME_COLOR,
+  CONFIG,
+  NONE
+};
+
+// One static piece of the page. `deflated` holds the same bytes as a raw
+// deflate stream ending in a sync flush; `slot` is injected after it.
+struct PageChunk {
+  const char *text;
+  uint16_t textLength;
+  const uint8_t *deflated;
+  uint16_t deflatedLength;
+  PageSlot slot;
+};
+
+static constexpr const char page_chunk0[] PROGMEM =
+    "<!DOCTYPE html> <html lang=\"en\"> <head> <title>";
+static constexpr const uint8_t page_chunk0_deflated[] PROGMEM = {
+    0xB2, 0x51, 0x74, 0xF1, 0x77, 0x0E, 0x89, 0x0C, 0x70, 0x55, 0xC8, 0x28, 0xC9, 0xCD, 0xB1, 0x53,
+    0xB0, 0x01, 0x51, 0x0A, 0x39, 0x89, 0x79, 0xE9, 0xB6, 0x4A, 0xA9, 0x79, 0x4A, 0x20, 0x81, 0xD4,
+    0xC4, 0x14, 0x20, 0x55, 0x92, 0x59, 0x92, 0x93, 0x6A, 0x07, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+};
+
+static constexpr const char page_chunk1[] PROGMEM =
+    "</title> <meta charset=\"UTF-8\"/> <meta name=\"viewport\" content=\"width=device-width, initial"
+    "-scale=1.0, maximum-scale=1\"/> <link rel=\"stylesheet\" href=\"/app.css\?v=21afebc8\"/> <style>"
+    ":root{--theme-color:";
+static constexpr const uint8_t page_chunk1_deflated[] PROGMEM = {
+    0x34, 0x8E, 0x4B, 0x0E, 0x82, 0x30, 0x14, 0x45, 0xB7, 0xD2, 0x74, 0x6C, 0x41, 0x1C, 0x19, 0x42,
+    0x71, 0xE6, 0x0A, 0x74, 0x01, 0xB5, 0x5C, 0xD2, 0x17, 0xFB, 0x21, 0xED, 0x13, 0x34, 0x6E, 0x5E,
+    0x82, 0x61, 0x78, 0x4F, 0x4E, 0x4E, 0x6E, 0x57, 0x33, 0xB1, 0x47, 0x2F, 0xBA, 0x00, 0x36, 0xC2,
+    0x3A, 0x93, 0x0B, 0x58, 0xCB, 0xFB, 0xED, 0xAA, 0xCE, 0xB2, 0xDE, 0x79, 0x34, 0x01, 0x5A, 0xCE,
+    0x84, 0x65, 0x4A, 0x99, 0xA5, 0xB0, 0x29, 0x32, 0xE2, 0xEA, 0x2D, 0x34, 0xB0, 0xD3, 0x03, 0x66,
+    0xB2, 0x50, 0xDB, 0x38, 0x08, 0x8A, 0xC4, 0x64, 0xBC, 0x2A, 0xD6, 0x78, 0xE8, 0xA6, 0x3A, 0x1E,
+    0x44, 0x30, 0x6F, 0x0A, 0xAF, 0xB0, 0xA3, 0x2D, 0xEC, 0x29, 0x3E, 0x45, 0x86, 0xD7, 0xB2, 0xF0,
+    0xC7, 0xA3, 0x38, 0x60, 0x2D, 0xBB, 0x8C, 0x51, 0xCB, 0xDA, 0x4C, 0x53, 0x65, 0x4B, 0xB9, 0xCC,
+    0xFA, 0xD4, 0x98, 0x11, 0x0F, 0xFB, 0x3F, 0xB3, 0x99, 0x7D, 0x9B, 0x53, 0xE2, 0xAF, 0x52, 0xEC,
+    0x10, 0xA0, 0x6C, 0xF2, 0x29, 0xB7, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+};
+
+static constexpr const char page_chunk2[] PROGMEM =
+    "}</style> </head> <body> <div class=\"header\"> <div id=\"logo-container\"></div> <h2 id=\"app-t"
+    "itle\" style=\"margin-top: 0.5rem; margin-bottom: 0rem\"></h2> <h4 id=\"app-subtitle\" style=\"m"
+    "argin-top: 0.2rem\"></h4> <p id=\"info-text\" style=\" opacity: 0.5; word-wrap: break-word; over"
+    "flow-wrap: break-word; max-width: 90%; margin: 0 auto; text-align: center; \"></p> </div> <div i"
+    "d=\"main-card\" class=\"card\"> <form id=\"network_form\" name=\"network_form\"> <h3 class=\"con"
+    "nect-header\">Connect to Wifi</h3> <div style=\"overflow-x: auto\"> <table> <thead> <tr> <th cla"
+    "ss=\"radiossid\"> <button class=\"icon_button\" type=\"button\" title=\"Refresh Network List\" o"
+    "nclick=\"loadSSID(true);\"> <svg xmlns=\"http://www.w3.org/2000/svg\" id=\"refresh-icon\" style="
+    "\"vertical-align: -0.125em\" width=\"1em\" height=\"1em\" preserveaspectratio=\"xMidYMid meet\" "
+    "viewbox=\"0 0 1536 1536\"> <path fill=\"var(--font-color)\" d=\"M1511 928q0 5-1 7q-64 268-268 43"
+    "4.5T764 1536q-146 0-282.5-55T238 1324l-129 129q-19 19-45 19t-45-19t-19-45V960q0-26 19-45t45-19h4"
+    "48q26 0 45 19t19 45t-19 45l-137 137q71 66 161 102t187 36q134 0 250-65t186-179q11-17 53-117q8-23 "
+    "30-23h192q13 0 22.5 9.5t9.5 22.5zm25-800v448q0 26-19 45t-45 19h-448q-26 0-45-19t-19-45t19-45l138"
+    "-138Q969 256 768 256q-134 0-250 65T332 500q-11 17-53 117q-8 23-30 23H50q-13 0-22.5-9.5T18 608v-7"
+    "q65-268 270-434.5T768 0q146 0 284 55.5T1297 212l130-129q19-19 45-19t45 19t19 45z\"></path> </svg"
+    "> </button> </th> <th>SSID</th> <th class=\"signal\">Signal</th> </tr> </thead> <tbody id=\"tabl"
+    "e-body\"> <tr><td colspan=\"3\" style=\"text-align: center; color: grey;\">Initializing...</td><"
+    "/tr> </tbody> </table> </div> <div id=\"hidden-network-selector\"> <p>Hidden Network\?</p> <div>"
+    " <input type=\"radio\" id=\"hiddennetwork_radio\" name=\"ssid\" value=\"hiddennetwork\" class=\""
+    "circle\" onclick=\"onRadio(this);\"/> <label for=\"hiddennetwork_radio\">Specify Hidden Network<"
+    "/label> </div> </div> <div class=\"container\" id=\"hiddenNetwork\" style=\"display: none\"> <la"
+    "bel for=\"ssid\">Network SSID</label> <div id=\"error-ssid-input\"> <input type=\"text\" name=\""
+    "hidden_ssid\" id=\"ssid\" class=\"textinput\" placeholder=\"SSID\" aria-label=\"Hidden Network S"
+    "SID\"/> <div id=\"error-ssid-message\" class=\"error-message\"></div> </div> </div> <div class=\""
+    "container\" id=\"hiddenPassword\" style=\"display: none\"> <label for=\"password\">Network Passw"
+    "ord</label> <div id=\"error-password-input\" class=\"password-container\"> <input type=\"passwor"
+    "d\" name=\"password\" id=\"password\" class=\"textinput\" placeholder=\"Password\" aria-label=\""
+    "Network Password\"/> <button class=\"icon_button\" type=\"button\" title=\"Show/Hide Password\" "
+    "onclick=\"togglePassShow('password', 'eye_icon');\"> <svg xmlns=\"http://www.w3.org/2000/svg\" s"
+    "tyle=\"vertical-align: middle;\" width=\"1em\" height=\"1em\" preserveaspectratio=\"xMidYMid mee"
+    "t\" viewbox=\"0 0 24 24\"> <path id=\"eye_icon\" fill=\"var(--font-color)\" d=\"M10.94 6.08A6.93"
+    " 6.93 0 0 1 12 6c3.18 0 6.17 2.29 7.91 6a15.23 15.23 0 0 1-.9 1.64a1 1 0 0 0-.16.55a1 1 0 0 0 1."
+    "86.5a15.77 15.77 0 0 0 1.21-2.3a1 1 0 0 0 0-.79C19.9 6.91 16.1 4 12 4a7.77 7.77 0 0 0-1.4.12a1 1"
+    " 0 1 0 .34 2ZM3.71 2.29a1 1 0 0 0-1.42 1.42l3.1 3.09a14.62 14.62 0 0 0-3.31 4.8a1 1 0 0 0 0 .8C4"
+    ".1 17.09 7.9 20 12 20a9.26 9.26 0 0 0 5.05-1.54l3.24 3.25a1 1 0 0 0 1.42 0a1 1 0 0 0 0-1.42Zm6.3"
+    "6 9.19l2.45 2.45A1.81 1.81 0 0 1 12 14a2 2 0 0 1-2-2a1.81 1.81 0 0 1 .07-.52ZM12 18c-3.18 0-6.17"
+    "-2.29-7.9-6a12.09 12.09 0 0 1 2.7-3.79L8.57 10A4 4 0 0 0 14 15.43L15.59 17A7.24 7.24 0 0 1 12 18"
+    "Z\"></path> </svg></button> </div> <div id=\"error-password-message\" class=\"error-message\"></"
+    "div> </div> <div class=\"container\" id=\"codeinputBlock\" style=\"display: none\"> <label id=\""
+    "label-code\" for=\"code\"></label> <div id=\"error-code-input\"> <input type=\"text\" name=\"cod"
+    "e\" id=\"code\" class=\"textinput\" placeholder=\"\" aria-label=\"Device Key\" maxlength=\"4\"/>"
+    " </div> <div id=\"error-code-message\" class=\"error-message\"></div> </div> <div class=\"contai"
+    "ner\" id=\"loginFieldsBlock\" style=\"display: none\"> <label id=\"label-username\" for=\"userna"
+    "me\"></label> <div id=\"error-username-input\"> <input type=\"text\" name=\"username\" id=\"user"
+    "name\" class=\"textinput\" placeholder=\"\" aria-label=\"Service Username\"/> </div> <div id=\"e"
+    "rror-username-message\" class=\"error-message\"></div> </div> <div class=\"container\" id=\"serv"
+    "icePasswordBlock\" style=\"display: none\"> <label id=\"label-service-password\" for=\"service_p"
+    "assword\"></label> <div id=\"error-service_password-input\" class=\"password-container\"> <input"
+    " type=\"password\" name=\"service_password\" id=\"service_password\" class=\"textinput\" placeho"
+    "lder=\"\" aria-label=\"Service Password\"/> <button class=\"icon_button\" type=\"button\" title="
+    "\"Show/Hide Service Password\" onclick=\"togglePassShow('service_password', 'service_eye_icon');"
+    "\"> <svg xmlns=\"http://www.w3.org/2000/svg\" style=\"vertical-align: middle;\" width=\"1em\" he"
+    "ight=\"1em\" preserveaspectratio=\"xMidYMid meet\" viewbox=\"0 0 24 24\"> <path id=\"service_eye"
+    "_icon\" fill=\"var(--font-color)\" d=\"M10.94 6.08A6.93 6.93 0 0 1 12 6c3.18 0 6.17 2.29 7.91 6a"
+    "15.23 15.23 0 0 1-.9 1.64a1 1 0 0 0-.16.55a1 1 0 0 0 1.86.5a15.77 15.77 0 0 0 1.21-2.3a1 1 0 0 0"
+    " 0-.79C19.9 6.91 16.1 4 12 4a7.77 7.77 0 0 0-1.4.12a1 1 0 1 0 .34 2ZM3.71 2.29a1 1 0 0 0-1.42 1."
+    "42l3.1 3.09a14.62 14.62 0 0 0-3.31 4.8a1 1 0 0 0 0 .8C4.1 17.09 7.9 20 12 20a9.26 9.26 0 0 0 5.0"
+    "5-1.54l3.24 3.25a1 1 0 0 0 1.42 0a1 1 0 0 0 0-1.42Zm6.36 9.19l2.45 2.45A1.81 1.81 0 0 1 12 14a2 "
+    "2 0 0 1-2-2a1.81 1.81 0 0 1 .07-.52ZM12 18c-3.18 0-6.17-2.29-7.9-6a12.09 12.09 0 0 1 2.7-3.79L8."
+    "57 10A4 4 0 0 0 14 15.43L15.59 17A7.24 7.24 0 0 1 12 18Z\"></path> </svg></button> </div> <div i"
+    "d=\"error-service_password-message\" class=\"error-message\"></div> </div> <div class=\"containe"
+    "r\"> <button class=\"btn-process\" id=\"submit-btn\" type=\"submit\" form=\"network_form\"> Conn"
+    "ect <span id=\"connecting-ring\" style=\"display: none\"></span> </button> <div id=\"error-submi"
+    "t-message\" class=\"error-message\"></div> </div> </form> </div> <footer id=\"footer\"> <p class"
+    "=\"copyright\" style=\"opacity: 0.5\"> <a role=\"link\" style=\"color: inherit; -webkit-tap-high"
+    "light-color: transparent;\" id=\"factorylink\" href=\"javascript:factoryReset()\">Factory Reset<"
+    "/a> </p> <p id=\"copyright\" class=\"copyright\" style=\"opacity: 0.5\"></p> </footer> <script i"
+    "d=\"portal-config\" type=\"application/json\">";
+static constexpr const uint8_t page_chunk2_deflated[] PROGMEM = {
+    0xEC, 0x58, 0x5B, 0x8F, 0xDB, 0xB8, 0x15, 0xFE, 0x2B, 0x84, 0x80, 0x22, 0x13, 0xA0, 0xA4, 0x75,
+    0xBF, 0x8C, 0xC7, 0x2E, 0xD2, 0x2C, 0x16, 0xBB, 0xD8, 0x64, 0xD1, 0x66, 0xD2, 0x16, 0xCD, 0xCB,
+    0x80, 0x96, 0x69, 0x9B, 0x1B, 0x59, 0x94, 0x29, 0x8E, 0x3D, 0x0E, 0xD0, 0xFF, 0xDE, 0x73, 0x48,
+    0x49, 0xBE, 0xCC, 0xB8, 0x93, 0x41, 0xE7, 0xA1, 0x05, 0xF6, 0xC1, 0x94, 0x78, 0x78, 0x2E, 0x1F,
+    0xBF, 0x23, 0x9E, 0x23, 0xEB, 0x5F, 0x37, 0xA3, 0xD6, 0xEC, 0x2B, 0x31, 0x25, 0x37, 0xA3, 0x95,
+    0xE0, 0x73, 0xB8, 0xCE, 0xD4, 0x7C, 0x0F, 0x97, 0xB9, 0xDC, 0x92, 0xB2, 0xE2, 0x6D, 0x3B, 0xF1,
+    0x70, 0x41, 0x68, 0xAF, 0x13, 0xCA, 0xF9, 0xC4, 0xAB, 0xD4, 0x52, 0xD1, 0x52, 0xD5, 0x86, 0xCB,
+    0x1A, 0x57, 0x6E, 0x46, 0xB0, 0x02, 0xEB, 0xAB, 0xD0, 0x2E, 0xF3, 0xA6, 0xA1, 0x46, 0x9A, 0x4A,
+    0x78, 0xC4, 0x7A, 0x9F, 0x78, 0x6B, 0xAE, 0x97, 0xB2, 0xA6, 0x46, 0x35, 0xD7, 0xC4, 0x67, 0x89,
+    0x16, 0xEB, 0x31, 0xE9, 0x64, 0x33, 0x65, 0x8C, 0x5A, 0x83, 0x18, 0x84, 0xE8, 0x69, 0x15, 0xA2,
+    0xA3, 0x78, 0x70, 0xD4, 0xDE, 0xCF, 0xFE, 0x93, 0xAF, 0xB0, 0x37, 0x8B, 0xC1, 0xAC, 0xB1, 0x56,
+    0xB2, 0x5E, 0x28, 0x6A, 0xC4, 0x83, 0x19, 0x4C, 0x88, 0x6A, 0x78, 0x29, 0xCD, 0xDE, 0x06, 0x1F,
+    0x93, 0x9D, 0xD2, 0x73, 0xBA, 0xD3, 0x1C, 0x1C, 0xCC, 0xB4, 0xE0, 0x5F, 0x29, 0x0A, 0xC6, 0x44,
+    0x6D, 0x85, 0x5E, 0x54, 0x6A, 0xF7, 0xC4, 0xD2, 0x9A, 0x3F, 0xD0, 0x9D, 0x9C, 0x9B, 0xD5, 0x35,
+    0x29, 0xFC, 0x3F, 0xF4, 0xD8, 0xC1, 0x1D, 0xE1, 0xF7, 0x46, 0x8D, 0x09, 0x46, 0xA3, 0xBC, 0x92,
+    0x4B, 0x90, 0x95, 0xA2, 0x36, 0x42, 0x8F, 0x09, 0xA2, 0x6A, 0x90, 0x58, 0xC7, 0x4D, 0xCF, 0xDD,
+    0x1A, 0x38, 0xA3, 0x25, 0xD7, 0x73, 0xAF, 0xE7, 0xD7, 0x4E, 0x40, 0x63, 0xA1, 0xF4, 0xDA, 0xAA,
+    0xD4, 0xC2, 0x40, 0xD8, 0xAF, 0x77, 0x28, 0xF0, 0x48, 0xCD, 0xD7, 0xE2, 0x4C, 0x86, 0x0C, 0x45,
+    0x83, 0xB9, 0xAA, 0x6B, 0x51, 0x1A, 0xDA, 0xA7, 0xE9, 0xBD, 0x9B, 0x13, 0xA3, 0xC8, 0x3F, 0xE4,
+    0x42, 0x02, 0x35, 0x51, 0x17, 0xBE, 0x63, 0x63, 0xD8, 0xE7, 0xC3, 0xB5, 0x85, 0x8F, 0xEE, 0x0C,
+    0x9F, 0xD9, 0xA7, 0xC0, 0x74, 0x4F, 0x81, 0xD1, 0x76, 0xD2, 0xC7, 0xD0, 0x7C, 0x2E, 0x55, 0xDB,
+    0x4A, 0x8B, 0x73, 0x76, 0x0F, 0x19, 0xAB, 0xFB, 0x25, 0x09, 0xF1, 0xEF, 0x9C, 0xC8, 0x23, 0x66,
+    0xDF, 0x40, 0x80, 0x61, 0x86, 0x79, 0x9B, 0x78, 0x9F, 0xC4, 0x42, 0x8B, 0x76, 0x45, 0x7E, 0x75,
+    0x5B, 0x20, 0x1F, 0x64, 0x0B, 0xA9, 0x51, 0x75, 0x59, 0xC9, 0xF2, 0x2B, 0x3E, 0x4C, 0x7C, 0x7E,
+    0x7B, 0xFB, 0xF3, 0x0F, 0x57, 0x46, 0xDF, 0x8B, 0xB7, 0x63, 0x8C, 0xD0, 0x6E, 0x97, 0xE4, 0x61,
+    0x5D, 0xD5, 0xF8, 0xF0, 0x19, 0xD3, 0x5C, 0x8F, 0x46, 0xBB, 0xDD, 0x8E, 0xED, 0x22, 0xA6, 0xF4,
+    0x72, 0x14, 0xFA, 0xBE, 0x3F, 0x02, 0x0D, 0xCF, 0x72, 0xA5, 0x9D, 0x73, 0x8A, 0x30, 0x86, 0x7C,
+    0xC3, 0x06, 0x8D, 0x2C, 0x79, 0xD5, 0xA7, 0x84, 0xFA, 0x2C, 0x08, 0x13, 0x78, 0x50, 0x88, 0x4D,
+    0xE2, 0xC4, 0x0B, 0xF0, 0x7E, 0x25, 0xE4, 0x72, 0x65, 0xBA, 0x49, 0x03, 0x5E, 0x84, 0xDE, 0x0A,
+    0xDE, 0x36, 0x40, 0x9E, 0xE6, 0x46, 0xAA, 0x89, 0xF7, 0xF0, 0x51, 0xCE, 0xFF, 0x09, 0x3F, 0xB2,
+    0x16, 0x02, 0x20, 0x6F, 0xA5, 0xD8, 0xCD, 0xD4, 0xC3, 0xC4, 0xF3, 0x21, 0xF1, 0x41, 0x12, 0xA5,
+    0x76, 0x40, 0xC0, 0x0D, 0x07, 0xAE, 0x16, 0xB2, 0xAA, 0x20, 0x36, 0xD7, 0x57, 0x94, 0x2E, 0xE0,
+    0x70, 0xC0, 0x09, 0xA9, 0x94, 0x7E, 0xEB, 0x11, 0x80, 0xF9, 0x31, 0x48, 0x82, 0x80, 0x14, 0x61,
+    0xBE, 0xF1, 0x49, 0x42, 0x03, 0x92, 0x6D, 0x68, 0x1A, 0x93, 0x30, 0xCD, 0x29, 0xFC, 0x48, 0x1C,
+    0xC5, 0x2C, 0xF9, 0x9C, 0x81, 0x04, 0x1D, 0x6E, 0x68, 0x10, 0xA7, 0xC4, 0xA7, 0x61, 0x1E, 0xB2,
+    0x84, 0x26, 0xC9, 0xE7, 0x30, 0xCA, 0x49, 0x10, 0x85, 0x71, 0x45, 0x83, 0xB0, 0x20, 0xF0, 0x03,
+    0x0D, 0xB8, 0x16, 0x34, 0x4E, 0x60, 0x34, 0x70, 0xA1, 0x78, 0xB1, 0x82, 0xBF, 0x17, 0xA9, 0xBF,
+    0x01, 0xDB, 0xD4, 0xAD, 0x1B, 0xBB, 0xB6, 0x8A, 0xE3, 0x7C, 0x03, 0x22, 0x9F, 0x38, 0x0B, 0xB0,
+    0x86, 0x25, 0x6A, 0x2F, 0xE0, 0x34, 0xCA, 0xC0, 0x7D, 0xB6, 0xC9, 0x02, 0x92, 0x82, 0x59, 0x1A,
+    0x90, 0xC0, 0x0F, 0x4D, 0x90, 0x67, 0x04, 0xB0, 0x04, 0x51, 0x0C, 0x66, 0x61, 0xE2, 0xD3, 0x34,
+    0x01, 0x59, 0x4A, 0x83, 0xAC, 0xD8, 0x04, 0x01, 0x5C, 0x48, 0x12, 0xD1, 0x20, 0xC8, 0x36, 0xB0,
+    0x85, 0x88, 0x44, 0x10, 0x32, 0x5A, 0x05, 0x45, 0x08, 0x06, 0xA8, 0x0F, 0xC8, 0x49, 0xC1, 0x12,
+    0x03, 0x3F, 0x3B, 0xF9, 0xB6, 0x0E, 0x13, 0x9A, 0xFB, 0xFE, 0x16, 0x91, 0xC0, 0x7A, 0x4A, 0x3B,
+    0x0C, 0x16, 0xD0, 0x8A, 0xA2, 0x18, 0x41, 0xFB, 0x27, 0x9B, 0x31, 0x76, 0xAC, 0x82, 0x28, 0x07,
+    0x90, 0xF9, 0x5F, 0x8B, 0xB4, 0x00, 0x24, 0x29, 0xC9, 0x80, 0x32, 0xB8, 0x02, 0x0B, 0x08, 0x8E,
+    0x02, 0x38, 0x92, 0x26, 0x9F, 0xA3, 0x28, 0x24, 0x89, 0xEF, 0x83, 0x14, 0x36, 0x90, 0xD1, 0x24,
+    0x22, 0x88, 0x8E, 0x82, 0x6A, 0x44, 0x23, 0x08, 0x19, 0xFD, 0x94, 0xE0, 0x62, 0x84, 0x16, 0x48,
+    0x2C, 0x40, 0xFB, 0x1C, 0xE4, 0x24, 0xF5, 0xF3, 0x2D, 0xCD, 0x36, 0x69, 0x62, 0x33, 0x11, 0x66,
+    0x80, 0xA0, 0xCB, 0x46, 0x4E, 0xFC, 0x8D, 0xCD, 0x04, 0x09, 0xF3, 0x98, 0x24, 0x09, 0xEA, 0x87,
+    0x45, 0x46, 0xC2, 0x20, 0x04, 0x48, 0x3E, 0x26, 0x63, 0x03, 0x00, 0xED, 0x46, 0x10, 0xF3, 0x11,
+    0xB7, 0xDF, 0xEC, 0xE1, 0x87, 0x87, 0x02, 0xCF, 0x3F, 0x3C, 0xAB, 0x78, 0x71, 0xA7, 0x02, 0xEF,
+    0xAC, 0x18, 0x06, 0x7C, 0xEA, 0x87, 0x59, 0x7F, 0x9E, 0x5A, 0x78, 0x62, 0x79, 0xE5, 0x4D, 0x6F,
+    0xED, 0xB5, 0x5B, 0x1E, 0xD9, 0xF3, 0x38, 0x1A, 0x4E, 0x27, 0x16, 0x69, 0xFB, 0xF8, 0xDB, 0x73,
+    0x4B, 0x71, 0xEA, 0xB9, 0x53, 0x7B, 0x63, 0xE6, 0x04, 0x9E, 0xBB, 0xB6, 0xE1, 0xF5, 0xC4, 0x8B,
+    0x86, 0x13, 0xF1, 0x54, 0x81, 0xB2, 0x8F, 0xE7, 0x35, 0x59, 0x6A, 0xB1, 0x87, 0x53, 0xF7, 0x73,
+    0x2D, 0x8D, 0x04, 0x8D, 0x6F, 0xB2, 0x5E, 0x32, 0xC6, 0x20, 0xD8, 0x7C, 0x3A, 0xC4, 0xED, 0x9A,
+    0xC2, 0xA8, 0x2F, 0x13, 0x67, 0x35, 0x6D, 0x25, 0xE7, 0x73, 0x51, 0xD3, 0xAE, 0x46, 0xD1, 0x56,
+    0x54, 0x70, 0x86, 0x94, 0x6D, 0x19, 0xCD, 0xF4, 0x27, 0xBB, 0xD8, 0x9F, 0xFE, 0x3F, 0xB9, 0xA2,
+    0xE8, 0xEC, 0x65, 0xDD, 0xDC, 0x9B, 0xAE, 0x68, 0xD8, 0x12, 0xE3, 0x1D, 0xB9, 0xEB, 0x2B, 0x5E,
+    0xB7, 0xE0, 0xCA, 0xA0, 0xAD, 0x41, 0x64, 0xCB, 0xAB, 0x7B, 0x71, 0xA6, 0x77, 0x28, 0xA7, 0x52,
+    0x97, 0xD8, 0x2E, 0x86, 0x02, 0xA3, 0xEA, 0x4F, 0xE8, 0xE2, 0xCA, 0xAC, 0x64, 0x0B, 0xF5, 0x65,
+    0x04, 0x81, 0x2B, 0x3E, 0x13, 0x15, 0x81, 0x5A, 0xFA, 0x74, 0xB0, 0xE9, 0x2D, 0x14, 0x01, 0xB9,
+    0xD8, 0x93, 0x53, 0xEC, 0x37, 0x23, 0x6B, 0x77, 0xD8, 0xFF, 0x11, 0x0D, 0x87, 0x62, 0xDC, 0x35,
+    0xC5, 0xA3, 0x9D, 0xFC, 0xDA, 0x23, 0xEC, 0x92, 0x31, 0x97, 0x6D, 0x53, 0x71, 0xE8, 0x46, 0xB5,
+    0xAA, 0x85, 0x77, 0x0A, 0xC7, 0x15, 0xD9, 0xBE, 0x54, 0xBA, 0x27, 0xA4, 0x8F, 0xDA, 0xD3, 0x2D,
+    0xB4, 0x56, 0x9A, 0xA2, 0x26, 0xB5, 0x0C, 0x7A, 0x67, 0x54, 0xBA, 0xDE, 0xE7, 0x08, 0x73, 0x08,
+    0xEE, 0x1C, 0x6F, 0x68, 0xEC, 0xEE, 0x3A, 0xB8, 0xA8, 0xE9, 0x5C, 0x10, 0x40, 0x54, 0x8A, 0x95,
+    0xAA, 0xA0, 0x87, 0x4C, 0x3C, 0x8C, 0xEB, 0x11, 0xAE, 0x25, 0xA7, 0x36, 0xF8, 0xC4, 0x3B, 0x65,
+    0xC2, 0x02, 0xB3, 0x4C, 0x3E, 0x81, 0x69, 0x2D, 0xDA, 0x96, 0x2F, 0xC5, 0x10, 0xC4, 0x2D, 0xF5,
+    0xD2, 0xE9, 0x19, 0x79, 0xDF, 0xC9, 0xE1, 0x5F, 0x60, 0x09, 0x7B, 0xF1, 0x77, 0x91, 0xD8, 0xF4,
+    0xCA, 0x03, 0x91, 0xBD, 0xF9, 0x25, 0x32, 0x7B, 0x8B, 0x8E, 0xD0, 0x1E, 0xCA, 0x20, 0x3E, 0x7A,
+    0xD9, 0x39, 0xE5, 0x7A, 0x08, 0xD5, 0xF1, 0x7D, 0x98, 0xA3, 0xF3, 0xC3, 0xEC, 0x19, 0xC2, 0x0F,
+    0xDB, 0x3B, 0x26, 0xFD, 0x1C, 0xBD, 0x65, 0xFC, 0xA5, 0xED, 0xF7, 0x76, 0xA5, 0x76, 0x23, 0x48,
+    0x9F, 0x38, 0xB8, 0x39, 0x9C, 0x0D, 0xA3, 0x96, 0xCB, 0x4A, 0xE0, 0x02, 0xAA, 0x5D, 0xBD, 0xE9,
+    0x01, 0xBF, 0xF9, 0x23, 0x79, 0x23, 0xF6, 0xE2, 0x0E, 0xDD, 0xBF, 0x79, 0x51, 0x53, 0xBE, 0xD0,
+    0x82, 0xD7, 0x90, 0xC5, 0x4A, 0x8C, 0x5F, 0xB3, 0x03, 0x87, 0xD0, 0x40, 0xE3, 0xA1, 0xFB, 0xDA,
+    0x5C, 0x76, 0x88, 0xBD, 0x67, 0x7A, 0xB1, 0xCF, 0x8A, 0x98, 0xA4, 0xCC, 0xCF, 0xDF, 0xA5, 0xAC,
+    0x88, 0x88, 0x1D, 0x6C, 0x4F, 0x87, 0xE6, 0x4A, 0xD2, 0x32, 0x62, 0xD0, 0x17, 0xA0, 0xA7, 0x30,
+    0x68, 0x72, 0x21, 0x83, 0x96, 0x9B, 0xB1, 0x02, 0x7A, 0x23, 0x0F, 0x12, 0x06, 0xAD, 0xCE, 0x8D,
+    0x56, 0x9D, 0x32, 0x68, 0xC3, 0x2C, 0x8D, 0x39, 0x18, 0x5A, 0x89, 0x4F, 0x59, 0x90, 0xB2, 0x24,
+    0x39, 0x08, 0x60, 0x3D, 0x07, 0x09, 0xDA, 0x66, 0x19, 0x71, 0x63, 0xBF, 0x10, 0x06, 0x34, 0x64,
+    0xD1, 0x91, 0x2E, 0x98, 0x67, 0xC5, 0xFB, 0xA0, 0x00, 0xB7, 0x29, 0x86, 0x04, 0x5F, 0x01, 0x89,
+    0x11, 0x54, 0xCC, 0x33, 0xB4, 0xCC, 0x06, 0x73, 0x1A, 0xB0, 0x18, 0x5E, 0x6A, 0x3A, 0x63, 0xFC,
+    0x31, 0x68, 0x86, 0xE1, 0x97, 0x8F, 0x11, 0x83, 0x3E, 0x8E, 0xA8, 0x8F, 0x40, 0x81, 0x6E, 0x48,
+    0x70, 0xA8, 0x60, 0x6B, 0x24, 0x62, 0x3E, 0x2C, 0xC6, 0x2C, 0x05, 0x99, 0x1D, 0x9D, 0x52, 0xC4,
+    0x22, 0x08, 0xC6, 0xF2, 0x63, 0x3C, 0x84, 0xE5, 0xEF, 0x21, 0x0C, 0xF4, 0x53, 0xB0, 0x41, 0x1A,
+    0x48, 0xE8, 0x23, 0x9C, 0xD0, 0xE7, 0x05, 0x83, 0x76, 0x6D, 0x07, 0xA7, 0x99, 0x30, 0x1F, 0xBA,
+    0x20, 0x4B, 0x62, 0x88, 0x01, 0x99, 0x81, 0xE1, 0x94, 0x05, 0x40, 0xE0, 0x9F, 0x6C, 0x15, 0x45,
+    0x5F, 0xD6, 0x29, 0x8B, 0xD0, 0x4D, 0x50, 0x54, 0x21, 0x83, 0x06, 0x8A, 0xC3, 0x3B, 0xA0, 0x2C,
+    0x20, 0x76, 0x18, 0x92, 0x12, 0xC4, 0x1C, 0xA2, 0x76, 0xAC, 0x87, 0x14, 0xF6, 0x7D, 0xA6, 0xC3,
+    0xFC, 0x8C, 0xB2, 0x04, 0xF6, 0x8F, 0xCA, 0x79, 0x49, 0x5D, 0x0E, 0x29, 0xE6, 0x90, 0x22, 0x1B,
+    0x14, 0xC0, 0x53, 0x48, 0x61, 0x88, 0x1B, 0x71, 0xA3, 0x33, 0x0C, 0x59, 0x06, 0xCA, 0x59, 0xF1,
+    0x21, 0x67, 0x09, 0x24, 0xC8, 0x7F, 0x17, 0x93, 0xB8, 0x07, 0x8D, 0xEF, 0x63, 0x2C, 0x8E, 0x3E,
+    0xC0, 0x98, 0x80, 0x55, 0xF6, 0x2E, 0xC3, 0xAD, 0xD9, 0xE1, 0x80, 0x2C, 0xFF, 0x72, 0xDE, 0xEC,
+    0x8F, 0x7B, 0xFD, 0x69, 0xA3, 0x3C, 0x2B, 0x36, 0x2F, 0xAB, 0x94, 0x97, 0x4B, 0x64, 0xA9, 0xE6,
+    0xC2, 0x56, 0x95, 0x3F, 0x57, 0xAA, 0x7C, 0xB6, 0xCF, 0xD8, 0x7F, 0x70, 0x78, 0x47, 0xD1, 0xCE,
+    0x73, 0x25, 0xD3, 0xDE, 0x4E, 0x2F, 0x95, 0x47, 0x5C, 0x7D, 0xBE, 0xD7, 0x38, 0x77, 0x3D, 0xA0,
+    0x67, 0x6B, 0xDE, 0x69, 0xAD, 0xFB, 0x41, 0x6C, 0x65, 0x29, 0xC8, 0x2F, 0x62, 0xEF, 0xE1, 0xDF,
+    0xAD, 0x4A, 0xD4, 0x4B, 0xAC, 0x13, 0xB1, 0xAD, 0x79, 0x4F, 0xD2, 0x68, 0x41, 0xBD, 0x16, 0x85,
+    0xF0, 0x97, 0x56, 0xD6, 0x3F, 0x4A, 0x51, 0xCD, 0xDB, 0x17, 0x92, 0x78, 0x0F, 0x55, 0x0B, 0xF7,
+    0xDF, 0x11, 0x39, 0x4C, 0x2F, 0x92, 0xD9, 0x6B, 0x3C, 0x4F, 0xE8, 0xC1, 0x35, 0x5A, 0x1F, 0x66,
+    0x2F, 0x22, 0xF6, 0x16, 0x8A, 0x2A, 0x32, 0xFB, 0xB7, 0xDE, 0xFC, 0x22, 0xA1, 0x03, 0xB0, 0xD7,
+    0x22, 0xB5, 0x75, 0xA1, 0xFB, 0xBE, 0xF3, 0x42, 0x62, 0x3B, 0x6B, 0x7A, 0x68, 0xA2, 0xEE, 0x0D,
+    0xC9, 0x89, 0xEF, 0x0E, 0x4D, 0xFE, 0xE2, 0x1B, 0xD2, 0x99, 0xE6, 0x7F, 0xDD, 0xDC, 0x1F, 0x85,
+    0x3E, 0xDE, 0xE5, 0xDD, 0x77, 0x37, 0xFB, 0xA7, 0xF3, 0xF3, 0x4A, 0x4D, 0xFE, 0x91, 0xBB, 0xCB,
+    0xCD, 0xFE, 0x1C, 0x38, 0x36, 0xFD, 0x5E, 0xF6, 0xFF, 0xD7, 0xFC, 0xCF, 0x91, 0xFF, 0xFE, 0x12,
+    0xF0, 0xFB, 0x4B, 0xC0, 0xFF, 0xF0, 0x4B, 0xC0, 0xA3, 0xE2, 0xF4, 0x0A, 0x45, 0xF7, 0x51, 0xE1,
+    0x98, 0x99, 0x9A, 0x36, 0x5A, 0x95, 0xE0, 0xA4, 0xAB, 0x55, 0xF7, 0xB3, 0xB5, 0x34, 0x14, 0xE4,
+    0x7D, 0x21, 0x71, 0x12, 0x5B, 0x5B, 0xD7, 0x8F, 0x3E, 0x33, 0xF6, 0xDF, 0x12, 0x6F, 0xF0, 0x7B,
+    0x42, 0xD7, 0xD9, 0xAD, 0x44, 0xD6, 0x4B, 0xAA, 0x61, 0xB8, 0x54, 0xCD, 0x81, 0x03, 0xB0, 0x38,
+    0xF9, 0xEC, 0x71, 0xB6, 0x7D, 0x07, 0xE4, 0x85, 0xFF, 0x15, 0x11, 0xD6, 0x61, 0xBA, 0x50, 0xCA,
+    0x08, 0x6D, 0x9D, 0xBA, 0x5B, 0x5B, 0x0F, 0x0E, 0xB4, 0x34, 0x7B, 0x8D, 0x25, 0x66, 0xC0, 0x78,
+    0xFC, 0x15, 0x18, 0x55, 0x39, 0xD1, 0x0A, 0xE5, 0x95, 0xAC, 0x0F, 0x6D, 0xA9, 0xFB, 0x2A, 0x22,
+    0xEB, 0x95, 0xD0, 0xD2, 0x8C, 0x09, 0xDD, 0x89, 0xD9, 0x57, 0x40, 0x6A, 0x78, 0x43, 0x57, 0xE0,
+    0xAE, 0x42, 0x97, 0xB4, 0xD3, 0x82, 0x4A, 0x55, 0xC3, 0x46, 0xB5, 0xA8, 0xCD, 0xD8, 0x11, 0xBC,
+    0xE0, 0xF8, 0xE5, 0x63, 0xEF, 0x5C, 0xAE, 0xB4, 0x58, 0x4C, 0xBC, 0xDF, 0xF8, 0x96, 0xB7, 0xA5,
+    0x96, 0x8D, 0xB9, 0xEE, 0x56, 0x3F, 0x41, 0xB1, 0x33, 0x57, 0x6F, 0xBD, 0xE9, 0x8F, 0x6E, 0x4E,
+    0xAC, 0xE0, 0x66, 0xC4, 0x71, 0x6F, 0xCD, 0xF0, 0x21, 0xFB, 0x68, 0x07, 0xDF, 0xB9, 0xA7, 0xEE,
+    0x8B, 0xB3, 0x63, 0x03, 0xCB, 0xB6, 0x0D, 0xEB, 0xFE, 0x8A, 0x2A, 0x6D, 0x38, 0xBE, 0xF2, 0xD5,
+    0x0B, 0xB9, 0xEC, 0x93, 0xCF, 0x9B, 0x06, 0x5A, 0x03, 0x56, 0xDB, 0x7A, 0xF4, 0x5B, 0x0B, 0x35,
+    0x73, 0xFA, 0x6F, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+};
+
+static constexpr const char page_chunk3[] PROGMEM =
+    "</script> <script src=\"/app.js\?v=94426a81\"></script> </body> </html>";
+static constexpr const uint8_t page_chunk3_deflated[] PROGMEM = {
+    0xB2, 0xD1, 0x2F, 0x4E, 0x2E, 0xCA, 0x2C, 0x28, 0xB1, 0x53, 0xB0, 0x81, 0x30, 0x14, 0x8A, 0x8B,
+    0x92, 0x6D, 0x95, 0xF4, 0x13, 0x0B, 0x0A, 0xF4, 0xB2, 0x8A, 0xED, 0xCB, 0x6C, 0x2D, 0x4D, 0x4C,
+    0x8C, 0xCC, 0x12, 0x2D, 0x0C, 0x95, 0xEC, 0x6C, 0x10, 0x4A, 0xF5, 0x93, 0xF2, 0x53, 0x2A, 0x41,
+    0x74, 0x46, 0x49, 0x6E, 0x8E, 0x1D, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+};
+
+static constexpr PageChunk page_chunks[] PROGMEM = {
+    {page_chunk0, sizeof(page_chunk0) - 1, page_chunk0_deflated,
+     sizeof(page_chunk0_deflated), PageSlot::HTML_TITLE},
+    {page_chunk1, sizeof(page_chunk1) - 1, page_chunk1_deflated,
+     sizeof(page_chunk1_deflated), PageSlot::THEME_COLOR},
+    {page_chunk2, sizeof(page_chunk2) - 1, page_chunk2_deflated,
+     sizeof(page_chunk2_deflated), PageSlot::CONFIG},
+    {page_chunk3, sizeof(page_chunk3) - 1, page_chunk3_deflated,
+     sizeof(page_chunk3_deflated), PageSlot::NONE},
+};
+static constexpr size_t page_chunk_count = 4;
+
+// A static resource served as-is, gzipped or plain, with a long-lived
+// cache policy. `version` is part of the URL the page links it with.
+struct PortalAsset {
+  const char *path;
+  const char *contentType;
+  const char *version;
+  const char *text;
+  uint32_t textLength;
+  const uint8_t *gzip;
+  uint32_t gzipLength;
+};
+
+// app.css
+static constexpr const char portal_asset0[] PROGMEM =
+    ":root{--card-background:#ffffff;--background-color:#f9f9f9;--font-color:#1a1f36;--shadow-color:r"
+    "gba(0,0,0,0.1);--border-color:#cccccc;--theme-color-r:30;--theme-color-g:144;--theme-color-b:255"
+    "}*{font-family:Poppins,sans-serif;color:var(--font-color)}body{touch-action:manipulation;color:v"
+    "ar(--font-color);background-color:var(--background-color);margin:2rem 0;display:flex;flex-direct"
+    "ion:column;align-items:center;justify-content:center;min-height:100vh;box-sizing:border-box}tabl"
+    "e{border-collapse:collapse;width:100%;margin-bottom:0.5rem;margin-top:0.5rem}th,td{padding:0.75r"
+    "em;text-align:left;vertical-align:middle}th{font-weight:bold;color:#333333}.header{text-align:ce"
+    "nter;width:100%;padding:0 1rem;box-sizing:border-box}@supports (-webkit-appearance:none) or (-mo"
+    "z-appearance:none){input[type=\"radio\"]{--active:var(--theme-color);--active-inner:var(--card-b"
+    "ackground);--border:var(--border-color);--border-hover:var(--theme-color);--background:var(--car"
+    "d-background);-webkit-appearance:none;-moz-appearance:none;height:1.3125rem;outline:none;display"
+    ":inline-block;vertical-align:middle;position:relative;margin:0;cursor:pointer;border:1px solid v"
+    "ar(--bc,var(--border));background:var(--b,var(--background));transition:background 0.3s,border-c"
+    "olor 0.3s,box-shadow 0.2s;-webkit-tap-highlight-color:transparent}input[type=\"radio\"]:after{co"
+    "ntent:'';display:block;left:0;top:0;position:absolute;transition:transform .3s ease,opacity .2s "
+    "ease}input[type=\"radio\"]:checked{--b:var(--active);--bc:var(--active);--d-o:.3s;--d-t:.6s;--d-"
+    "t-e:cubic-bezier(.2,.85,.32,1.2)}input[type=\"radio\"]:disabled{--b:var(--disabled-inner);cursor"
+    ":not-allowed;opacity:.7}input[type=\"radio\"]:disabled:checked{--b:var(--disabled);--bc:var(--bo"
+    "rder)}input[type=\"radio\"]:disabled + label{cursor:not-allowed}input[type=\"radio\"]:hover:not("
+    ":checked):not(:disabled){--bc:var(--border-hover)}input[type=\"radio\"]:focus{box-shadow:0 0 0 2"
+    "px rgba(var(--theme-color-r),var(--theme-color-g),var(--theme-color-b),0.2)}input[type=\"radio\""
+    "]:not(.switch){width:1.3125rem}input[type=\"radio\"]:not(.switch):after{opacity:var(--o,0)}input"
+    "[type=\"radio\"]:not(.switch):checked{--o:1}input[type=\"radio\"] + label{font-size:1em;line-hei"
+    "ght:1.3125rem;display:inline-block;vertical-align:middle;cursor:pointer;margin-left:.5rem}input["
+    "type=\"radio\"].circle{border-radius:50%}input[type=\"radio\"].circle:after{width:1.3125rem;heig"
+    "ht:1.3125rem;border-radius:50%;background:var(--active-inner);opacity:0;transform:scale(0.7);box"
+    "-sizing:border-box;border:2px solid var(--active-inner)}input[type=\"radio\"].circle:checked:aft"
+    "er{background:var(--active);border-color:var(--active-inner);opacity:1;transform:scale(0.5)}}@su"
+    "pports (not (-webkit-appearance:none)) and (not (-moz-appearance:none)){input[type=\"radio\"]:ch"
+    "ecked{accent-color:var(--theme-color)}}a:disabled,input:disabled,button:disabled{cursor:not-allo"
+    "wed;pointer-events:none;opacity:0.5}.signal,.radiossid{text-align:center}.card{background-color:"
+    "var(--card-background);box-shadow:0 0.25rem 0.75rem var(--shadow-color);border-radius:0.75rem;ma"
+    "x-width:50rem;width:calc(100% - 2rem);padding:1.5rem;margin:1rem auto;text-align:center;box-sizi"
+    "ng:border-box}.container{padding-top:1.25rem;text-align:center}#hidden-network-selector{margin:1"
+    "rem 10% 0;text-align:left}#hidden-network-selector p{margin-bottom:0.5rem;font-weight:bold}#hidd"
+    "en-network-selector div{display:flex;align-items:center}#hidden-network-selector input[type=\"ra"
+    "dio\"]{margin-right:0.5rem}.icon_button{-webkit-tap-highlight-color:transparent;background-color"
+    ":transparent;background-repeat:no-repeat;border:none;cursor:pointer;overflow:hidden;outline:none"
+    ";padding:0;vertical-align:middle}.icn-spinner{animation:spin-animation 0.5s infinite linear;disp"
+    "lay:inline-block}@keyframes spin-animation{0%{transform:rotate(0deg)}100%{transform:rotate(359de"
+    "g)}}.textinput{width:100%;box-sizing:border-box;padding:0.75rem;border:1px solid var(--border-co"
+    "lor);-webkit-border-radius:0.3125rem;border-radius:0.3125rem;-webkit-transition:0.5s;transition:"
+    "0.5s;outline:none;margin-top:0.25rem}.password-container input[type=\"password\"],.password-cont"
+    "ainer input[type=\"text\"]{padding-right:2.5rem}.password-container{position:relative;width:75%;"
+    "max-width:18.75rem;margin:0 auto}.password-container .icon_button{position:absolute;right:0.5rem"
+    ";top:50%;transform:translateY(-50%);height:100%;display:flex;align-items:center}.textinput:focus"
+    "{border-color:var(--theme-color);box-shadow:0 0 0 2px rgba(var(--theme-color-r),var(--theme-colo"
+    "r-g),var(--theme-color-b),0.2)}label{display:block;font-size:0.9rem;font-weight:bold;padding-bot"
+    "tom:0.125rem;text-align:left;width:75%;max-width:18.75rem;margin:0 auto}td label,#hidden-network"
+    "-selector label{width:auto;margin:0;font-weight:normal;cursor:pointer;display:inline;text-align:"
+    "left}#footer .copyright{width:100%;margin:2.5em 0 2em 0;font-size:0.8em;text-align:center}.error"
+    "-message{color:#cc0033;display:block;font-size:0.75rem;line-height:0.9375rem;margin:0.3125rem au"
+    "to 0;text-align:left;width:75%;max-width:18.75rem;min-height:0.9375rem}.error input[type=\"text\""
+    "],.error input[type=\"password\"]{background-color:#fce4e4;border-color:#cc0033}.btn-process{-we"
+    "bkit-tap-highlight-color:transparent;background-color:var(--theme-color);box-shadow:0 0.25rem 0."
+    "5rem var(--shadow-color),0 0.5rem 1.5rem var(--shadow-color);font-size:1rem;font-weight:bold;bor"
+    "der:none;outline:none;padding:0.75rem 1.5rem;border-radius:0.3125rem;color:#fff;cursor:pointer;t"
+    "ransition:background-color 0.2s ease,transform 0.1s ease}.btn-process:hover:not(:disabled){backg"
+    "round-color:color-mix(in srgb,var(--theme-color) 85%,black)}.btn-process:active:not(:disabled){t"
+    "ransform:translateY(1px);box-shadow:0 0.1rem 0.3rem var(--shadow-color)}.connect-header{margin-t"
+    "op:0rem;margin-bottom:1rem;padding:0;text-align:center}#connecting-ring:after{content:\"\";displ"
+    "ay:inline-block;width:1em;margin-left:0.5rem;height:1em;vertical-align:middle;border-radius:50%;"
+    "border:0.1875rem solid #fff;border-color:#fff transparent #fff transparent;animation:ring 1.2s l"
+    "inear infinite}@keyframes ring{0%{transform:rotate(0deg)}100%{transform:rotate(360deg)}}.wrapper"
+    "{display:flex;justify-content:center;align-items:center}.checkmark__circle{stroke-dasharray:166;"
+    "stroke-dashoffset:166;stroke-width:2;stroke-miterlimit:10;stroke:#7ac142;fill:none;animation:str"
+    "oke 0.6s cubic-bezier(0.65,0,0.45,1) forwards}.checkmark{width:3.5rem;height:3.5rem;border-radiu"
+    "s:50%;display:block;stroke-width:2;stroke:#fff;stroke-miterlimit:10;margin-top:3rem;box-shadow:i"
+    "nset 0rem 0rem 0rem #7ac142;animation:fill 0.4s ease-in-out 0.4s forwards,scale 0.3s ease-in-out"
+    " 0.9s both}.checkmark__check{transform-origin:50% 50%;stroke-dasharray:48;stroke-dashoffset:48;a"
+    "nimation:stroke 0.3s cubic-bezier(0.65,0,0.45,1) 0.8s forwards}@keyframes stroke{100%{stroke-das"
+    "hoffset:0}}@keyframes scale{0%,100%{transform:none}50%{transform:scale3d(1.1,1.1,1)}}@keyframes "
+    "fill{100%{box-shadow:inset 0rem 0rem 0rem 1.875rem #7ac142}}@media (max-width:600px){body{margin"
+    ":1rem 0}.card{width:calc(100% - 1rem);padding:1rem;margin:0.5rem auto}.textinput,label,.error-me"
+    "ssage,.password-container{width:90%;max-width:none}#hidden-network-selector{margin:1rem 5% 0}th,"
+    "td{padding:0.5rem}}";
+static constexpr const uint8_t portal_asset0_gzip[] PROGMEM = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xB5, 0x59, 0xEB, 0x6E, 0xAC, 0x38,
+    0x12, 0x7E, 0x15, 0x94, 0xA3, 0x68, 0x9A, 0x5D, 0x40, 0xD0, 0x9D, 0xCE, 0x49, 0x40, 0x23, 0xCD,
+    0x23, 0xEC, 0xDF, 0xD5, 0x6A, 0x74, 0x64, 0xC0, 0x74, 0x7B, 0x02, 0x18, 0xD9, 0xEE, 0x5C, 0x0E,
+    0xE2, 0xDD, 0xB7, 0x7C, 0x01, 0x0C, 0x98, 0x64, 0xCE, 0x4A, 0x9B, 0x68, 0xCE, 0x40, 0x01, 0x76,
+    0x5D, 0xBE, 0xAA, 0xFA, 0xCA, 0x49, 0x19, 0xA5, 0xA2, 0x0F, 0xC3, 0x02, 0xB1, 0x32, 0xCC, 0x51,
+    0xF1, 0x72, 0x61, 0xF4, 0xD6, 0x96, 0xE9, 0xB7, 0x4A, 0xFD, 0x64, 0xA1, 0x25, 0x0C, 0x0B, 0x5A,
+    0x53, 0x06, 0x8F, 0x9E, 0xE5, 0x2F, 0x3C, 0xAA, 0x68, 0x2B, 0x46, 0x61, 0x82, 0x92, 0xEA, 0xF4,
+    0x08, 0x42, 0x7E, 0x45, 0x25, 0x7D, 0x33, 0x62, 0x76, 0xC9, 0xD1, 0x21, 0x0E, 0xD4, 0x6F, 0x94,
+    0xF8, 0x72, 0x39, 0xCA, 0x4A, 0xCC, 0xC6, 0xAF, 0x0A, 0xF5, 0x03, 0x62, 0x71, 0xC5, 0x0D, 0xD6,
+    0xD2, 0x90, 0xA5, 0xA7, 0x78, 0x25, 0xBA, 0xA4, 0xC9, 0xC3, 0xC3, 0x4A, 0x96, 0xA7, 0xC7, 0xF3,
+    0x79, 0xF8, 0x47, 0xAF, 0xB4, 0xA8, 0x50, 0x43, 0xEA, 0x8F, 0xF4, 0x5F, 0xB4, 0xEB, 0x48, 0xCB,
+    0x03, 0x8E, 0x5A, 0x1E, 0x72, 0xCC, 0x48, 0x95, 0xE9, 0x9D, 0x5E, 0x11, 0x3B, 0xD8, 0x0A, 0xFB,
+    0x43, 0x4E, 0xCB, 0x8F, 0x5E, 0xD0, 0x5B, 0x71, 0x0D, 0x51, 0x21, 0x08, 0x6D, 0xD3, 0x06, 0xB5,
+    0xA4, 0xBB, 0xD5, 0x48, 0xDE, 0xEC, 0x7D, 0x96, 0x6D, 0xDC, 0xA1, 0x5F, 0x59, 0x8B, 0xFD, 0xAC,
+    0x41, 0xEC, 0x42, 0xDA, 0xF4, 0xC8, 0x70, 0xE3, 0xC5, 0x59, 0x49, 0x78, 0x57, 0xA3, 0x8F, 0xB4,
+    0xAA, 0xF1, 0x7B, 0x26, 0xFF, 0x09, 0x4B, 0xC2, 0xB0, 0xDE, 0x17, 0x3E, 0xB8, 0x35, 0x6D, 0x86,
+    0x6A, 0x72, 0x69, 0x43, 0x22, 0x70, 0xC3, 0xD3, 0x02, 0xB7, 0x02, 0xB3, 0xEC, 0xAF, 0x1B, 0x17,
+    0xA4, 0xFA, 0x80, 0x25, 0xE1, 0xB6, 0x15, 0xA3, 0xB8, 0x21, 0x6D, 0x78, 0xC5, 0xE4, 0x72, 0x15,
+    0x69, 0x12, 0xC7, 0xAF, 0xD7, 0x2C, 0xA7, 0xEF, 0x21, 0x27, 0x3F, 0x49, 0x7B, 0x49, 0x8D, 0x7F,
+    0x41, 0x32, 0x08, 0x94, 0xD7, 0xB8, 0x9F, 0x1D, 0x5E, 0xA3, 0x8E, 0xE3, 0x74, 0xBC, 0xC8, 0xDE,
+    0x48, 0x29, 0xAE, 0x72, 0x81, 0x7B, 0xA3, 0x2B, 0x7C, 0x24, 0x04, 0x6D, 0xD2, 0x38, 0x3A, 0x83,
+    0xD2, 0xA3, 0x50, 0xD0, 0xCE, 0x48, 0x06, 0x71, 0x0D, 0x44, 0xD9, 0x77, 0xA8, 0x2C, 0xE5, 0x4E,
+    0x71, 0xF4, 0x5D, 0xBD, 0x27, 0xF0, 0xBB, 0x08, 0x95, 0xF2, 0x69, 0x8D, 0x2B, 0x91, 0xBD, 0x62,
+    0x26, 0x48, 0x81, 0x6A, 0x23, 0x6B, 0x48, 0x59, 0xD6, 0x18, 0xBE, 0xD5, 0x81, 0x7A, 0xD3, 0x7A,
+    0xE7, 0xB4, 0x2E, 0x8D, 0x8F, 0xBF, 0x9D, 0xD4, 0xCF, 0x10, 0x5D, 0x31, 0x02, 0x4D, 0x7B, 0x6B,
+    0x3D, 0x63, 0xAF, 0xA5, 0xE9, 0xB4, 0xB9, 0x97, 0xC8, 0xBD, 0xDD, 0x86, 0xFF, 0xC1, 0x6F, 0x5D,
+    0x47, 0x99, 0xE0, 0xDE, 0x01, 0xF6, 0xCB, 0x5F, 0x08, 0xAC, 0xD7, 0x75, 0x18, 0x31, 0xD4, 0x16,
+    0x38, 0x6D, 0x69, 0x8B, 0x7D, 0x8F, 0x32, 0x78, 0xD8, 0xD0, 0x9F, 0x9B, 0x27, 0x3D, 0x69, 0xBB,
+    0x9B, 0xF8, 0x8F, 0xF8, 0xE8, 0xF0, 0xEF, 0x77, 0x0C, 0x95, 0x84, 0xDE, 0xFD, 0x09, 0x09, 0x22,
+    0x31, 0xF2, 0x8A, 0x4D, 0xB4, 0x2D, 0x18, 0x4A, 0x4C, 0xEB, 0x67, 0x21, 0x69, 0x5B, 0x3C, 0xE2,
+    0x61, 0x95, 0x4F, 0x33, 0xF2, 0x47, 0xBC, 0x58, 0x69, 0x60, 0xA5, 0xC5, 0x95, 0xBE, 0x4E, 0xAF,
+    0xAC, 0x36, 0xB1, 0x92, 0x73, 0x6F, 0x0B, 0xB7, 0xAD, 0x99, 0xCB, 0xCC, 0x6C, 0xC4, 0x4F, 0x74,
+    0x4A, 0x8E, 0x2A, 0x8C, 0xF4, 0x26, 0x6A, 0xD2, 0x9A, 0xA7, 0x23, 0x5C, 0x49, 0x2B, 0x65, 0x61,
+    0x5E, 0xD3, 0xE2, 0xC5, 0x1D, 0xD8, 0xAC, 0xA3, 0x9C, 0x28, 0x18, 0x33, 0x2C, 0x53, 0xE7, 0x15,
+    0x8F, 0xC8, 0x8F, 0xB3, 0xE2, 0xC6, 0x38, 0x04, 0xB8, 0xA3, 0x44, 0x85, 0xD1, 0x38, 0x20, 0xE9,
+    0xDE, 0x3D, 0x4E, 0x6B, 0x52, 0x7A, 0xC6, 0x15, 0x45, 0x60, 0xFB, 0xC4, 0xB7, 0x73, 0x6C, 0xF4,
+    0x56, 0xB0, 0xCE, 0x32, 0x78, 0x4B, 0x80, 0x35, 0x66, 0xEB, 0x59, 0xEE, 0xC5, 0xD1, 0x89, 0x07,
+    0xB6, 0x77, 0x47, 0xC9, 0xBB, 0xA9, 0x4C, 0x70, 0x7F, 0xE4, 0x93, 0xAF, 0x04, 0xEA, 0xC2, 0x2B,
+    0x78, 0xA2, 0x96, 0xDE, 0x30, 0x19, 0xAD, 0x16, 0xEE, 0x10, 0x03, 0xF0, 0x0D, 0x0E, 0x30, 0xA4,
+    0xA8, 0x02, 0x6B, 0xFA, 0x31, 0x27, 0x7F, 0xFB, 0x6D, 0xF2, 0x96, 0x76, 0x93, 0x4C, 0x02, 0x30,
+    0x5E, 0xE5, 0xCD, 0xEC, 0x1D, 0x94, 0x83, 0xCD, 0x37, 0x81, 0x6D, 0xB5, 0xD5, 0x65, 0x45, 0x59,
+    0xE3, 0x81, 0x8A, 0x1E, 0x46, 0x1C, 0x07, 0xB4, 0x43, 0x05, 0x11, 0x1F, 0x1E, 0xE8, 0xA8, 0x04,
+    0x4E, 0x05, 0x8A, 0x2B, 0x2E, 0x5E, 0x70, 0x09, 0xA8, 0xCC, 0x8D, 0x83, 0x34, 0x02, 0x15, 0x4C,
+    0x8A, 0x8D, 0xA8, 0x0C, 0x69, 0x0A, 0x1B, 0xA8, 0x2B, 0x91, 0x46, 0x8F, 0xE6, 0x2A, 0x84, 0x5A,
+    0x70, 0xCB, 0x49, 0x11, 0xE6, 0xF8, 0x27, 0xC1, 0xEC, 0x10, 0x1D, 0x83, 0xE8, 0xE9, 0x1C, 0x44,
+    0xA7, 0x63, 0x90, 0x44, 0x47, 0xDF, 0xB9, 0x33, 0x58, 0x2A, 0x8B, 0x8A, 0xBD, 0xF5, 0x28, 0xD2,
+    0xF0, 0xF7, 0xC7, 0xA0, 0xB7, 0x54, 0x26, 0x71, 0x4D, 0xDF, 0x70, 0x99, 0x19, 0xA3, 0xD2, 0xE8,
+    0xFB, 0xA7, 0x8B, 0x3A, 0xEC, 0x1A, 0x1F, 0x2D, 0x2C, 0x33, 0x38, 0xF9, 0x74, 0x2D, 0xEF, 0x9F,
+    0x5E, 0x8D, 0x72, 0x5C, 0xF7, 0x5B, 0x75, 0x9C, 0xDF, 0xE9, 0xC4, 0x83, 0xB7, 0x0E, 0xA3, 0x16,
+    0xBE, 0xBE, 0x9B, 0x34, 0xE8, 0x37, 0x1A, 0xE8, 0x6C, 0x75, 0xEB, 0x51, 0xD1, 0xE2, 0xC6, 0xFB,
+    0x19, 0x75, 0x50, 0xB0, 0xE4, 0xEF, 0x11, 0xB0, 0xAF, 0x7A, 0xE2, 0x26, 0xC5, 0x43, 0xE6, 0x07,
+    0x5B, 0xE1, 0xC5, 0x25, 0xCC, 0x7D, 0x68, 0xA6, 0x3B, 0x01, 0x92, 0x3A, 0x47, 0xFC, 0x8D, 0x88,
+    0xE2, 0xEA, 0xF7, 0xA6, 0x6E, 0x8E, 0x29, 0xFE, 0xE5, 0x07, 0x06, 0xD9, 0x63, 0xB8, 0xF4, 0xCE,
+    0x34, 0x88, 0xBF, 0xDE, 0xCA, 0x0A, 0x1D, 0x4D, 0x13, 0xD7, 0xEB, 0x53, 0x40, 0x54, 0x17, 0x80,
+    0x9A, 0x8D, 0xD3, 0x04, 0xAA, 0x8E, 0x2A, 0x2F, 0x9B, 0x5A, 0xF4, 0x0B, 0xE5, 0x67, 0x55, 0x63,
+    0x4C, 0xD3, 0x52, 0x39, 0x18, 0xED, 0x19, 0x1D, 0x15, 0x84, 0x15, 0x73, 0x6B, 0x94, 0xD2, 0x1B,
+    0x4F, 0xCF, 0xF1, 0xFD, 0x27, 0x2F, 0x1B, 0xDF, 0xAC, 0x5C, 0xBA, 0x2D, 0xA3, 0x9B, 0x35, 0xB7,
+    0xD5, 0xCC, 0x6E, 0x17, 0xFE, 0x94, 0x1C, 0x71, 0x36, 0x95, 0x83, 0x94, 0x83, 0x99, 0xF8, 0x00,
+    0x0D, 0xD6, 0x77, 0x77, 0xB8, 0xB1, 0x94, 0x1E, 0x57, 0xA5, 0x74, 0xB1, 0xF2, 0x67, 0xC6, 0x98,
+    0x70, 0x19, 0xA3, 0x76, 0x34, 0xF4, 0xB3, 0x05, 0x59, 0xFB, 0x4C, 0xF9, 0xC4, 0xA1, 0xFC, 0xD9,
+    0x1F, 0xEC, 0x4E, 0x0C, 0x70, 0xD9, 0x6F, 0xC7, 0xBE, 0x87, 0xA0, 0x76, 0x9B, 0x77, 0x5C, 0x5D,
+    0xD9, 0xD9, 0x96, 0x27, 0xD4, 0xA1, 0x42, 0x32, 0x85, 0x85, 0x9E, 0x76, 0xF7, 0x1C, 0x06, 0x34,
+    0xE5, 0x71, 0xA0, 0xD6, 0x99, 0x6F, 0xF3, 0x1B, 0x70, 0x9E, 0x76, 0x2E, 0x6C, 0x8E, 0xF2, 0x65,
+    0xB0, 0x15, 0xE2, 0x57, 0xD8, 0x84, 0xEB, 0x06, 0x39, 0x45, 0x2D, 0x3A, 0x0F, 0x11, 0x07, 0x3C,
+    0xA2, 0x3A, 0x88, 0x94, 0x5A, 0x9C, 0x93, 0x72, 0xCB, 0x61, 0x86, 0x48, 0xB6, 0xEB, 0x7E, 0x87,
+    0x3D, 0x6E, 0x5A, 0xF9, 0xB2, 0x70, 0x44, 0x0A, 0x5A, 0x9E, 0x21, 0x5C, 0x26, 0xD6, 0x36, 0xCF,
+    0xF6, 0x57, 0xB0, 0x1B, 0xA9, 0x59, 0x83, 0xDE, 0x43, 0x8D, 0xD8, 0x73, 0x2C, 0xEF, 0xF5, 0x35,
+    0xC4, 0xA7, 0x38, 0x48, 0x36, 0xE5, 0x85, 0x9E, 0xA4, 0xA7, 0xFE, 0xC4, 0xAA, 0x12, 0x9B, 0xF9,
+    0xA5, 0x92, 0x61, 0x79, 0xE8, 0x26, 0x68, 0xB6, 0xA5, 0x64, 0x6E, 0xE2, 0x15, 0xC9, 0xA6, 0x88,
+    0x20, 0x65, 0xD9, 0xC8, 0x12, 0x15, 0x7D, 0x4C, 0xB4, 0x01, 0xDB, 0x65, 0x86, 0x6F, 0x57, 0xC8,
+    0x62, 0xDC, 0x86, 0x2D, 0x16, 0x6F, 0x94, 0xBD, 0x00, 0x65, 0xAF, 0x81, 0x14, 0x53, 0xD6, 0xDB,
+    0x2A, 0x24, 0xA0, 0x69, 0xBC, 0xA6, 0x99, 0xBB, 0x9F, 0x7A, 0x5D, 0xEF, 0xA4, 0xB3, 0x6B, 0xF6,
+    0xB9, 0xBF, 0x40, 0x49, 0x5E, 0xFB, 0x05, 0x5F, 0xDF, 0x32, 0xF3, 0xFD, 0x8F, 0x5D, 0xEC, 0xD1,
+    0xE8, 0xC3, 0xD4, 0xDE, 0x86, 0x4B, 0x47, 0x04, 0x7C, 0xF5, 0x43, 0xA3, 0xAF, 0xFF, 0x9B, 0x6C,
+    0x64, 0x3B, 0x7C, 0xEC, 0x3C, 0x64, 0x18, 0xB2, 0x47, 0x00, 0x52, 0xCD, 0xD5, 0x58, 0x2F, 0x14,
+    0x74, 0x57, 0x15, 0x53, 0xF6, 0xB0, 0x0A, 0x80, 0x9E, 0x6A, 0x8B, 0x96, 0x3C, 0x70, 0xA2, 0xDB,
+    0x3B, 0xAC, 0x1E, 0xAC, 0x68, 0x43, 0xDE, 0xA9, 0x6A, 0xD0, 0xC3, 0xF8, 0xD4, 0xA8, 0xE1, 0x29,
+    0x95, 0x92, 0x70, 0xBA, 0x05, 0xE0, 0x9E, 0x39, 0x38, 0xA6, 0x22, 0x2D, 0xF8, 0xD0, 0x93, 0xAB,
+    0x23, 0xE6, 0xAC, 0xF1, 0xC3, 0x1F, 0x2F, 0xF8, 0xA3, 0x62, 0xA8, 0xC1, 0xDC, 0x5B, 0xAE, 0xD1,
+    0xC7, 0xF7, 0xFD, 0x5C, 0x62, 0x18, 0x15, 0x48, 0x40, 0x8D, 0x29, 0xF1, 0xC5, 0x1F, 0x24, 0x92,
+    0xB7, 0xCF, 0x4E, 0xE7, 0x67, 0xF5, 0x74, 0x88, 0x24, 0x70, 0x54, 0x54, 0x7A, 0x6B, 0x8E, 0x70,
+    0x97, 0xD5, 0xF5, 0x68, 0xB3, 0xC7, 0x58, 0x97, 0xE4, 0xDD, 0x04, 0x6F, 0x9D, 0x82, 0xEE, 0x8E,
+    0x30, 0xCB, 0xA7, 0xA0, 0xCF, 0x84, 0x50, 0x3A, 0x2A, 0x5B, 0xDF, 0x2F, 0x02, 0xB2, 0x18, 0xCA,
+    0x74, 0x57, 0x8F, 0x3A, 0xC4, 0x39, 0x80, 0xB0, 0x0C, 0xA7, 0xEC, 0x5B, 0xA0, 0x70, 0x7C, 0x7C,
+    0xF7, 0x67, 0xF0, 0xD5, 0xAB, 0xD2, 0x55, 0x80, 0xD7, 0x31, 0x77, 0x35, 0x60, 0x8F, 0xD1, 0xDE,
+    0x36, 0xFD, 0x96, 0xFB, 0x6B, 0x17, 0x7F, 0x3F, 0xDF, 0x5B, 0xB5, 0x27, 0x79, 0x9A, 0xCA, 0x91,
+    0x1E, 0x0C, 0x54, 0x51, 0x71, 0xEA, 0xBD, 0xC8, 0x8A, 0x2D, 0x77, 0xB6, 0x33, 0x48, 0x11, 0x6C,
+    0xD9, 0x5F, 0xE7, 0xD0, 0xAB, 0x2B, 0x50, 0x04, 0xFF, 0xFB, 0x10, 0xC2, 0x13, 0x3F, 0x9B, 0x87,
+    0xE4, 0xFB, 0xEC, 0xAB, 0x8C, 0x9E, 0x71, 0x32, 0x91, 0xB7, 0x4D, 0xF3, 0x5B, 0x8C, 0x64, 0xFF,
+    0x5F, 0x72, 0xA7, 0xC9, 0xD2, 0x72, 0xB2, 0x98, 0xA9, 0x53, 0x1C, 0x3D, 0xBB, 0x6A, 0xDA, 0x08,
+    0xE0, 0xB9, 0xF4, 0x25, 0x47, 0xE7, 0x8C, 0xFE, 0x0B, 0x61, 0x12, 0xA5, 0x26, 0x6E, 0xC1, 0x6E,
+    0xC9, 0xD3, 0xAA, 0xEA, 0x45, 0x54, 0xBB, 0x98, 0x06, 0x40, 0x5B, 0xBF, 0x16, 0x22, 0x84, 0xEA,
+    0x75, 0xF5, 0x59, 0x56, 0x81, 0x6D, 0x91, 0xAF, 0x28, 0x15, 0x12, 0x17, 0x05, 0xED, 0x3E, 0x54,
+    0xF4, 0xFB, 0xCD, 0xB1, 0x85, 0x04, 0xA8, 0xEC, 0x8E, 0xDE, 0x51, 0x9D, 0xB4, 0xD8, 0x4E, 0x7A,
+    0x72, 0x36, 0x9D, 0x08, 0x33, 0x06, 0x9E, 0x86, 0x22, 0xC3, 0xD1, 0x05, 0xF7, 0xD3, 0x51, 0x54,
+    0x1C, 0x9F, 0x4E, 0xD9, 0xBE, 0xC7, 0xB5, 0x73, 0x6C, 0xC2, 0x0A, 0x51, 0x38, 0x2D, 0x5D, 0x36,
+    0x26, 0xB7, 0x72, 0xDD, 0xB6, 0x69, 0x7D, 0xE1, 0xF7, 0xF9, 0x58, 0x67, 0x5A, 0xD9, 0x28, 0xEB,
+    0xC8, 0xD2, 0xC0, 0xF1, 0x64, 0x4E, 0xF5, 0xDE, 0x71, 0x6C, 0x57, 0xE0, 0x07, 0xFC, 0x90, 0xAD,
+    0x0F, 0xE0, 0xA4, 0xD5, 0x43, 0x94, 0x8B, 0x36, 0xEC, 0x18, 0x2D, 0xC0, 0x27, 0xFF, 0x7B, 0x37,
+    0xFA, 0x32, 0x49, 0x26, 0x22, 0xB3, 0xC7, 0x63, 0x82, 0x78, 0x7C, 0x98, 0xEC, 0xBE, 0x63, 0x05,
+    0x25, 0x71, 0x26, 0x81, 0xDD, 0xEC, 0xDC, 0xDD, 0xCC, 0x10, 0x29, 0x43, 0x77, 0xF6, 0x0A, 0xF4,
+    0xE8, 0xB7, 0xAA, 0x5A, 0xA3, 0xD6, 0x79, 0xF4, 0x30, 0x1D, 0x37, 0x98, 0xD1, 0x3D, 0x98, 0xC7,
+    0x7B, 0xC8, 0x43, 0x33, 0xCE, 0xDB, 0x8E, 0xB6, 0x87, 0xCE, 0x79, 0xCC, 0xDC, 0x78, 0x55, 0xD7,
+    0x85, 0x86, 0xBC, 0x1F, 0x48, 0xEB, 0x71, 0x28, 0x30, 0xDB, 0xAA, 0xE1, 0x7B, 0x4F, 0xE7, 0xFB,
+    0x20, 0xAF, 0xE1, 0x53, 0x7F, 0xB9, 0x85, 0x39, 0xB6, 0x5A, 0xED, 0xE1, 0x2C, 0x99, 0xD0, 0xE5,
+    0x36, 0xF1, 0x4A, 0x74, 0xB8, 0x4E, 0x3B, 0xA1, 0x50, 0x84, 0xAF, 0x85, 0x2A, 0x10, 0x9A, 0xB3,
+    0x3B, 0xBB, 0x3D, 0x59, 0x67, 0x88, 0xA6, 0x1C, 0xA9, 0x70, 0xCD, 0x94, 0xC2, 0x41, 0x07, 0xCD,
+    0x72, 0xBA, 0xF9, 0xC0, 0x4B, 0xCB, 0xA3, 0x96, 0xBB, 0x3B, 0xF7, 0x64, 0x68, 0xF2, 0x68, 0xDE,
+    0x4F, 0x1F, 0xC1, 0x44, 0x8B, 0x09, 0x0D, 0x2E, 0xDD, 0x13, 0xA4, 0x63, 0x62, 0xD3, 0x00, 0x02,
+    0xF3, 0x9F, 0x34, 0x50, 0x74, 0xF3, 0x57, 0x48, 0x58, 0xA6, 0x0F, 0x48, 0x3C, 0x2B, 0x25, 0xBC,
+    0xB5, 0x20, 0x9B, 0x39, 0x91, 0xB4, 0x07, 0x10, 0x07, 0xE0, 0xD0, 0x04, 0x68, 0x22, 0x44, 0x36,
+    0xE9, 0x91, 0x2F, 0xFD, 0x3A, 0xD5, 0x79, 0x8C, 0x0D, 0xD5, 0x79, 0x63, 0x72, 0x6E, 0x62, 0x4B,
+    0xF6, 0xBA, 0x73, 0x88, 0xEC, 0x6A, 0x81, 0x6A, 0x9E, 0x02, 0x1F, 0xBE, 0xFC, 0xF8, 0x61, 0x46,
+    0x64, 0x2E, 0x18, 0x7D, 0xC1, 0x61, 0x89, 0x20, 0xEE, 0x8C, 0xC1, 0x92, 0xC9, 0xE3, 0x63, 0x66,
+    0x09, 0x69, 0x55, 0x71, 0x2C, 0x6C, 0xA9, 0x0E, 0xC6, 0x71, 0xBC, 0x6D, 0x60, 0x07, 0x56, 0x13,
+    0xF8, 0x1F, 0xD4, 0x6C, 0x23, 0x4C, 0xBF, 0x7D, 0x47, 0x45, 0xF2, 0x70, 0xCC, 0x2A, 0x52, 0xD7,
+    0x3A, 0x35, 0x2D, 0xEE, 0xA8, 0x5E, 0x01, 0xD0, 0x3D, 0x72, 0x6F, 0x71, 0x3E, 0x05, 0x92, 0xB3,
+    0xFA, 0x3B, 0xC2, 0xC3, 0x39, 0x48, 0x7C, 0x0F, 0x3C, 0xF0, 0x06, 0x63, 0x13, 0xB7, 0xB4, 0x36,
+    0xBD, 0xE1, 0xB4, 0x08, 0xFC, 0x29, 0xDA, 0x99, 0xCB, 0x97, 0x95, 0xDE, 0xA9, 0xBD, 0x4E, 0x7E,
+    0xA7, 0x25, 0x16, 0xD2, 0x4F, 0xD3, 0x49, 0xB4, 0x4E, 0x1C, 0xD2, 0x82, 0x4B, 0xBC, 0x58, 0xA5,
+    0xCE, 0xF4, 0xCF, 0x68, 0xF2, 0x6C, 0xA8, 0x34, 0x1E, 0xCC, 0x7C, 0xD0, 0x95, 0x01, 0x26, 0xEA,
+    0x10, 0x8A, 0x95, 0x16, 0x8C, 0xB6, 0x05, 0x6A, 0x96, 0x56, 0x27, 0x98, 0xAB, 0x97, 0x9E, 0xB9,
+    0x07, 0x49, 0x75, 0x5D, 0x86, 0x4C, 0x5E, 0xCE, 0xF0, 0x08, 0x29, 0x34, 0x4C, 0x68, 0x4A, 0x60,
+    0xAB, 0x27, 0xED, 0xDD, 0x84, 0xF2, 0xE1, 0xC9, 0x11, 0x49, 0x10, 0x3A, 0x62, 0x71, 0xFA, 0x3C,
+    0x16, 0xD0, 0x69, 0x67, 0xA5, 0x17, 0x24, 0x5E, 0x2D, 0xD0, 0x2B, 0xDC, 0x6E, 0xF7, 0x8A, 0x87,
+    0xC5, 0xBB, 0xD2, 0x56, 0x00, 0x7F, 0xB0, 0x42, 0xB9, 0xC4, 0xC7, 0x70, 0x5E, 0x88, 0xD4, 0xAB,
+    0xA7, 0xF2, 0x90, 0x44, 0x49, 0xA0, 0xFE, 0xF3, 0x17, 0x2B, 0x49, 0xCF, 0xEA, 0x3D, 0xBF, 0x8A,
+    0x4A, 0x12, 0x99, 0x0C, 0x37, 0xE1, 0x81, 0x65, 0x1A, 0x5C, 0x12, 0xE4, 0x1D, 0xE6, 0xFE, 0xFC,
+    0x18, 0xC7, 0x50, 0x19, 0x7B, 0xF5, 0xF7, 0x22, 0x7B, 0x2C, 0x8D, 0xCD, 0x4C, 0xBF, 0x1D, 0xAA,
+    0x93, 0xE5, 0x50, 0xBD, 0x20, 0x08, 0x13, 0x3B, 0xB0, 0x08, 0x67, 0xA0, 0x09, 0xD6, 0x92, 0x97,
+    0xB8, 0xC8, 0xBA, 0xD9, 0xEB, 0x39, 0xB6, 0xF9, 0x83, 0xF2, 0xCF, 0xDF, 0x1A, 0xA4, 0xCF, 0x30,
+    0x47, 0x6F, 0xFE, 0x88, 0xA3, 0x58, 0xC6, 0xF0, 0x5F, 0xC8, 0xEB, 0xAF, 0x21, 0x08, 0x1C, 0x00,
+    0x00,
+};
+
+// app.js
+static constexpr const char portal_asset1[] PROGMEM =
+    "const svgs={10:`d=\"m6.67 14.86l3.77 4.7c.8 1 2.32 1 3.12 0l3.78-4.7C17.06 14.65 15.03 13 12 13s"
+    "-5.06 1.65-5.33 1.86z\"/><path fill=\"var(--font-color)\" fill-opacity=\".3\" d=\"M23.64 7c-.45-"
+    ".34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0L23.64 7z\"/></svg>`,11:`f"
+    "ill-opacity=\".3\" d=\"M15.5 14.5c0-2.8 2.2-5 5-5c.36 0 .71.04 1.05.11L23.64 7c-.45-.34-4.93-4-1"
+    "1.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0l1.94-2.42V14.5z\"/><path fill=\"var(-"
+    "-font-color)\" d=\"M15.5 14.5c0-.23.04-.46.07-.68c-.92-.43-2.14-.82-3.57-.82c-3 0-5.1 1.7-5.3 1."
+    "9l3.74 4.66c.8 1 2.32 1 3.12 0l1.94-2.42V14.5zM23 16v-1.5c0-1.4-1.1-2.5-2.5-2.5S18 13.1 18 14.5V"
+    "16c-.5 0-1 .5-1 1v4c0 .5.5 1 1 1h5c.5 0 1-.5 1-1v-4c0-.5-.5-1-1-1zm-1 0h-3v-1.5c0-.8.7-1.5 1.5-1"
+    ".5s1.5.7 1.5 1.5V16z\"/></svg>`,20:`fill-opacity=\".3\" d=\"M23.64 7c-.45-.34-4.93-4-11.64-4C5.2"
+    "8 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0L23.64 7z\"/><path fill=\"var(--font-color)\" d="
+    "\"m4.79 12.52l5.65 7.04c.8 1 2.32 1 3.12 0l5.65-7.05C18.85 12.24 16.1 10 12 10s-6.85 2.24-7.21 2"
+    ".52z\"/></svg>`,21:`fill-opacity=\".3\" d=\"M15.5 14.5c0-2.8 2.2-5 5-5c.36 0 .71.04 1.05.11L23.6"
+    "4 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0l1.94-2.42V14.5z\""
+    "/><path fill=\"var(--font-color)\" d=\"M15.5 14.5c0-1.34.51-2.53 1.34-3.42C15.62 10.51 13.98 10 "
+    "12 10c-4.1 0-6.8 2.2-7.2 2.5l5.64 7.05c.8 1 2.32 1 3.12 0l1.94-2.42V14.5zM23 16v-1.5c0-1.4-1.1-2"
+    ".5-2.5-2.5S18 13.1 18 14.5V16c-.5 0-1 .5-1 1v4c0 .5.5 1 1 1h5c.5 0 1-.5 1-1v-4c0-.5-.5-1-1-1zm-1"
+    " 0h-3v-1.5c0-.8.7-1.5 1.5-1.5s1.5.7 1.5 1.5V16z\"/></svg>`,30:`fill-opacity=\".3\" d=\"M23.64 7c"
+    "-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0L23.64 7z\"/><path fi"
+    "ll=\"var(--font-color)\" d=\"m3.53 10.95l6.91 8.61c.8 1 2.32 1 3.12 0l6.91-8.61C20.04 10.62 16.8"
+    "1 8 12 8s-8.04 2.62-8.47 2.95z\"/></svg>`,31:`fill-opacity=\".3\" d=\"M15.5 14.5c0-2.8 2.2-5 5-5"
+    "c.36 0 .71.04 1.05.11L23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32"
+    " 1 3.12 0l1.94-2.42V14.5z\"/><path fill=\"var(--font-color)\" d=\"M15.5 14.5a4.92 4.92 0 0 1 3.2"
+    "7-4.68C17.29 8.98 14.94 8 12 8c-4.81 0-8.04 2.62-8.47 2.95l6.91 8.61c.8 1 2.32 1 3.12 0l1.94-2.4"
+    "2V14.5zM23 16v-1.5c0-1.4-1.1-2.5-2.5-2.5S18 13.1 18 14.5V16c-.5 0-1 .5-1 1v4c0 .5.5 1 1 1h5c.5 0"
+    " 1-.5 1-1v-4c0-.5-.5-1-1-1zm-1 0h-3v-1.5c0-.8.7-1.5 1.5-1.5s1.5.7 1.5 1.5V16z\"/></svg>`,40:`d=\""
+    "M23.64 7c-.45-.34-4.93-4-11.64-4C5.28 3 .81 6.66.36 7l10.08 12.56c.8 1 2.32 1 3.12 0L23.64 7z\"/"
+    "></svg>`,41:`d=\"M23.21 8.24C20.22 5.6 16.3 4 12 4S3.78 5.6.79 8.24C.35 8.63.32 9.3.73 9.71l5.62"
+    " 5.63l4.94 4.95c.39.39 1.02.39 1.42 0l2.34-2.34V15c0-.45.09-.88.23-1.29c.54-1.57 2.01-2.71 3.77-"
+    "2.71h2.94l1.29-1.29c.4-.41.37-1.08-.07-1.47z\"/><path fill=\"var(--font-color)\" d=\"M22 16v-1c0"
+    "-1.1-.9-2-2-2s-2 .9-2 2v1c-.55 0-1 .45-1 1v3c0 .55.45 1 1 1h4c.55 0 1-.45 1-1v-3c0-.55-.45-1-1-1"
+    "zm-1 0h-2v-1c0-.55.45-1 1-1s1 .45 1 1v1z\"/></svg>`,};const eye_open=`M21.92 11.6C19.9 6.91 16.1"
+    " 4 12 4s-7.9 2.91-9.92 7.6a1 1 0 0 0 0 .8C4.1 17.09 7.9 20 12 20s7.9-2.91 9.92-7.6a1 1 0 0 0 0-."
+    "8ZM12 18c-3.17 0-6.17-2.29-7.9-6C5.83 8.29 8.83 6 12 6s6.17 2.29 7.9 6c-1.73 3.71-4.73 6-7.9 6Zm"
+    "0-10a4 4 0 1 0 4 4a4 4 0 0 0-4-4Zm0 6a2 2 0 1 1 2-2a2 2 0 0 1-2 2Z`;const eye_close=`M10.94 6.08"
+    "A6.93 6.93 0 0 1 12 6c3.18 0 6.17 2.29 7.91 6a15.23 15.23 0 0 1-.9 1.64a1 1 0 0 0-.16.55a1 1 0 0"
+    " 0 1.86.5a15.77 15.77 0 0 0 1.21-2.3a1 1 0 0 0 0-.79C19.9 6.91 16.1 4 12 4a7.77 7.77 0 0 0-1.4.1"
+    "2a1 1 0 1 0 .34 2ZM3.71 2.29a1 1 0 0 0-1.42 1.42l3.1 3.09a14.62 14.62 0 0 0-3.31 4.8a1 1 0 0 0 0"
+    " .8C4.1 17.09 7.9 20 12 20a9.26 9.26 0 0 0 5.05-1.54l3.24 3.25a1 1 0 0 0 1.42 0a1 1 0 0 0 0-1.42"
+    "Zm6.36 9.19l2.45 2.45A1.81 1.81 0 0 1 12 14a2 2 0 0 1-2-2a1.81 1.81 0 0 1 .07-.52ZM12 18c-3.18 0"
+    "-6.17-2.29-7.9-6a12.09 12.09 0 0 1 2.7-3.79L8.57 10A4 4 0 0 0 14 15.43L15.59 17A7.24 7.24 0 0 1 "
+    "12 18Z`;const table=document.getElementById(\"table-body\");const form=document.getElementById(\""
+    "network_form\");const code_listener=document.getElementById(\"code\");const ssid_listener=docume"
+    "nt.getElementById(\"ssid\");const password_listener=document.getElementById(\"password\");const "
+    "username_listener=document.getElementById(\"username\");const service_password_listener=document"
+    ".getElementById(\"service_password\");if(form)form.addEventListener(\"submit\",submitForm);if(co"
+    "de_listener)code_listener.addEventListener(\"input\",updateValue);if(ssid_listener)ssid_listener"
+    ".addEventListener(\"input\",updateValue);if(password_listener)password_listener.addEventListener"
+    "(\"input\",updateValue);if(username_listener)username_listener.addEventListener(\"input\",update"
+    "Value);if(service_password_listener)service_password_listener.addEventListener(\"input\",updateV"
+    "alue);const portal_config=JSON.parse(document.getElementById(\"portal-config\").textContent);con"
+    "st title_text=portal_config.title;const title_sub=portal_config.subtitle;const title_info=portal"
+    "_config.info;const input_name_text=portal_config.input_text;const input_lenght=portal_config.inp"
+    "ut_length;const connection_successful_text=portal_config.connection_successful;const footer_text"
+    "=portal_config.footer;const reset_confirmation_text=portal_config.reset_confirmation;const usern"
+    "ame_text=portal_config.username_text;const service_password_text=portal_config.service_password_"
+    "text;const show_input_field=portal_config.show_input;const show_login_fields=portal_config.show_"
+    "login;const reset_show=portal_config.show_reset;fetch(portal_config.logo).then((response)=>(resp"
+    "onse.ok\?response.text():\"\")).then((svg)=>{const logoContainer=document.getElementById(\"logo-"
+    "container\");if(logoContainer)logoContainer.innerHTML=svg;}).catch(()=>{});window.addEventListen"
+    "er(\"DOMContentLoaded\",(event)=>{try{const style=getComputedStyle(document.documentElement);con"
+    "st hex=style.getPropertyValue('--theme-color').trim();if(hex&&hex.startsWith('#')&&(hex.length=="
+    "=7||hex.length===4)){const fullHex=hex.length===4\?`#${hex[1]}${hex[1]}${hex[2]}${hex[2]}${hex[3"
+    "]}${hex[3]}`:hex;const r=parseInt(fullHex.substring(1,3),16);const g=parseInt(fullHex.substring("
+    "3,5),16);const b=parseInt(fullHex.substring(5,7),16);document.documentElement.style.setProperty("
+    "'--theme-color-r',r);document.documentElement.style.setProperty('--theme-color-g',g);document.do"
+    "cumentElement.style.setProperty('--theme-color-b',b);}else{console.warn(\"Could not parse --them"
+    "e-color for focus ring:\",hex);}}catch(e){console.error(\"Error setting theme color RGB variable"
+    "s:\",e);}\nconst appTitle=document.getElementById(\"app-title\");const appSubtitle=document.getE"
+    "lementById(\"app-subtitle\");const infoText=document.getElementById(\"info-text\");const codeInp"
+    "ut=document.getElementById(\"code\");const codeLabel=document.getElementById(\"label-code\");con"
+    "st userLabel=document.getElementById(\"label-username\");const userInput=document.getElementById"
+    "(\"username\");const servicePassLabel=document.getElementById(\"label-service-password\");const "
+    "servicePassInput=document.getElementById(\"service_password\");const copyrightText=document.getE"
+    "lementById(\"copyright\");const resetLink=document.getElementById(\"factorylink\");if(appTitle)a"
+    "ppTitle.textContent=title_text;if(appSubtitle)appSubtitle.textContent=title_sub;if(infoText)info"
+    "Text.textContent=title_info;if(codeInput){codeInput.setAttribute(\"maxlength\",input_lenght);cod"
+    "eInput.placeholder=input_name_text;}\nif(codeLabel)codeLabel.textContent=input_name_text;if(user"
+    "Label)userLabel.textContent=username_text;if(userInput)userInput.placeholder=username_text;if(se"
+    "rvicePassLabel)servicePassLabel.textContent=service_password_text;if(servicePassInput)servicePas"
+    "sInput.placeholder=service_password_text;if(copyrightText)copyrightText.textContent=footer_text;"
+    "if(!reset_show&&resetLink){resetLink.style.display=\"none\";}});window.addEventListener(\"DOMCon"
+    "tentLoaded\",(event)=>{if(Array.isArray(portal_config.network)){renderNetworks(portal_config.net"
+    "work,false);showcodeField(!!show_input_field);showLoginFields(!!show_login_fields);}else{loadSSI"
+    "D();}});function updateValue(e){showError(e.target.id,\"\",false);}\nfunction isRadioChecked(){r"
+    "eturn Array.from(document.querySelectorAll('input[name=\"ssid\"]')).some((radio)=>radio.checked)"
+    ";}\nfunction showError(name,message,state){const fieldName=name\?name.toLowerCase():'';if(!field"
+    "Name)return;const block=document.getElementById(`error-${fieldName}-input`);const messageElem=do"
+    "cument.getElementById(`error-${fieldName}-message`);if(block){block.classList.toggle(\"error\",s"
+    "tate);}else if(fieldName==='submit'){const submitErrorElem=document.getElementById('error-submit"
+    "-message');if(submitErrorElem)submitErrorElem.textContent=state\?message:\"\";}\nif(messageElem)"
+    "messageElem.textContent=state\?message:\"\";}\nfunction resetErrors(){[\"submit\",\"code\",\"pas"
+    "sword\",\"ssid\",\"username\",\"service_password\"].forEach((field)=>{showError(field,\"\",false"
+    ");});}\nfunction connectingState(state,text){const ring=document.getElementById(\"connecting-rin"
+    "g\");const submitBtn=document.getElementById(\"submit-btn\");if(!submitBtn){return;}\nconst butt"
+    "onTxt=state\?(text||\"Connecting\"):\"Connect\";if(ring)ring.style.display=state\?\"inline-block"
+    "\":\"none\";let textNode=Array.from(submitBtn.childNodes).find(node=>node.nodeType===Node.TEXT_N"
+    "ODE&&node.textContent.trim()!=='');if(textNode){textNode.textContent=buttonTxt+(state\?' ':'');}"
+    "else{submitBtn.insertBefore(document.createTextNode(buttonTxt+(state\?' ':'')),submitBtn.firstCh"
+    "ild);}\nsubmitBtn.disabled=state;}\nfunction submitForm(event){event.preventDefault();const vali"
+    "dations=[{condition:!isRadioChecked(),field:\"submit\",message:\"Please select a WiFi network or"
+    " specify a hidden one.\",},{condition:isCodeVisible()&&show_input_field,field:\"code\",message:("
+    "()=>{const value=code_listener\?code_listener.value.trim():'';if(!value&&show_input_field){retur"
+    "n`${input_name_text} is required.`;}\nif(value&&value.length>input_lenght){return`${input_name_t"
+    "ext} cannot exceed ${input_lenght} characters.`;}\nreturn null;})(),},{condition:isLoginVisible("
+    ")&&show_login_fields&&(!username_listener||!username_listener.value.trim()),field:\"username\",m"
+    "essage:`${username_text} is required.`,},{condition:isLoginVisible()&&show_login_fields&&(!servi"
+    "ce_password_listener||!service_password_listener.value),field:\"service_password\",message:`${se"
+    "rvice_password_text} is required.`,},{condition:isHidden()&&(!ssid_listener||!ssid_listener.valu"
+    "e.trim()),field:\"ssid\",message:\"Hidden Network SSID is required.\",},{condition:(isAuth()||is"
+    "Hidden())&&(!password_listener||!password_listener.value),field:\"password\",message:\"Network P"
+    "assword is required.\",},];let hasErrors=false;resetErrors();validations.forEach(({condition,fie"
+    "ld,message})=>{const errorMessage=typeof message==='function'\?message():message;if(condition&&e"
+    "rrorMessage){showError(field,errorMessage,true);hasErrors=true;}});if(hasErrors)return;connectin"
+    "gState(true);disableForm(true);let payload={};if(isHidden()){payload.ssid=ssid_listener\?ssid_li"
+    "stener.value.trim():'';}else{const selectedRadio=document.querySelector('input[name=\"ssid\"]:ch"
+    "ecked');if(selectedRadio){payload.ssid=selectedRadio.value;}else{console.error(\"No SSID selecte"
+    "d despite passing validation\");showError(\"submit\",\"Internal Error: No SSID selected.\",true)"
+    ";connectingState(false);disableForm(false);return;}}\nif((isAuth()||isHidden())&&password_listen"
+    "er&&password_listener.value){payload.password=password_listener.value;}\nif(isCodeVisible()&&sho"
+    "w_input_field&&code_listener){payload.code=code_listener.value.trim();}\nif(isLoginVisible()&&sh"
+    "ow_login_fields){payload.username=username_listener\?username_listener.value.trim():'';payload.s"
+    "ervice_password=service_password_listener\?service_password_listener.value:'';}\nfetch(\"/config"
+    "ure\",{method:\"POST\",headers:{\"Content-Type\":\"application/json\"},body:JSON.stringify(paylo"
+    "ad),}).then((response)=>{if(!response.ok&&response.status!==409){return response.text().then(tex"
+    "t=>{console.error(\"Configure request failed:\",response.status,text);throw new Error(`Connectio"
+    "n request failed: ${response.status}`);});}\nreturn response.json();}).then((status)=>followConn"
+    "ect(status,payload,0)).catch((error)=>{console.error(\"Fetch error during configure:\",error);sh"
+    "owError(\"submit\",`Error during connection. Please check device logs.`,true);connectingState(fa"
+    "lse);disableForm(false);});}\nconst connect_phase_text={associating:\"Connecting\",dhcp:\"Gettin"
+    "g address\",validating:\"Checking\",};function followConnect(status,payload,misses){if(status.ph"
+    "ase===\"done\"){successPage(payload.ssid);return;}\nif(status.phase===\"failed\"||status.phase=="
+    "=\"idle\"){connectFailed(status.reason||'Unknown',payload);return;}\nconnectingState(true,connec"
+    "t_phase_text[status.phase]);setTimeout(()=>{fetch(\"/status\").then((response)=>{if(!response.ok"
+    "){throw new Error(`Status request failed: ${response.status}`);}\nreturn response.json();}).then"
+    "((next)=>followConnect(next,payload,0)).catch((error)=>{if(misses>=10){console.error(\"Lost the "
+    "device while connecting:\",error);connectFailed('Unknown',payload);return;}\nfollowConnect(statu"
+    "s,payload,misses+1);});},500);}\nfunction connectFailed(reason,payload){console.warn(\"Connectio"
+    "n failed. Reason:\",reason);if(reason===\"code\"){showError(\"code\",`Invalid ${input_name_text}"
+    "`,true);}else if(reason===\"auth_failed\"){showError(\"password\",\"Invalid password.\",true);}e"
+    "lse if(reason===\"handshake_timeout\"){showError(\"password\",\"No answer to the password; it is"
+    " probably wrong.\",true);}else if(reason===\"no_ap_found\"){showError(\"submit\",`Could not find"
+    " '${payload.ssid}'. Network may be out of range.`,true);}else if(reason===\"assoc_failed\"){show"
+    "Error(\"submit\",`'${payload.ssid}' refused the connection. Please try again.`,true);}else if(re"
+    "ason===\"no_ip\"){showError(\"submit\",`Connected to '${payload.ssid}', but got no IP address fr"
+    "om it.`,true);}else if(reason===\"timeout\"){showError(\"submit\",`Timed out connecting to '${pa"
+    "yload.ssid}'. Please try again.`,true);}else if(reason===\"login\"){showError(\"username\",\"Inv"
+    "alid service username or password.\",true);showError(\"service_password\",\"Invalid service user"
+    "name or password.\",true);}\nelse{showError(\"submit\",`Connection failed. Please check credenti"
+    "als and try again.`,true);}\nconnectingState(false);disableForm(false);}\nfunction successPage(s"
+    "sid_text){const card=document.getElementById(\"main-card\");if(!card)return;card.innerHTML=`\n <"
+    "div class=\"wrapper\">\n    <svg class=\"checkmark\" xmlns=\"http://www.w3.org/2000/svg\" viewBo"
+    "x=\"0 0 52 52\"> <circle class=\"checkmark__circle\" cx=\"26\" cy=\"26\" r=\"25\" fill=\"none\"/"
+    "> <path class=\"checkmark__check\" fill=\"none\" d=\"M14.1 27.2l7.1 7.2 16.7-16.8\"/></svg>\n </"
+    "div>\n <div class=\"container\" style=\"padding: 1rem;\">\n   <h2 style=\"color:#7ac142;word-bre"
+    "ak: break-word;\">Success</h2>\n   <p style=\"color:#7ac142;word-break: break-word;font-size:1.2"
+    "rem;margin-bottom: 0.5rem;\">Successfully connected to</p>\n   <p style=\"color:#7ac142;word-bre"
+    "ak: break-word;margin-top: 0rem; font-weight: bold;\">${ssid_text}</p>\n   <p style=\"opacity: 0"
+    ".5; margin-top: 1rem;\">${connection_successful_text}</p>\n   <p style=\"opacity: 0.5;\">You can"
+    " close this window now.</p>\n </div>\n `;const footer=document.getElementById(\"footer\");if(foo"
+    "ter)footer.style.display='none';}\nfunction onRadio(element){if(!element)return;resetErrors();co"
+    "nst isHiddenNetwork=element.id===\"hiddennetwork_radio\";const isListedNetwork=!isHiddenNetwork;"
+    "showssidField(isHiddenNetwork);let needsPassword=false;if(isHiddenNetwork){needsPassword=true;}e"
+    "lse if(isListedNetwork){needsPassword=element.dataset.auth&&parseInt(element.dataset.auth)>0;}\n"
+    "showpasswordField(needsPassword);if(isHiddenNetwork){const radios=document.querySelectorAll('inp"
+    "ut[name=\"ssid\"]:not(#hiddennetwork_radio)');radios.forEach((radio)=>(radio.checked=false));}el"
+    "se{const hiddenRadio=document.getElementById(\"hiddennetwork_radio\");if(hiddenRadio)hiddenRadio"
+    ".checked=false;}}\nfunction disableForm(state){if(!form)return;Array.from(form.elements).forEach"
+    "((el)=>(el.disabled=state));disableLinks(state);}\nfunction refreshSpin(state){const icon=docume"
+    "nt.getElementById(\"refresh-icon\");if(icon)icon.classList.toggle(\"icn-spinner\",state);}\nlet "
+    "scanPollTimer=null;function loadSSID(refresh=false,quiet=false){clearTimeout(scanPollTimer);if(!"
+    "quiet){disableForm(true);refreshSpin(true);resetErrors();if(table)table.innerHTML='<tr><td colsp"
+    "an=\"3\" style=\"text-align: center; color: grey;\">Scanning for networks...</td></tr>';}\nconst"
+    " url=\"/update\?\"+(refresh\?\"refresh=1&\":\"\")+\"t=\"+Date.now();fetch(url).then((response)=>"
+    "{if(!response.ok){return response.text().then(text=>{console.error(`Network scan request failed:"
+    " ${response.status} ${response.statusText}`,text);throw new Error(`Network scan failed (${respon"
+    "se.status})`);});}\nreturn response.json();}).then((jsonResponse)=>{if(!table)return;renderNetwo"
+    "rks(jsonResponse.network,!!jsonResponse.scanning);showcodeField(!!jsonResponse.show_code);showLo"
+    "ginFields(!!jsonResponse.show_login);if(jsonResponse.scanning){scanPollTimer=setTimeout(()=>load"
+    "SSID(false,true),1500);}}).catch((error)=>{console.error(\"Error during network scan fetch/proce"
+    "ssing:\",error);if(quiet)return;showError(\"submit\",`Error fetching networks. Please refresh.`,"
+    "true);if(table)table.innerHTML='<tr><td colspan=\"3\" style=\"text-align: center; color: red;\">"
+    "Error loading networks. Refresh or check device.</td></tr>';}).finally(()=>{if(!quiet){refreshSp"
+    "in(false);disableForm(false);}});}\nfunction renderNetworks(networks,scanning){if(!table)return;"
+    "const checked=table.querySelector('input[name=\"ssid\"]:checked');const selected=checked\?checke"
+    "d.value:null;table.innerHTML='';if(networks&&Array.isArray(networks)&&networks.length>0){network"
+    "s.forEach(({ssid,authmode,rssi})=>{if(typeof ssid==='string'&&typeof authmode==='number'&&typeof"
+    " rssi==='number'){addTableRow(ssid,authmode,rssi);}else{console.warn(\"Received invalid network "
+    "data item:\",{ssid,authmode,rssi});}});table.querySelectorAll('input[name=\"ssid\"]').forEach((r"
+    "adio)=>{if(radio.value===selected)radio.checked=true;});}else if(scanning){table.innerHTML='<tr>"
+    "<td colspan=\"3\" style=\"text-align: center; color: grey;\">Scanning for networks...</td></tr>'"
+    ";}else{table.innerHTML='<tr><td colspan=\"3\" style=\"text-align: center; color: grey;\">No WiFi"
+    " networks found. Try refreshing.</td></tr>';}}\nfunction addTableRow(ssid,authmode,rssi){if(!tab"
+    "le)return;const locked=authmode>0\?1:0;const safeSignalLevel=Math.max(0,Math.min(4,rssi||0));con"
+    "st iconKey=`${safeSignalLevel}${locked}`;const iconPath=svgs[iconKey];let iconHtml='<!-- Icon N/"
+    "A -->';if(iconPath){iconHtml=`<svg xmlns=\"http://www.w3.org/2000/svg\" style=\"vertical-align: "
+    "middle;\" width=\"1.2em\" height=\"1.2em\" preserveAspectRatio=\"xMidYMid meet\" viewBox=\"0 0 2"
+    "4 24\"><path fill=\"var(--font-color)\" ${iconPath}`;}else{console.warn(`No SVG found for signal"
+    " key ${iconKey} (RSSI level ${safeSignalLevel}, locked: ${locked})`);}\nconst safeSSID=document."
+    "createElement('span');safeSSID.textContent=ssid;const uniqueId=`ssid-${ssid.replace(/[^a-zA-Z0-9"
+    "]/g, '_')}-${Math.random().toString(36).substring(2, 7)}`;table.innerHTML+=`\n <tr>\n     <td cl"
+    "ass=\"radiossid\">\n       <input type=\"radio\" name=\"ssid\" value=\"${ssid}\" data-auth=\"${a"
+    "uthmode}\" onclick=\"onRadio(this)\" id=\"${uniqueId}\" class=\"circle\">\n     </td>\n      <td"
+    "><label for=\"${uniqueId}\">${safeSSID.innerHTML}</label></td>\n     <td class=\"signal\">${icon"
+    "Html}</td>\n </tr>\n `;}\nfunction togglePassShow(inputId,iconId){const input=document.getElemen"
+    "tById(inputId);const iconPath=document.getElementById(iconId);if(!input||!iconPath){console.warn"
+    "(\"Could not find input or icon element for togglePassShow:\",inputId,iconId);return;}\nconst is"
+    "Password=input.type===\"password\";input.type=isPassword\?\"text\":\"password\";iconPath.setAttr"
+    "ibute(\"d\",isPassword\?eye_open:eye_close);}\nfunction showssidField(state){const elem=document"
+    ".getElementById(\"hiddenNetwork\");if(elem)elem.style.display=state\?\"\":\"none\";}\nfunction s"
+    "howpasswordField(state){const elem=document.getElementById(\"hiddenPassword\");if(elem)elem.styl"
+    "e.display=state\?\"\":\"none\";}\nfunction showcodeField(state){const elem=document.getElementBy"
+    "Id(\"codeinputBlock\");if(elem)elem.style.display=state\?\"\":\"none\";}\nfunction showLoginFiel"
+    "ds(state){const userBlock=document.getElementById(\"loginFieldsBlock\");const passBlock=document"
+    ".getElementById(\"servicePasswordBlock\");if(userBlock)userBlock.style.display=state\?\"\":\"non"
+    "e\";if(passBlock)passBlock.style.display=state\?\"\":\"none\";}\nfunction isLoginVisible(){const"
+    " userBlock=document.getElementById(\"loginFieldsBlock\");return userBlock\?userBlock.style.displ"
+    "ay!==\"none\":false;}\nfunction isHidden(){const hiddenRadio=document.getElementById(\"hiddennet"
+    "work_radio\");return hiddenRadio\?hiddenRadio.checked:false;}\nfunction isAuth(){const selectedR"
+    "adio=document.querySelector('input[name=\"ssid\"]:checked:not(#hiddennetwork_radio)');return sel"
+    "ectedRadio\?parseInt(selectedRadio.dataset.auth||\"0\")>0:false;}\nfunction isCodeVisible(){cons"
+    "t codeBlock=document.getElementById(\"codeinputBlock\");return codeBlock\?codeBlock.style.displa"
+    "y!==\"none\":false;}\nfunction isPasswordVisible(){const passBlock=document.getElementById(\"hid"
+    "denPassword\");return passBlock\?passBlock.style.display!==\"none\":false;}\nfunction isSsidVisi"
+    "ble(){const ssidBlock=document.getElementById(\"hiddenNetwork\");return ssidBlock\?ssidBlock.sty"
+    "le.display!==\"none\":false;}\nfunction disableLinks(state){const link=document.getElementById(\""
+    "factorylink\");if(link)link.style.pointerEvents=state\?\"none\":\"\";if(link)link.style.opacity="
+    "state\?\"0.5\":\"1\";}\nfunction factoryReset(){const card=document.getElementById(\"main-card\""
+    ");if(!card)return;card.innerHTML=`\n         <div id=\"factory-reset-section\">\n           <h3 "
+    "style=\"padding-top: 1rem; margin: 0rem;\">Factory Reset</h3>\n           <p>Are you sure you wa"
+    "nt to reset the device to factory settings\?</p>\n           <p style=\"color: gray; margin-top:"
+    " 1rem;\">${reset_confirmation_text}</p>\n           <div style=\"display: flex; justify-content:"
+    " center; gap: 1rem; margin-top: 1.5rem;\">\n              <button\n                id=\"cancelRe"
+    "set\"\n                class=\"btn-process\"\n                style=\"background-color: gray;\"\n"
+    "                onclick=\"cancelFactoryReset();\"\n                >\n                Cancel <sp"
+    "an id=\"cancel-spinner\" style=\"display: none;\"></span>\n              </button>\n            "
+    "  <button\n                id=\"resetYes\"\n                class=\"btn-process\"\n             "
+    "   style=\"background-color: #cc0033;\" /* Red color for reset */\n                onclick=\"sta"
+    "rtFactoryReset();\"\n                >\n                Reset <span id=\"connecting-ring\" style"
+    "=\"display: none;\"></span>\n              </button>\n           </div>\n           <p id=\"rese"
+    "t-feedback\" class=\"error-message\"></p>\n         </div>\n       `;const footer=document.getEl"
+    "ementById(\"footer\");if(footer)footer.style.display='none';}\nfunction disableFactoryResetButto"
+    "ns(state){const yesButton=document.getElementById(\"resetYes\");const noButton=document.getEleme"
+    "ntById(\"cancelReset\");if(yesButton)yesButton.disabled=state;if(noButton)noButton.disabled=stat"
+    "e;disableLinks(state);}\nfunction startFactoryReset(){disableFactoryResetButtons(true);const res"
+    "etButton=document.getElementById(\"resetYes\");const factoryResetSection=document.getElementById"
+    "(\"factory-reset-section\");const feedback=document.getElementById(\"reset-feedback\");if(!reset"
+    "Button||!factoryResetSection||!feedback)return;resetButton.innerHTML=`Resetting<span id=\"connec"
+    "ting-ring\" style=\"display: inline-block;\"></span>`;feedback.textContent=\"\";fetch(\"/factory"
+    "reset\",{method:\"POST\"}).then((response)=>{if(!response.ok){return response.text().then(text=>"
+    "{console.error(\"Factory reset request failed:\",response.status,text);throw new Error(`Reset re"
+    "quest failed: ${response.status}`);});}\nreturn response.text();}).then(()=>{factoryResetSection"
+    ".innerHTML=`\n           <div class=\"wrapper\">\n             <svg class=\"checkmark\" xmlns=\""
+    "http://www.w3.org/2000/svg\" viewBox=\"0 0 52 52\">\n               <circle class=\"checkmark__c"
+    "ircle\" cx=\"26\" cy=\"26\" r=\"25\" fill=\"none\" />\n               <path class=\"checkmark__c"
+    "heck\" fill=\"none\" d=\"M14.1 27.2l7.1 7.2 16.7-16.8\" />\n             </svg>\n           </di"
+    "v>\n           <div class=\"container\" style=\"padding: 1rem;\">\n             <h2 style=\"colo"
+    "r:#7ac142;word-break: break-word;\">Reset Success</h2>\n             <p style=\"color: gray;word"
+    "-break: break-word;font-size:1.2rem;margin-bottom: 0.5rem;\">Factory reset successful.</p>\n    "
+    "         <p style=\"opacity: 0.5;\">Device will restart. Reconnect to AP to configure again.</p>"
+    "\n           </div>\n         `;}).catch((error)=>{console.error(\"Factory reset error:\",error)"
+    ";feedback.textContent=`Error during reset. Check device logs.`;disableFactoryResetButtons(false)"
+    ";if(resetButton)resetButton.innerHTML='Reset <span id=\"connecting-ring\" style=\"display: none;"
+    "\"></span>';});}\nfunction cancelFactoryReset(){disableFactoryResetButtons(true);const spinner=d"
+    "ocument.getElementById(\"cancel-spinner\");if(spinner)spinner.style.display=\"inline-block\";set"
+    "Timeout(()=>{window.location.href=\"/\";},300);}";
+static constexpr const uint8_t portal_asset1_gzip[] PROGMEM = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xDD, 0x3C, 0xFD, 0x77, 0xDB, 0xB6,
+    0xAE, 0xBF, 0xF7, 0xAF, 0x60, 0xB5, 0x9E, 0xD8, 0xBA, 0xB3, 0x14, 0xCB, 0x9F, 0xB1, 0x13, 0x27,
+    0xA7, 0xCD, 0xDA, 0xBB, 0xBE, 0xD7, 0x76, 0x3D, 0x4D, 0xDF, 0xEE, 0xDB, 0x7A, 0xF6, 0x12, 0xC5,
+    0xA2, 0x63, 0xDD, 0xCA, 0x92, 0xAF, 0x24, 0x27, 0xCD, 0x1C, 0xFF, 0xEF, 0x0F, 0x00, 0x49, 0x49,
+    0x94, 0x64, 0x27, 0x59, 0xBB, 0xF7, 0xB1, 0x75, 0x95, 0x25, 0x11, 0x00, 0x41, 0x10, 0x00, 0x01,
+    0x90, 0xEA, 0x34, 0x0A, 0x93, 0x94, 0x25, 0xD7, 0x57, 0xC9, 0x64, 0xED, 0xB4, 0xC7, 0x17, 0xDE,
+    0xC4, 0x58, 0x0C, 0xEC, 0xC1, 0x90, 0x39, 0x3D, 0xFB, 0x60, 0x10, 0x74, 0xED, 0xE1, 0x90, 0xF5,
+    0xEC, 0xE1, 0xD4, 0x3E, 0x60, 0x0E, 0xEB, 0xD8, 0xDD, 0x0E, 0xFC, 0x74, 0x6D, 0xA7, 0xC3, 0xDA,
+    0xD8, 0x76, 0x60, 0x41, 0xDB, 0xA9, 0x33, 0xB4, 0xDB, 0x03, 0x44, 0x18, 0xF4, 0x99, 0xD3, 0xB7,
+    0xDB, 0x5D, 0xE6, 0xC0, 0xFF, 0x00, 0xD9, 0x4D, 0xAC, 0x3E, 0x35, 0x41, 0x0B, 0xDC, 0x75, 0xE1,
+    0x2D, 0x10, 0xFD, 0xDD, 0xD8, 0x3F, 0x3E, 0x5A, 0xBA, 0xE9, 0x9C, 0xCD, 0xFC, 0x20, 0x98, 0x18,
+    0xD7, 0x6E, 0xDC, 0xB4, 0xAC, 0x59, 0x14, 0xA6, 0xD6, 0x34, 0x0A, 0xA2, 0xD8, 0x34, 0xA8, 0xC1,
+    0x8A, 0x96, 0xEE, 0xD4, 0x4F, 0x6F, 0x27, 0x86, 0xDD, 0x35, 0x18, 0xF0, 0xF5, 0xB6, 0xD3, 0xB5,
+    0x07, 0x3D, 0x36, 0x9C, 0x5A, 0x76, 0xAF, 0x6F, 0xD9, 0xDD, 0x1E, 0x74, 0x3E, 0xEA, 0x5A, 0x3D,
+    0xCB, 0x01, 0xFA, 0xF0, 0x70, 0xDA, 0xB7, 0x3B, 0x07, 0xAC, 0xCB, 0xEC, 0x03, 0x87, 0xC1, 0x10,
+    0x06, 0x76, 0x77, 0xC0, 0x86, 0x81, 0xD3, 0xB6, 0xDB, 0xC0, 0x7B, 0xC7, 0xEE, 0x0F, 0x6A, 0x06,
+    0xF1, 0x46, 0xD2, 0x24, 0x9E, 0xF6, 0x41, 0x0C, 0xC7, 0x17, 0x2D, 0xC7, 0x19, 0x5F, 0xD4, 0x33,
+    0x00, 0x83, 0xEB, 0xE3, 0x38, 0xFB, 0xD3, 0xB6, 0xD5, 0x01, 0x62, 0x1D, 0xBB, 0x63, 0xF5, 0x19,
+    0x0C, 0x6D, 0x8A, 0x7D, 0xB5, 0x99, 0x3D, 0x74, 0xEC, 0x76, 0x0F, 0x06, 0xD9, 0xEE, 0xDB, 0x8E,
+    0xF3, 0xE6, 0x4F, 0xE0, 0x37, 0x70, 0xEC, 0x51, 0x0F, 0xFA, 0xEE, 0x75, 0x7E, 0x46, 0x3E, 0x1E,
+    0x20, 0xCA, 0x32, 0xDF, 0x36, 0x70, 0xD5, 0xEE, 0x01, 0x4B, 0x03, 0xBB, 0x3D, 0xB4, 0xEC, 0xC1,
+    0x01, 0xB0, 0x37, 0xEA, 0xC0, 0x73, 0x17, 0xC8, 0x3A, 0xD0, 0x70, 0xD0, 0xB1, 0xBA, 0x76, 0x7F,
+    0x88, 0x37, 0x53, 0xAB, 0xCB, 0xDA, 0x30, 0x71, 0x0E, 0x0C, 0x69, 0x88, 0x13, 0x08, 0xBF, 0x23,
+    0x9C, 0xF7, 0x1E, 0xE8, 0xC4, 0xE0, 0x21, 0xFC, 0xC1, 0x9C, 0x31, 0x67, 0x70, 0x6D, 0x39, 0xD4,
+    0xB7, 0x63, 0xC3, 0xE0, 0x6D, 0x07, 0xDA, 0xFB, 0xEA, 0xEF, 0x99, 0x03, 0x34, 0xBA, 0xD8, 0xC3,
+    0x01, 0x71, 0xF8, 0xB3, 0x33, 0x00, 0x86, 0xFA, 0xD0, 0xAD, 0xC3, 0x00, 0x02, 0xDE, 0x5F, 0xF7,
+    0xA6, 0x20, 0x59, 0x1A, 0x01, 0xFE, 0x99, 0x83, 0xB0, 0xA1, 0x99, 0x39, 0x08, 0xE5, 0x58, 0xCE,
+    0xB5, 0xD5, 0xC3, 0x51, 0xF5, 0xF1, 0x7F, 0x07, 0xFF, 0xFC, 0xBE, 0x00, 0xAC, 0xF6, 0xDC, 0xEA,
+    0xAA, 0x5E, 0xED, 0x03, 0x60, 0xDE, 0x41, 0x68, 0x04, 0xB1, 0xFB, 0x09, 0xFC, 0xB5, 0x87, 0x4C,
+    0xBE, 0x81, 0x0E, 0x8B, 0x93, 0xDF, 0x69, 0x6F, 0x9B, 0xFC, 0x3F, 0x5B, 0xFB, 0xEE, 0x9D, 0xC6,
+    0x05, 0xD8, 0xDA, 0x88, 0x68, 0x75, 0x82, 0x3E, 0xDA, 0x1A, 0x98, 0x5D, 0xAF, 0x6E, 0x0E, 0xB0,
+    0xD1, 0x82, 0xC6, 0xFE, 0xA9, 0x73, 0x60, 0x1F, 0xF4, 0x11, 0xA5, 0x03, 0x5A, 0x39, 0x40, 0x29,
+    0xB7, 0xC9, 0x30, 0xDB, 0x89, 0x35, 0xC0, 0x16, 0x6C, 0x00, 0xC8, 0x0E, 0x52, 0xE8, 0x77, 0x34,
+    0x39, 0xFC, 0xA5, 0x8D, 0xC0, 0x01, 0x46, 0xEC, 0x3E, 0x29, 0x22, 0xEA, 0x34, 0x70, 0xD5, 0x05,
+    0x6A, 0xA7, 0x00, 0x32, 0x40, 0xE9, 0x40, 0x13, 0x2A, 0xE5, 0xE8, 0x20, 0x93, 0xD7, 0x14, 0xD8,
+    0x06, 0xAD, 0x42, 0xA9, 0xD1, 0x80, 0x41, 0x66, 0x28, 0x32, 0x14, 0x75, 0x0F, 0xE7, 0xA1, 0xFF,
+    0x57, 0xB4, 0x85, 0xEE, 0xFF, 0x61, 0x5B, 0xE8, 0xD2, 0xCC, 0xB5, 0xED, 0x51, 0x3F, 0x18, 0xD8,
+    0x23, 0x87, 0x1D, 0xD8, 0x03, 0xA7, 0x6E, 0x0E, 0xB0, 0xD1, 0xC2, 0xC6, 0xD3, 0x4E, 0x9B, 0xD4,
+    0xB2, 0x4D, 0x53, 0x3C, 0x40, 0xD6, 0x90, 0x19, 0x76, 0x90, 0x40, 0x33, 0x34, 0x74, 0xE0, 0x3D,
+    0xDC, 0xF5, 0x86, 0x70, 0x37, 0xEA, 0x6B, 0x62, 0xF8, 0xEB, 0x9A, 0x82, 0x0B, 0x1C, 0x74, 0x18,
+    0x5D, 0xDA, 0xA8, 0x47, 0x40, 0xB5, 0x33, 0x04, 0xB6, 0x06, 0x07, 0xB8, 0xA8, 0x77, 0x46, 0x20,
+    0xD6, 0x11, 0xE9, 0xE2, 0xA8, 0x27, 0xA5, 0x85, 0x86, 0x70, 0x80, 0x96, 0x50, 0x23, 0xB4, 0xDD,
+    0x33, 0xF1, 0xFF, 0xDD, 0x1A, 0x7A, 0x22, 0x3A, 0xFA, 0x9F, 0x8A, 0x42, 0x7A, 0x4E, 0xD6, 0x5D,
+    0x07, 0x85, 0xDA, 0xE9, 0xA1, 0x06, 0x77, 0x3A, 0x0C, 0x5C, 0x0E, 0xEA, 0x6F, 0x97, 0xF5, 0x70,
+    0x42, 0x7A, 0x67, 0x18, 0x86, 0xE1, 0x4B, 0x5C, 0x1C, 0x08, 0xCC, 0xEE, 0xF6, 0x71, 0x12, 0xBA,
+    0xD8, 0xC3, 0xC8, 0x86, 0xE6, 0x2E, 0xFC, 0x0C, 0x9D, 0x80, 0x9C, 0x1B, 0x5C, 0xBA, 0x01, 0xCD,
+    0x27, 0x5C, 0x50, 0x4F, 0x01, 0x62, 0x84, 0x1A, 0xDA, 0x11, 0xBF, 0x3D, 0x9C, 0xAA, 0x0E, 0x0E,
+    0x0B, 0x2F, 0x3F, 0x3B, 0x24, 0xA6, 0x1E, 0x44, 0x71, 0x23, 0x90, 0x16, 0x90, 0xEF, 0x82, 0x9C,
+    0x3A, 0x23, 0x10, 0x34, 0xCE, 0x57, 0x1F, 0xE7, 0xBD, 0x8D, 0xB3, 0x36, 0xC4, 0xA1, 0x0C, 0x87,
+    0x74, 0x37, 0x07, 0x5D, 0xE8, 0x05, 0x08, 0x26, 0x61, 0x31, 0xDA, 0x00, 0x27, 0x8B, 0xA2, 0x6E,
+    0x1F, 0x58, 0x18, 0x76, 0x40, 0x3F, 0x0F, 0x34, 0xF4, 0xB7, 0x9D, 0x8E, 0x50, 0x13, 0x52, 0x12,
+    0x98, 0xDA, 0x91, 0xD5, 0xC1, 0x3F, 0x89, 0xD5, 0x61, 0x78, 0xCF, 0x3A, 0xD7, 0x0E, 0xAA, 0x85,
+    0xD4, 0x8B, 0x9E, 0x50, 0x8C, 0x2E, 0x29, 0x46, 0x1F, 0x1E, 0xA5, 0x6A, 0xC0, 0x3A, 0xD9, 0x97,
+    0xBA, 0xD1, 0x93, 0xCA, 0xD1, 0x25, 0xE5, 0xE8, 0xD3, 0x34, 0x6A, 0xEA, 0xD1, 0x11, 0xBD, 0x09,
+    0x7C, 0x24, 0x67, 0x39, 0x09, 0x91, 0x46, 0x4A, 0xD7, 0x4E, 0x71, 0x92, 0x36, 0x87, 0x53, 0x8A,
+    0x9F, 0xF9, 0x2D, 0x3F, 0x8F, 0x96, 0x3C, 0x9C, 0x5C, 0xBC, 0xED, 0x38, 0x68, 0x4D, 0xA8, 0x0C,
+    0xA7, 0xCE, 0xC8, 0x1E, 0x31, 0xB2, 0x09, 0x5A, 0x7B, 0xC5, 0x7C, 0x25, 0xB0, 0x76, 0x8C, 0xD0,
+    0x5C, 0x1C, 0x6B, 0x84, 0x90, 0x43, 0x7B, 0xE0, 0x22, 0x8F, 0x6D, 0xF9, 0xC7, 0x3E, 0x38, 0xC5,
+    0xA5, 0x06, 0x63, 0xEA, 0x11, 0x23, 0x50, 0x5A, 0x82, 0x3A, 0xED, 0x64, 0x88, 0xE3, 0x45, 0x6A,
+    0x88, 0x67, 0x95, 0xF0, 0x60, 0x76, 0x7E, 0x7D, 0x8B, 0x4B, 0x15, 0x58, 0x28, 0x28, 0xD5, 0x90,
+    0xD6, 0x2A, 0x07, 0x27, 0x04, 0xA6, 0x01, 0x31, 0x07, 0xA0, 0x98, 0x07, 0x5D, 0xD4, 0x10, 0x54,
+    0x13, 0xB8, 0x1B, 0x20, 0xD9, 0x41, 0x82, 0x50, 0xE8, 0xB8, 0x44, 0x67, 0x60, 0x62, 0x0E, 0x2A,
+    0x0C, 0x4C, 0xA6, 0x83, 0xB1, 0x3D, 0x80, 0x11, 0xBF, 0x83, 0x5F, 0x17, 0x20, 0xDF, 0xB6, 0x0B,
+    0x6A, 0x43, 0x7E, 0xA2, 0x0D, 0xBF, 0x3D, 0xF9, 0x84, 0xBD, 0x83, 0xE2, 0x03, 0x04, 0x1B, 0xB8,
+    0xC0, 0x29, 0x01, 0x80, 0x86, 0x5B, 0x1D, 0xF9, 0x84, 0x62, 0x87, 0xBB, 0x5F, 0x2F, 0x0A, 0xD2,
+    0x9A, 0x06, 0x51, 0xC2, 0x41, 0x5C, 0xE8, 0xC2, 0x7B, 0x20, 0xA4, 0xF6, 0xC1, 0x73, 0x90, 0x54,
+    0x97, 0xD1, 0x45, 0xF8, 0x22, 0x64, 0x6F, 0x0A, 0x63, 0x39, 0x80, 0x27, 0x8D, 0x4B, 0x30, 0x2C,
+    0x17, 0x5C, 0x18, 0x3A, 0x10, 0xBA, 0x8A, 0x1E, 0x6C, 0x54, 0xDF, 0x41, 0x2F, 0x17, 0x8A, 0x65,
+    0x83, 0xD8, 0xFB, 0xFD, 0x82, 0x94, 0x30, 0xFB, 0x00, 0xA7, 0x07, 0x58, 0x90, 0xD5, 0x88, 0xAB,
+    0x6A, 0xE8, 0xA0, 0x16, 0x77, 0x75, 0x89, 0x0E, 0x47, 0xF5, 0x53, 0xE8, 0x0E, 0x11, 0x73, 0x98,
+    0xA1, 0xA3, 0x3A, 0x83, 0x1D, 0x4B, 0x64, 0xFC, 0x0B, 0xA6, 0x03, 0xE3, 0x7D, 0x8B, 0x52, 0x24,
+    0xAE, 0x0B, 0x4C, 0x91, 0x89, 0xE1, 0x25, 0x40, 0xDF, 0x06, 0xB1, 0x38, 0x34, 0xF6, 0x68, 0x4D,
+    0xA2, 0xAB, 0x00, 0x02, 0xDB, 0x85, 0xCE, 0xEC, 0x83, 0x87, 0x69, 0x86, 0x3B, 0xB2, 0x3B, 0x03,
+    0x46, 0x17, 0x01, 0x09, 0xE6, 0x4A, 0xFE, 0xAC, 0x07, 0x7D, 0x40, 0xE4, 0x07, 0x17, 0x5D, 0x0A,
+    0x68, 0xE4, 0xDA, 0x50, 0xF1, 0xD5, 0xAF, 0x0B, 0xF2, 0x55, 0x23, 0xDB, 0x19, 0x81, 0x03, 0xE8,
+    0x61, 0x70, 0xD8, 0xEB, 0x3F, 0x77, 0xD0, 0x8F, 0xD1, 0x25, 0x9B, 0x14, 0xA7, 0x57, 0x9C, 0x57,
+    0x98, 0xE5, 0x32, 0x0C, 0x25, 0x16, 0xFD, 0x4E, 0x51, 0x1F, 0x0F, 0xAA, 0xFA, 0xE8, 0x82, 0x37,
+    0x6C, 0x53, 0x3C, 0x0B, 0x57, 0x81, 0x08, 0xDE, 0x03, 0x80, 0x87, 0xA3, 0x37, 0x07, 0xE8, 0x5A,
+    0x9C, 0xF6, 0xF3, 0x4C, 0xC1, 0xA0, 0x53, 0x9C, 0xB0, 0x5E, 0xF7, 0x0D, 0xAE, 0x5D, 0x80, 0x35,
+    0x7C, 0x3E, 0xC4, 0xA1, 0xD1, 0x25, 0xE7, 0xEC, 0x20, 0xD3, 0xB1, 0xD4, 0xBD, 0x0C, 0xF8, 0xC4,
+    0x8B, 0xA6, 0xAB, 0x05, 0x0F, 0x53, 0xFB, 0x8A, 0xA7, 0x2F, 0x03, 0x8E, 0xB7, 0x2F, 0x6E, 0x5F,
+    0x7B, 0x4D, 0x83, 0x9A, 0xAD, 0xCB, 0xC8, 0xBB, 0x35, 0x4C, 0x89, 0x31, 0x8B, 0xE2, 0xC5, 0x76,
+    0x84, 0x90, 0xA7, 0x37, 0x51, 0xFC, 0xF9, 0x1C, 0xA1, 0x32, 0x94, 0x69, 0xE4, 0xF1, 0xF3, 0xC0,
+    0x4F, 0x52, 0x1E, 0xF2, 0x78, 0x3B, 0x2E, 0x82, 0x65, 0x38, 0x49, 0xE2, 0x7B, 0x0F, 0xC0, 0x41,
+    0xB0, 0x0C, 0x67, 0xE9, 0x26, 0x09, 0xF4, 0xFE, 0x10, 0x3C, 0x05, 0x9A, 0xE1, 0xAE, 0x12, 0x1E,
+    0x87, 0xEE, 0xE2, 0x21, 0x7C, 0x2A, 0xD0, 0x9C, 0x57, 0x1E, 0x5F, 0xFB, 0x53, 0x7E, 0xFE, 0x88,
+    0xFE, 0xCB, 0x28, 0x40, 0xCB, 0x9F, 0x35, 0x51, 0x6A, 0x26, 0x5E, 0x6C, 0xD7, 0xF3, 0x5E, 0x5E,
+    0x03, 0xF4, 0x1B, 0x49, 0x09, 0x30, 0x56, 0x97, 0x0B, 0x3F, 0x35, 0x5A, 0xE2, 0xF7, 0x15, 0x42,
+    0x22, 0x8A, 0x26, 0x5B, 0x53, 0x7B, 0xAA, 0x21, 0xE2, 0x87, 0xCB, 0x15, 0xD0, 0x58, 0x2D, 0x3D,
+    0x37, 0xE5, 0x3F, 0xBB, 0xC1, 0x8A, 0x13, 0x11, 0x4D, 0xD8, 0xA6, 0xF6, 0xF4, 0x70, 0x22, 0x95,
+    0xD1, 0x9B, 0x95, 0x37, 0x0F, 0x27, 0x56, 0x99, 0x0E, 0xB3, 0xF2, 0xE6, 0x11, 0xC3, 0xDB, 0x36,
+    0x3F, 0xE6, 0xD6, 0x96, 0x07, 0x12, 0x97, 0x7A, 0x17, 0xC5, 0xA9, 0x1B, 0x9C, 0xC3, 0xC3, 0xCC,
+    0xBF, 0x9A, 0xFC, 0xDB, 0xD9, 0x4F, 0xEF, 0xEC, 0xA5, 0x1B, 0x27, 0xBC, 0xB9, 0x5D, 0xFD, 0x08,
+    0xC3, 0x12, 0x18, 0x86, 0x69, 0xA7, 0xFC, 0x4B, 0x7A, 0x0A, 0x4B, 0x3A, 0x00, 0x28, 0xA2, 0xA9,
+    0x9F, 0x06, 0xFC, 0x1C, 0x1B, 0x26, 0x1A, 0x7D, 0x9B, 0x1A, 0x34, 0x20, 0x50, 0x89, 0x12, 0x0C,
+    0xBC, 0xA9, 0x82, 0xF9, 0xE1, 0x2C, 0x2A, 0xC1, 0xE1, 0x2B, 0x09, 0x43, 0xC3, 0x3B, 0x27, 0x09,
+    0xD7, 0x74, 0x2A, 0x5A, 0xB1, 0x41, 0x03, 0x0F, 0x78, 0x78, 0x35, 0xAF, 0x87, 0xC5, 0xA6, 0x74,
+    0x9E, 0x79, 0x80, 0x30, 0xE4, 0xD3, 0xD4, 0x8F, 0x42, 0x60, 0x76, 0x3A, 0xE5, 0x49, 0x32, 0x5B,
+    0x05, 0x75, 0xFD, 0xD4, 0x02, 0x66, 0x9E, 0x27, 0x4A, 0x79, 0x5C, 0x87, 0x25, 0x5A, 0x24, 0x58,
+    0xCC, 0x13, 0x9E, 0x8A, 0x96, 0x78, 0xE1, 0x12, 0xA9, 0x1A, 0x94, 0x2A, 0x54, 0xD9, 0x11, 0xD4,
+    0x20, 0x69, 0x6D, 0xDB, 0x8C, 0xBF, 0x06, 0xAF, 0x16, 0x46, 0xE1, 0xCF, 0xA3, 0x9B, 0x73, 0x21,
+    0xB2, 0x99, 0xCF, 0x03, 0xAF, 0x8C, 0x9A, 0x35, 0x17, 0xE1, 0x83, 0xE8, 0xCA, 0x0F, 0x05, 0x7C,
+    0x52, 0x87, 0x40, 0xED, 0x9A, 0x3C, 0xF0, 0x75, 0x1D, 0x24, 0xB5, 0x1E, 0xCE, 0x78, 0x3A, 0x9D,
+    0x37, 0xF5, 0x66, 0xA0, 0x11, 0x81, 0x66, 0xCE, 0x79, 0xD8, 0x6C, 0x02, 0xD4, 0x12, 0x88, 0x71,
+    0x73, 0x72, 0x9C, 0xDD, 0xDB, 0xD1, 0xE7, 0x93, 0xEC, 0x1E, 0x07, 0xD4, 0x34, 0xC7, 0x86, 0x61,
+    0x2A, 0x14, 0x88, 0xFC, 0x00, 0x7A, 0x2D, 0x78, 0x40, 0x5A, 0xA8, 0xDF, 0xAE, 0xBF, 0xD3, 0x2B,
+    0x22, 0x18, 0x1A, 0x85, 0x80, 0x13, 0x3E, 0x51, 0x43, 0x35, 0xB5, 0x27, 0xD0, 0x34, 0xB8, 0xFE,
+    0xF8, 0xF1, 0xED, 0x9B, 0x09, 0xF4, 0x76, 0xB8, 0x31, 0xED, 0xA9, 0x8B, 0xE3, 0x68, 0x62, 0xC7,
+    0x1B, 0xF3, 0xF0, 0xC6, 0x0F, 0xBD, 0xE8, 0xA6, 0xC6, 0x94, 0x7F, 0xF8, 0xE9, 0xAD, 0xB4, 0xB6,
+    0x37, 0x91, 0xEB, 0x71, 0xCF, 0x68, 0x35, 0x39, 0x42, 0x20, 0x5E, 0x1A, 0xDF, 0x4A, 0xA6, 0x93,
+    0xF4, 0x16, 0xD6, 0x46, 0xE0, 0xF1, 0x34, 0x5A, 0x80, 0xFC, 0xB9, 0x77, 0x86, 0x2F, 0x72, 0xA3,
+    0x56, 0x37, 0x72, 0x08, 0xCA, 0x70, 0xE7, 0xFC, 0xCB, 0x84, 0x50, 0x71, 0x78, 0xEF, 0x63, 0x88,
+    0x77, 0xE3, 0xF4, 0x96, 0xFC, 0x45, 0xB3, 0x61, 0x59, 0x20, 0x9C, 0x05, 0x17, 0x91, 0x7B, 0x03,
+    0x44, 0x15, 0xFB, 0x8B, 0x26, 0x0D, 0x13, 0xB0, 0xF6, 0xF6, 0xE0, 0x62, 0x27, 0xA9, 0x1B, 0xA7,
+    0xC9, 0x3F, 0xFC, 0x74, 0xDE, 0x6C, 0x7C, 0xD7, 0x30, 0xF7, 0xF6, 0xB0, 0xC9, 0x16, 0xD6, 0x34,
+    0x99, 0x4C, 0x86, 0x77, 0x77, 0xDA, 0x73, 0xCF, 0x34, 0x25, 0xBB, 0x60, 0x28, 0xC1, 0x8F, 0xD0,
+    0xB7, 0xDE, 0x7C, 0x72, 0xF1, 0xDD, 0xB3, 0x35, 0xBC, 0xFA, 0xE4, 0xFC, 0xB6, 0x29, 0xDD, 0x74,
+    0x2A, 0x37, 0xDD, 0xC2, 0xCD, 0xC5, 0x18, 0x6E, 0x94, 0x0A, 0x4D, 0xC8, 0x9F, 0xBD, 0x0E, 0xD3,
+    0xA6, 0xEC, 0x05, 0x3D, 0x4C, 0x02, 0xDC, 0x87, 0x57, 0x4D, 0xA7, 0xD5, 0x35, 0x5B, 0xCE, 0x40,
+    0x0D, 0xFF, 0x6A, 0x17, 0x6C, 0xB7, 0xD5, 0x2F, 0xC2, 0x5E, 0xEE, 0x82, 0xED, 0xB7, 0x86, 0x02,
+    0x76, 0x9B, 0xC0, 0x6D, 0x21, 0xE5, 0x24, 0x97, 0x72, 0x49, 0xC0, 0x56, 0xDC, 0x68, 0xC5, 0x5F,
+    0x83, 0x7F, 0xD5, 0x68, 0x5D, 0x7D, 0x0D, 0xFE, 0x65, 0xA3, 0x75, 0x69, 0x1E, 0x6E, 0x78, 0x90,
+    0x70, 0x9A, 0xA4, 0x08, 0xC0, 0x6F, 0xDC, 0x38, 0x6C, 0x1A, 0xA7, 0xD1, 0x2A, 0xF0, 0x58, 0x18,
+    0x61, 0xD0, 0x02, 0x12, 0x60, 0x1A, 0x1E, 0xC6, 0x58, 0xF0, 0x77, 0xBA, 0x4A, 0x18, 0x4A, 0x62,
+    0x6C, 0xB4, 0x60, 0x2A, 0x80, 0xCE, 0x46, 0xA8, 0x37, 0x37, 0x33, 0x62, 0x3C, 0x8E, 0x23, 0xD0,
+    0xE7, 0x97, 0xF8, 0x03, 0x9E, 0x28, 0x4D, 0x01, 0x9C, 0x11, 0x25, 0x26, 0x28, 0x7D, 0xF8, 0xFB,
+    0x0B, 0x06, 0x19, 0xA3, 0x8F, 0x71, 0x5C, 0x02, 0x84, 0x60, 0xCD, 0xDA, 0x3C, 0x11, 0xC2, 0x77,
+    0x97, 0xCB, 0x8F, 0xB8, 0x2E, 0x6C, 0x37, 0x47, 0x80, 0xB0, 0x68, 0xE9, 0xC8, 0x22, 0x1D, 0x78,
+    0x73, 0x26, 0x97, 0x96, 0xDD, 0x68, 0x6A, 0x01, 0xCA, 0x30, 0x71, 0xA5, 0xF9, 0x88, 0x9E, 0x71,
+    0x2B, 0x1A, 0x42, 0x58, 0xE8, 0x47, 0xB4, 0xB8, 0xF1, 0x35, 0xBA, 0xBE, 0x07, 0xC6, 0x8C, 0xF8,
+    0xF0, 0xC6, 0xBD, 0xE4, 0xC1, 0x0E, 0x0F, 0x83, 0xCD, 0x96, 0x86, 0x85, 0x4E, 0xFD, 0x41, 0x58,
+    0x95, 0xB8, 0x0F, 0x5F, 0xDC, 0xC3, 0xDF, 0xB6, 0x58, 0xF1, 0x3D, 0xAC, 0x04, 0x0F, 0xEA, 0x54,
+    0xC2, 0x5B, 0x95, 0x80, 0xB5, 0x40, 0xE8, 0x1E, 0x1E, 0x6A, 0x62, 0x4D, 0x25, 0xAF, 0xE5, 0x6D,
+    0xEC, 0xC3, 0x02, 0xBE, 0x7B, 0x62, 0x32, 0xB0, 0x0C, 0x91, 0x16, 0x8D, 0x37, 0x7E, 0xF8, 0x79,
+    0x3B, 0xD2, 0xCC, 0x9D, 0xA6, 0x51, 0x7C, 0x1B, 0x00, 0x90, 0xF0, 0xE3, 0x4A, 0xDD, 0x4C, 0x75,
+    0x53, 0x0C, 0x7A, 0x26, 0x79, 0xB4, 0x23, 0x61, 0x95, 0x9A, 0x99, 0x85, 0xFB, 0x1A, 0x0C, 0xD0,
+    0x33, 0x44, 0x50, 0xDA, 0x65, 0xAA, 0x9B, 0x1A, 0x50, 0x8A, 0x75, 0x64, 0xC4, 0x4C, 0x12, 0x43,
+    0x33, 0x92, 0xB7, 0x68, 0xC4, 0xCF, 0x53, 0xF0, 0x3B, 0x97, 0xE0, 0xE7, 0x9B, 0xC6, 0xC2, 0xFD,
+    0x22, 0x3C, 0xA8, 0xD1, 0x2A, 0xC6, 0x39, 0x38, 0x7C, 0x85, 0xB0, 0x0C, 0xDC, 0x29, 0x9F, 0x47,
+    0x81, 0x07, 0xEB, 0x59, 0x29, 0x74, 0x02, 0x0B, 0x93, 0xDD, 0xD0, 0x0C, 0x9B, 0xD9, 0x9D, 0xC6,
+    0x54, 0x19, 0x49, 0x06, 0xBD, 0x02, 0x25, 0xBB, 0xD3, 0x50, 0xF4, 0xF0, 0x43, 0x22, 0x88, 0xA1,
+    0x64, 0x77, 0x1A, 0x63, 0x15, 0x84, 0xB2, 0xF6, 0x99, 0xE5, 0x17, 0x5A, 0x7F, 0xF5, 0x61, 0x8B,
+    0x4E, 0x46, 0x74, 0x5F, 0x7E, 0xA1, 0x71, 0xB1, 0x95, 0x8C, 0xA6, 0x7F, 0xA6, 0xF6, 0xA4, 0xF1,
+    0x51, 0x08, 0xFC, 0x10, 0xED, 0x69, 0x1E, 0xD1, 0xEC, 0xED, 0x65, 0xAA, 0x68, 0xAE, 0xB3, 0x5B,
+    0xE9, 0x98, 0x3D, 0x3F, 0x01, 0x36, 0x6E, 0x27, 0x46, 0x18, 0x85, 0xDC, 0x00, 0xF7, 0xF9, 0x07,
+    0x23, 0x02, 0xE8, 0xF2, 0x79, 0x1C, 0xBB, 0xB7, 0xB6, 0x9F, 0xD0, 0x6F, 0x29, 0x4E, 0x92, 0x29,
+    0xAF, 0x89, 0x0C, 0x84, 0x30, 0xDE, 0x77, 0xE2, 0x39, 0xA9, 0x07, 0x6B, 0xCD, 0x5C, 0x58, 0x0D,
+    0xCC, 0x43, 0xE4, 0x1E, 0x15, 0xE3, 0x15, 0xC6, 0x70, 0xCD, 0xA7, 0x4F, 0xCB, 0x61, 0xA0, 0x80,
+    0x78, 0x83, 0x71, 0x1C, 0x81, 0x24, 0x0A, 0xA6, 0x18, 0xFA, 0xA9, 0xB5, 0x25, 0x00, 0x9E, 0xCF,
+    0xCE, 0x5E, 0xFF, 0xD0, 0x34, 0x69, 0x94, 0xB3, 0x55, 0x48, 0x21, 0x34, 0x2B, 0xE4, 0x2A, 0xB8,
+    0x6A, 0x20, 0x3E, 0x2D, 0x15, 0x4D, 0x30, 0x25, 0x37, 0x06, 0x93, 0xB5, 0x7D, 0xAF, 0x65, 0x18,
+    0x8A, 0xA7, 0xCD, 0x93, 0x0C, 0xD3, 0x4F, 0x3E, 0xB8, 0x9E, 0x1F, 0x9D, 0xCE, 0xF9, 0xF4, 0x33,
+    0xF7, 0x9A, 0x38, 0xB6, 0x74, 0x15, 0x87, 0x4C, 0x08, 0x62, 0x16, 0x47, 0x8B, 0x3C, 0x0E, 0xFA,
+    0xD7, 0x8A, 0xC7, 0xB7, 0x67, 0x3C, 0xE0, 0x68, 0xF1, 0xCF, 0x83, 0xA0, 0xD9, 0xA0, 0x71, 0x7C,
+    0x42, 0xCD, 0x9B, 0x88, 0x0C, 0xFD, 0xB7, 0x06, 0xC4, 0x85, 0x49, 0xB4, 0xE0, 0x10, 0x4A, 0x22,
+    0x5D, 0x10, 0x2B, 0xFD, 0xDA, 0x53, 0xD1, 0x81, 0xD6, 0x77, 0xCE, 0x26, 0x52, 0x68, 0x2D, 0x20,
+    0x09, 0x70, 0xAF, 0x78, 0x0B, 0x02, 0xA3, 0x94, 0x67, 0xC1, 0x0E, 0x8E, 0xFF, 0x1D, 0x76, 0x80,
+    0x30, 0x27, 0x78, 0xB1, 0xD3, 0xE8, 0x4D, 0x74, 0xC3, 0xE3, 0x53, 0x17, 0x32, 0x2F, 0x73, 0xDC,
+    0x68, 0x90, 0xAE, 0x64, 0x80, 0xA6, 0x18, 0x81, 0x8A, 0x3C, 0x82, 0x68, 0xBA, 0xDD, 0x7B, 0x5D,
+    0xD0, 0xBA, 0x6A, 0x3D, 0x5B, 0x67, 0xD8, 0x1B, 0x8B, 0xC6, 0x74, 0xA1, 0x3C, 0xA0, 0x64, 0x0A,
+    0x91, 0x1E, 0x45, 0x45, 0xE2, 0x5D, 0x90, 0x4B, 0x24, 0x26, 0xCC, 0x35, 0xFD, 0xD8, 0xD3, 0x00,
+    0x6D, 0x10, 0x14, 0x12, 0xC6, 0x71, 0x75, 0x05, 0x71, 0xA6, 0x41, 0xE8, 0x86, 0x1C, 0xB7, 0x98,
+    0x69, 0x86, 0x45, 0x82, 0x6C, 0xE8, 0x93, 0x49, 0x43, 0x54, 0x03, 0x1A, 0x4A, 0x2C, 0xE2, 0x91,
+    0x84, 0xB7, 0x93, 0xB5, 0x86, 0x60, 0x4D, 0x80, 0x2B, 0xA6, 0x1A, 0x22, 0x59, 0xD6, 0x49, 0x98,
+    0xA5, 0x67, 0xDD, 0x41, 0x20, 0x6B, 0x27, 0x12, 0x1D, 0x82, 0x7F, 0xE1, 0xF9, 0x0A, 0xB2, 0x31,
+    0x0B, 0xF7, 0xF7, 0x61, 0x66, 0xF3, 0x4F, 0x76, 0x4C, 0x1D, 0x26, 0xA0, 0x78, 0x9F, 0xB2, 0xCA,
+    0x87, 0x58, 0xEC, 0x5B, 0x79, 0xED, 0xA6, 0x25, 0x94, 0xAB, 0x95, 0xAF, 0xB2, 0xAD, 0xEA, 0x62,
+    0xF7, 0x1B, 0x64, 0x87, 0xF1, 0x4B, 0x17, 0xD3, 0x02, 0x61, 0x58, 0x60, 0xD1, 0xB9, 0x86, 0xD1,
+    0xAB, 0xA2, 0x09, 0x68, 0x9A, 0xA8, 0xB2, 0xD1, 0xF0, 0xEA, 0x0C, 0xF9, 0x6D, 0x12, 0xD7, 0x2D,
+    0x1C, 0x87, 0x12, 0x38, 0xC6, 0x67, 0xBB, 0x56, 0x4E, 0x85, 0x6F, 0x21, 0x60, 0xBE, 0x76, 0xD3,
+    0x88, 0x5E, 0xA4, 0xE1, 0x8E, 0x45, 0x5B, 0x4C, 0xCD, 0x65, 0x1A, 0x8A, 0xE5, 0xF3, 0x69, 0x86,
+    0xA3, 0x6C, 0x31, 0x0B, 0xE4, 0x60, 0xCD, 0x4A, 0xA3, 0xF0, 0xE3, 0x17, 0x25, 0xD5, 0x26, 0x32,
+    0x78, 0x77, 0x07, 0x31, 0xA6, 0xEA, 0xDD, 0x80, 0xCC, 0x4C, 0x3E, 0x19, 0x48, 0x0C, 0x99, 0x31,
+    0xF1, 0x52, 0xF2, 0x94, 0x02, 0x1F, 0x22, 0x31, 0x58, 0xB6, 0xB9, 0x45, 0x7A, 0x69, 0x8C, 0xA5,
+    0xFB, 0x0C, 0x78, 0xCA, 0x90, 0xF0, 0x3B, 0x98, 0x84, 0x49, 0xC1, 0x0D, 0x64, 0x7C, 0x81, 0x2D,
+    0xFB, 0xA0, 0x98, 0xD0, 0x9C, 0x98, 0xF6, 0x0C, 0x1C, 0x6D, 0x33, 0x44, 0xD0, 0x63, 0xBC, 0xDA,
+    0x78, 0xF9, 0x78, 0xBB, 0x44, 0x9D, 0x45, 0x08, 0xFB, 0xE3, 0xCB, 0xFF, 0xFC, 0x78, 0xFE, 0xEE,
+    0xA7, 0x1F, 0x5E, 0xEE, 0xED, 0x51, 0x7B, 0x41, 0x37, 0x64, 0x52, 0xF4, 0x14, 0xB4, 0x5B, 0x68,
+    0xA4, 0xEA, 0xD5, 0x5C, 0xAB, 0x3B, 0x4D, 0x95, 0xB2, 0xE1, 0x7F, 0x2F, 0xE6, 0xE7, 0xA4, 0xC1,
+    0x1A, 0x63, 0x44, 0x15, 0xBE, 0x31, 0xE7, 0xCF, 0x87, 0x44, 0x35, 0x4E, 0x5F, 0x70, 0xD0, 0x87,
+    0x42, 0x16, 0x37, 0x8D, 0x39, 0x20, 0x7D, 0x94, 0x94, 0x9B, 0xDB, 0xA8, 0x99, 0xAD, 0x9C, 0xD0,
+    0xCC, 0x8F, 0x93, 0xF4, 0x14, 0x47, 0x8B, 0xDA, 0x92, 0xBF, 0x07, 0x31, 0x62, 0x9C, 0xED, 0x09,
+    0x39, 0x6A, 0x2E, 0x2D, 0x2B, 0xDA, 0xC9, 0x65, 0x65, 0x4D, 0x3F, 0xF6, 0x32, 0xA6, 0xDF, 0x1F,
+    0xF8, 0xCC, 0x5D, 0x05, 0x90, 0x40, 0x4B, 0xFD, 0xB8, 0x76, 0x03, 0xDF, 0xA3, 0xA2, 0x44, 0x32,
+    0xF9, 0x84, 0x9A, 0xE6, 0xF9, 0xF8, 0x30, 0x7E, 0x5A, 0x76, 0xCB, 0x2D, 0xD2, 0xDF, 0x71, 0x66,
+    0x22, 0x99, 0x41, 0xBD, 0x0F, 0x38, 0xB8, 0x41, 0x08, 0x12, 0xD1, 0x2B, 0x33, 0x97, 0xFD, 0xC3,
+    0x7F, 0xE5, 0x33, 0xB9, 0x04, 0x31, 0xCC, 0x15, 0x96, 0x7C, 0xEA, 0xCF, 0x6E, 0xA1, 0x65, 0xEE,
+    0x7B, 0x1E, 0x0F, 0x19, 0xCC, 0xB1, 0x6D, 0xB4, 0x36, 0xAD, 0x42, 0x6F, 0x7E, 0x72, 0x0A, 0x12,
+    0xF9, 0xD9, 0x4F, 0x7C, 0x18, 0x54, 0x13, 0x32, 0xD1, 0xF2, 0x1A, 0xA5, 0x7A, 0x17, 0x76, 0xA9,
+    0xFA, 0x16, 0xE9, 0x77, 0x36, 0x90, 0x15, 0x9F, 0x68, 0x55, 0xC9, 0x13, 0xBD, 0x46, 0x49, 0x10,
+    0x72, 0xCA, 0x95, 0xCF, 0xA6, 0x77, 0xD5, 0xEE, 0x94, 0xE2, 0x5F, 0x3C, 0x5B, 0x97, 0x82, 0xA7,
+    0x0D, 0xAC, 0x57, 0xE0, 0x36, 0xFE, 0xB5, 0xF2, 0x63, 0xEE, 0xD9, 0x17, 0xC2, 0x0D, 0x49, 0x2A,
+    0xA2, 0x03, 0x11, 0xCE, 0x1D, 0x6B, 0xD1, 0xDC, 0x0E, 0x72, 0x53, 0x37, 0xC4, 0xDC, 0x8C, 0x7F,
+    0x99, 0x72, 0xEE, 0x31, 0x05, 0x20, 0xF0, 0xA0, 0x75, 0xEE, 0xC6, 0x10, 0xDE, 0xF2, 0x38, 0xA1,
+    0xBE, 0xE4, 0xD2, 0x18, 0x42, 0x06, 0x0B, 0xFE, 0x03, 0x26, 0xA5, 0x24, 0x45, 0x5A, 0xC4, 0xCB,
+    0x62, 0x2C, 0x2E, 0xE3, 0x90, 0xE3, 0x3F, 0xAD, 0x94, 0x37, 0xEF, 0xEE, 0xAA, 0xEF, 0x34, 0x69,
+    0x65, 0x93, 0x9F, 0x7B, 0x3F, 0x35, 0x05, 0x30, 0x24, 0x2D, 0xF4, 0x2B, 0xC9, 0xE7, 0x0F, 0x31,
+    0xB8, 0xB5, 0x54, 0x0A, 0x8C, 0x6E, 0x2F, 0xA3, 0x12, 0xC3, 0xB9, 0x9A, 0x96, 0x9D, 0x73, 0x91,
+    0xE3, 0xDA, 0x30, 0xF1, 0x1E, 0xCE, 0x7F, 0x24, 0xE5, 0x45, 0x9E, 0x81, 0xC1, 0x62, 0xD9, 0x1A,
+    0x99, 0xD2, 0xCA, 0xD8, 0xB5, 0x92, 0x13, 0xCB, 0x47, 0x66, 0x34, 0x82, 0x1A, 0x93, 0x01, 0x1C,
+    0xC3, 0x88, 0x4A, 0xEB, 0xBE, 0x64, 0x1F, 0x4D, 0x88, 0x07, 0x57, 0xE9, 0xBC, 0x69, 0xDE, 0xDD,
+    0xE5, 0x9C, 0x10, 0x2B, 0x75, 0x32, 0xBA, 0x4F, 0x36, 0x55, 0x99, 0x18, 0x8A, 0x91, 0xF7, 0xB2,
+    0xA9, 0xC2, 0xCC, 0x6F, 0xE4, 0x95, 0xE7, 0x6E, 0x22, 0x56, 0xCB, 0x09, 0x2D, 0x62, 0x87, 0xDA,
+    0xFA, 0x79, 0x58, 0xF0, 0x25, 0xF9, 0x4A, 0x98, 0x8F, 0x42, 0x74, 0xAF, 0xFA, 0xDC, 0xE4, 0xA6,
+    0x4B, 0x11, 0xC2, 0x5B, 0xF1, 0x7A, 0x92, 0x82, 0xEB, 0x8E, 0x66, 0x2A, 0xEA, 0xC1, 0xC0, 0x43,
+    0xB9, 0xB6, 0x86, 0x5A, 0xC4, 0xC1, 0x7C, 0xE5, 0x9D, 0x08, 0xED, 0x25, 0xFD, 0xBD, 0xBD, 0x22,
+    0x21, 0xB3, 0xB2, 0xF4, 0x16, 0x5B, 0x5B, 0x69, 0x8C, 0x45, 0xF5, 0x7C, 0x3C, 0xF8, 0x4C, 0x11,
+    0x2D, 0x16, 0xC8, 0xD4, 0xDB, 0x42, 0x20, 0xA7, 0x2D, 0xCE, 0x02, 0x59, 0xFA, 0x60, 0x72, 0xB5,
+    0xE2, 0x0D, 0x8A, 0x68, 0xE9, 0xDE, 0x62, 0x8C, 0x3C, 0x59, 0x6F, 0x28, 0x5B, 0xCC, 0x67, 0x6B,
+    0x2D, 0x5B, 0x6C, 0x54, 0x85, 0x89, 0xA6, 0x32, 0x27, 0xDB, 0x15, 0x08, 0x1D, 0x55, 0x5E, 0xD5,
+    0x49, 0xA5, 0x9B, 0xE5, 0x1E, 0x39, 0xE7, 0x49, 0x7D, 0x60, 0x5C, 0x17, 0x15, 0x8F, 0x65, 0xF8,
+    0x2B, 0x23, 0xAF, 0x22, 0x95, 0x32, 0x67, 0xC5, 0x36, 0xC1, 0x4B, 0xA9, 0xAE, 0x24, 0x4B, 0x41,
+    0xEF, 0x22, 0xA1, 0xB7, 0x0A, 0x81, 0xC1, 0x72, 0xBC, 0xF4, 0x53, 0x4E, 0x9B, 0x63, 0x58, 0x1D,
+    0xCA, 0xF5, 0xC1, 0x10, 0x39, 0x86, 0x98, 0x8D, 0x3C, 0xCA, 0x7A, 0x0D, 0xCB, 0x2A, 0xB8, 0x8E,
+    0x80, 0x51, 0xC3, 0x98, 0x95, 0x29, 0x82, 0xE6, 0x09, 0xC1, 0x96, 0x27, 0x40, 0x86, 0x50, 0xC5,
+    0x19, 0x90, 0xAF, 0x54, 0xC0, 0x42, 0x7E, 0x79, 0x9B, 0xD9, 0x54, 0x0C, 0xA4, 0xE6, 0x95, 0xB4,
+    0x99, 0x4C, 0x36, 0x0A, 0x60, 0xB2, 0x05, 0x52, 0xAC, 0x04, 0xF7, 0x2E, 0x64, 0x7B, 0x7B, 0xFA,
+    0x36, 0x5A, 0x46, 0x1F, 0x5F, 0x4F, 0xB6, 0x2F, 0x58, 0x8A, 0xFC, 0xBD, 0x0E, 0x34, 0xA7, 0xA8,
+    0xFC, 0xF2, 0xA4, 0xE2, 0xDC, 0x4F, 0x76, 0xBB, 0x7B, 0xD4, 0xB9, 0x4C, 0x25, 0x4A, 0xAE, 0x72,
+    0xB2, 0xD5, 0x01, 0x9F, 0xDC, 0xE3, 0x9A, 0x49, 0x93, 0x9F, 0x88, 0xF2, 0xBF, 0xB1, 0x2F, 0x52,
+    0xD5, 0x55, 0x0C, 0x4B, 0xC9, 0x7A, 0xC1, 0xD3, 0x79, 0x04, 0x7E, 0xE9, 0xFD, 0x4F, 0x67, 0x1F,
+    0xB1, 0x00, 0x09, 0x59, 0x71, 0x9C, 0x8C, 0xD7, 0x86, 0x0C, 0xBB, 0x2C, 0x8C, 0xE6, 0x20, 0x38,
+    0x74, 0x97, 0xCB, 0xC0, 0x9F, 0x92, 0x3E, 0xED, 0xFF, 0x33, 0x01, 0xA5, 0xDA, 0xB4, 0x70, 0xBB,
+    0x78, 0x4C, 0xBB, 0x60, 0xA2, 0x92, 0x0B, 0x71, 0x46, 0x53, 0x72, 0x0E, 0x6B, 0x63, 0xCD, 0x96,
+    0xC2, 0x5A, 0x26, 0xF5, 0x6A, 0x5B, 0x81, 0xB2, 0x7A, 0xF1, 0x80, 0x91, 0xD4, 0x2A, 0x81, 0x58,
+    0xB0, 0xD7, 0x1E, 0x65, 0x49, 0x68, 0x69, 0xD7, 0x41, 0x10, 0xA4, 0x6D, 0x97, 0xE3, 0xB2, 0x39,
+    0x9C, 0xAA, 0x11, 0x91, 0xE3, 0xE4, 0x98, 0x39, 0xBA, 0x3E, 0x84, 0x68, 0x63, 0xA3, 0x55, 0xEA,
+    0x43, 0x84, 0xF5, 0x87, 0xE9, 0x3C, 0x8E, 0x6E, 0x20, 0x52, 0xBA, 0x11, 0xEA, 0xDF, 0xBC, 0x38,
+    0xCD, 0x76, 0xA4, 0xCA, 0x24, 0x20, 0x2E, 0x28, 0xD1, 0xD8, 0x5C, 0xC8, 0x0C, 0xA2, 0xCC, 0x28,
+    0x4A, 0x06, 0xD5, 0x25, 0xDB, 0x1C, 0x21, 0x70, 0x18, 0xFA, 0x2C, 0x0A, 0x82, 0xE8, 0x46, 0xF6,
+    0x21, 0x5F, 0xB7, 0xA4, 0xB0, 0x5A, 0x6D, 0x33, 0xDB, 0xD1, 0xA0, 0xE1, 0x98, 0xD5, 0xF1, 0xBD,
+    0xC2, 0x99, 0x13, 0xBE, 0x9A, 0x79, 0x2B, 0x94, 0x36, 0xCB, 0x26, 0x11, 0xCB, 0xBD, 0x84, 0x56,
+    0x67, 0xE6, 0x17, 0x2F, 0x4B, 0x38, 0x72, 0x90, 0x36, 0x93, 0xA1, 0x23, 0xB9, 0x26, 0xF0, 0x1E,
+    0xA8, 0x3D, 0xB8, 0x7F, 0x03, 0xB1, 0xCE, 0xA3, 0xED, 0x7E, 0x93, 0x57, 0x9B, 0x25, 0xD2, 0xF9,
+    0x12, 0xFC, 0xB8, 0xDC, 0x5B, 0x5B, 0x83, 0x4A, 0x46, 0x53, 0xDF, 0x4D, 0xA9, 0xC6, 0x5D, 0xC8,
+    0x56, 0x5A, 0xDE, 0x7C, 0xBA, 0x1C, 0x1B, 0x7F, 0x97, 0xF5, 0x6C, 0xD7, 0xF3, 0x40, 0x90, 0x89,
+    0xD1, 0x52, 0xAE, 0x8B, 0xC0, 0x91, 0x3D, 0x02, 0xDE, 0xE4, 0xF5, 0x8E, 0x9D, 0xD2, 0x5C, 0xF8,
+    0x49, 0x02, 0xA9, 0x09, 0x2A, 0x9B, 0x68, 0xB1, 0x89, 0x17, 0x58, 0xCC, 0x0C, 0x0F, 0x33, 0x1C,
+    0x58, 0x9B, 0xC4, 0x8E, 0xE3, 0x7B, 0x5C, 0xCD, 0x8A, 0xDE, 0x37, 0x77, 0x60, 0x4F, 0x6A, 0x90,
+    0x85, 0x36, 0x18, 0x77, 0x77, 0xE5, 0x06, 0xDF, 0xC3, 0xFA, 0xF7, 0x5A, 0x8E, 0xFC, 0x15, 0x81,
+    0x29, 0x6C, 0x48, 0x3A, 0x40, 0x25, 0xEE, 0xEE, 0x1A, 0xFF, 0x11, 0x7E, 0x0E, 0xA3, 0x9B, 0xB0,
+    0xA1, 0xD8, 0x2C, 0xF4, 0x55, 0xB7, 0xC0, 0xB5, 0xAA, 0x72, 0xFC, 0x54, 0xEC, 0xF7, 0x37, 0x98,
+    0x6C, 0x9E, 0x7E, 0xF4, 0x17, 0x3C, 0x5A, 0xA5, 0x22, 0x12, 0x57, 0xC6, 0x2D, 0xC0, 0x8C, 0x07,
+    0xD8, 0x1F, 0x24, 0x5A, 0x65, 0x2B, 0x38, 0x23, 0xE4, 0x07, 0x5A, 0xC0, 0xBD, 0xEA, 0x1F, 0xA2,
+    0xA9, 0x95, 0x95, 0x1F, 0x5F, 0xEE, 0x54, 0x7D, 0x2C, 0x2D, 0xD0, 0x1C, 0x1E, 0x4F, 0x9C, 0x76,
+    0x65, 0x0F, 0xE4, 0x4D, 0x84, 0x1B, 0xDD, 0x73, 0xAE, 0x54, 0xF6, 0x06, 0xF2, 0x33, 0x5E, 0xC8,
+    0xE0, 0x73, 0x6B, 0xD0, 0x27, 0x64, 0xD7, 0x0C, 0x3C, 0x40, 0x9F, 0xBE, 0x77, 0x84, 0x9A, 0xB7,
+    0xFA, 0xED, 0x76, 0x5D, 0xED, 0x40, 0xF6, 0x22, 0xE6, 0x3B, 0xEB, 0xA2, 0xB2, 0x1B, 0x94, 0xF9,
+    0x18, 0x21, 0x59, 0x9B, 0x7D, 0x20, 0x04, 0x72, 0x53, 0x78, 0x43, 0x01, 0x82, 0xB8, 0x45, 0xD5,
+    0x12, 0x1B, 0x18, 0x85, 0x60, 0x4A, 0xE6, 0x60, 0x17, 0xAF, 0x43, 0x32, 0x12, 0x56, 0xCD, 0x69,
+    0x94, 0xF5, 0x66, 0x75, 0xA4, 0x9C, 0x9A, 0x0B, 0xCB, 0xF1, 0xB9, 0x54, 0x63, 0x8D, 0x68, 0xA1,
+    0xD2, 0xA2, 0x08, 0xAB, 0x57, 0x59, 0x14, 0x50, 0x43, 0x6F, 0xEE, 0x86, 0x5E, 0x32, 0x77, 0x3F,
+    0x43, 0xCF, 0x42, 0x11, 0xB7, 0x52, 0x85, 0xD8, 0xC2, 0x0D, 0x93, 0x1B, 0x1E, 0xB3, 0x34, 0xA2,
+    0xC9, 0x53, 0x6D, 0x87, 0xCC, 0x4F, 0x31, 0xDC, 0x5D, 0xC6, 0xD1, 0x25, 0x78, 0x95, 0x5B, 0x76,
+    0x13, 0x47, 0xE1, 0xD5, 0xAE, 0x4E, 0xC3, 0xE8, 0xDC, 0x5D, 0x9E, 0xCF, 0xA2, 0x55, 0x58, 0x1A,
+    0x44, 0xE6, 0xF1, 0xF2, 0x3D, 0x37, 0xAC, 0x4E, 0xB0, 0xC6, 0x33, 0x2D, 0xC4, 0xDA, 0x34, 0xEC,
+    0x2C, 0xF2, 0x5F, 0xB8, 0xB7, 0xEC, 0x92, 0x33, 0xE0, 0x9C, 0x41, 0xD4, 0x1B, 0xBB, 0xE1, 0x15,
+    0xB7, 0x77, 0xC9, 0x0F, 0xFD, 0x58, 0xAD, 0x00, 0xB3, 0xBE, 0x2B, 0x9D, 0x81, 0x71, 0xCC, 0x60,
+    0xC1, 0xF7, 0x68, 0xD4, 0x35, 0xEE, 0x37, 0x8D, 0x21, 0x39, 0xBF, 0x72, 0xFD, 0x70, 0x57, 0xC7,
+    0x30, 0x66, 0x7F, 0xB9, 0x75, 0xB4, 0x44, 0x13, 0x7B, 0x88, 0xAA, 0x63, 0x6D, 0x61, 0xD5, 0x88,
+    0x5D, 0x81, 0x2C, 0xC2, 0x88, 0xBD, 0x7E, 0xAF, 0x7C, 0x2C, 0xC3, 0x92, 0x0E, 0x88, 0x7E, 0x57,
+    0xA7, 0xB5, 0x73, 0x9A, 0x75, 0x8B, 0xAE, 0xC7, 0x23, 0xC9, 0xE5, 0xA6, 0x57, 0xCB, 0xC1, 0xE3,
+    0x46, 0x4A, 0xC1, 0x94, 0xDE, 0x65, 0xA1, 0xE8, 0xA7, 0x94, 0x53, 0x06, 0x3B, 0xD9, 0x19, 0x0E,
+    0xAC, 0x74, 0x54, 0x14, 0xB6, 0xC8, 0x75, 0x25, 0x1F, 0x7D, 0x1C, 0xA9, 0xCD, 0x13, 0x51, 0x62,
+    0xDA, 0x2E, 0xFE, 0xA2, 0x49, 0x6B, 0x0B, 0xEB, 0x14, 0x72, 0x38, 0x08, 0xA3, 0x7C, 0x58, 0x28,
+    0xC1, 0x04, 0xBC, 0x3A, 0x29, 0x3C, 0x79, 0xC4, 0x42, 0x5B, 0x2C, 0x35, 0xE5, 0x8B, 0x18, 0x65,
+    0x30, 0xC5, 0x72, 0xE5, 0xD4, 0x85, 0x60, 0x71, 0x6B, 0xCD, 0x71, 0x01, 0xDD, 0x5B, 0x08, 0x22,
+    0x4B, 0x8E, 0x78, 0x9B, 0x65, 0x5B, 0x70, 0x5F, 0x38, 0x6F, 0x71, 0xF1, 0x84, 0x1D, 0x79, 0xFE,
+    0x35, 0xA3, 0xAA, 0xF5, 0xC4, 0xB8, 0x89, 0x21, 0x0E, 0xE4, 0xB1, 0x71, 0xFC, 0x84, 0xC1, 0x7F,
+    0x47, 0xC9, 0xF5, 0x95, 0x6A, 0xA1, 0xD1, 0x2E, 0xDC, 0xF8, 0xB3, 0xC1, 0xBE, 0x2C, 0x82, 0x10,
+    0xDE, 0xCC, 0xD3, 0x74, 0x39, 0xDE, 0xDF, 0xBF, 0xB9, 0xB9, 0xB1, 0x6F, 0xBA, 0x76, 0x14, 0x5F,
+    0xED, 0x77, 0xDA, 0xED, 0x36, 0x9E, 0x14, 0x36, 0xD8, 0xB5, 0xCF, 0x6F, 0x5E, 0x44, 0x5F, 0x26,
+    0x06, 0x1D, 0xCF, 0xEC, 0xC0, 0xFF, 0xC6, 0x31, 0x3B, 0x9A, 0xFA, 0xF1, 0x14, 0x7D, 0x79, 0x89,
+    0xE2, 0xF9, 0xB9, 0x68, 0x30, 0xD8, 0x14, 0x30, 0x3A, 0x03, 0xF8, 0xBD, 0x15, 0xBF, 0x31, 0xFC,
+    0xF4, 0x0D, 0x79, 0x60, 0x9A, 0xCA, 0x97, 0xFB, 0x40, 0x86, 0x0E, 0x51, 0xD7, 0x10, 0xC1, 0x5B,
+    0x0D, 0x58, 0x1C, 0xFE, 0xC7, 0x43, 0xA4, 0x9D, 0xA1, 0xDD, 0x09, 0x86, 0x70, 0x83, 0x1F, 0xB2,
+    0x38, 0x03, 0x3C, 0x06, 0x3F, 0xB0, 0x0F, 0xB2, 0x93, 0xCD, 0x20, 0x84, 0x7D, 0x90, 0xC2, 0xB1,
+    0x2E, 0x8C, 0xFC, 0x00, 0x8B, 0x3C, 0x42, 0x02, 0x1E, 0xCF, 0xF3, 0x70, 0x09, 0x62, 0x4E, 0xCC,
+    0x17, 0x87, 0x42, 0x4A, 0x47, 0xF3, 0x8E, 0x6A, 0xA6, 0xAD, 0xFA, 0xF1, 0x77, 0x43, 0x77, 0xEA,
+    0xF4, 0x3A, 0x87, 0xA8, 0x61, 0xD6, 0x25, 0xA8, 0xFE, 0xE7, 0x31, 0xA3, 0x1F, 0x8B, 0x1C, 0xA2,
+    0x71, 0x7C, 0x26, 0x66, 0xF6, 0x68, 0x7F, 0xDE, 0x11, 0x14, 0x96, 0x8F, 0x22, 0x40, 0x47, 0xC6,
+    0x13, 0xFF, 0x77, 0x3E, 0x76, 0xEC, 0x0E, 0xF2, 0x01, 0xC3, 0x07, 0xA3, 0xB2, 0x2E, 0xA3, 0x34,
+    0x8D, 0x16, 0x63, 0xD6, 0xB6, 0xFB, 0x82, 0xBB, 0xB3, 0xEC, 0xE0, 0x15, 0xF8, 0xDD, 0x69, 0xC1,
+    0x8D, 0x1C, 0xED, 0x2F, 0xFF, 0x48, 0xC7, 0xB2, 0x9F, 0x34, 0x5A, 0x42, 0x27, 0xD8, 0x05, 0x23,
+    0x56, 0x6E, 0x38, 0x6E, 0xF6, 0x01, 0x64, 0x14, 0xE0, 0xE8, 0x9E, 0xAD, 0x33, 0x6D, 0xDD, 0x54,
+    0x3B, 0x92, 0xDF, 0x94, 0x10, 0x97, 0x87, 0xAC, 0x48, 0x51, 0x8A, 0xF4, 0xD9, 0x7A, 0xFB, 0x19,
+    0xB3, 0xFB, 0xE8, 0x19, 0xC7, 0xBF, 0x44, 0x2B, 0xAC, 0xF9, 0x31, 0x3A, 0x6E, 0x0D, 0x2E, 0x19,
+    0x56, 0x1E, 0xB1, 0x55, 0x08, 0xEE, 0xF1, 0xC6, 0x16, 0xE8, 0x6A, 0xAA, 0x2F, 0xB4, 0xE3, 0x68,
+    0x3B, 0x76, 0xC0, 0xA9, 0x5D, 0x1D, 0xEC, 0xC4, 0x7B, 0x53, 0xFC, 0x94, 0x8A, 0xEE, 0x0D, 0xD4,
+    0xB9, 0x46, 0xD1, 0x84, 0xA3, 0x90, 0xD2, 0xFC, 0x26, 0x97, 0x07, 0x8B, 0x28, 0x3E, 0x53, 0x0F,
+    0xD2, 0x1E, 0xF5, 0x22, 0x8F, 0x3C, 0x63, 0x21, 0xD3, 0x69, 0xB9, 0x8C, 0x4D, 0x24, 0x8A, 0xED,
+    0x7B, 0xB4, 0x2A, 0x53, 0x9B, 0x3A, 0xA0, 0x4B, 0xDB, 0x6F, 0x46, 0x86, 0x48, 0x3B, 0xA1, 0x9E,
+    0x42, 0x7C, 0x5A, 0xA2, 0x44, 0x3E, 0x13, 0xA7, 0x47, 0xEC, 0x56, 0x96, 0x5A, 0x45, 0x89, 0x25,
+    0xE4, 0xDC, 0x4B, 0x54, 0xA5, 0x4A, 0x56, 0xA2, 0x0A, 0xB5, 0x16, 0x05, 0xBB, 0xD6, 0xE1, 0x44,
+    0x85, 0x47, 0xF9, 0xFB, 0x12, 0x1F, 0x65, 0x60, 0x35, 0x1E, 0xC8, 0x01, 0xC0, 0x91, 0xA6, 0x36,
+    0xC6, 0x2D, 0x58, 0x24, 0x90, 0x47, 0x88, 0xEA, 0x9A, 0xCD, 0xE3, 0x36, 0x96, 0xE8, 0x81, 0x7D,
+    0xE5, 0xBC, 0xC5, 0x10, 0x34, 0xC2, 0x66, 0x2D, 0xA3, 0x72, 0x83, 0x07, 0xE5, 0x94, 0x4C, 0x1E,
+    0xB5, 0xD9, 0x39, 0x86, 0x18, 0xA3, 0xF9, 0x5D, 0x8D, 0xBC, 0xCD, 0x06, 0x04, 0x97, 0x44, 0x30,
+    0x2F, 0xC5, 0xA9, 0xFD, 0xD0, 0xA6, 0xB6, 0x21, 0x2A, 0x04, 0x68, 0x9A, 0x5A, 0x99, 0x49, 0x50,
+    0x2C, 0x15, 0x99, 0xCA, 0x6A, 0x57, 0x37, 0xCD, 0xA2, 0x80, 0x96, 0x63, 0x9B, 0x85, 0x7B, 0xBD,
+    0x47, 0xAC, 0xD1, 0x64, 0x7A, 0x58, 0x5C, 0x68, 0xE4, 0xEE, 0x2B, 0x6D, 0xA9, 0xE2, 0xD9, 0x63,
+    0xA9, 0x86, 0x85, 0x8D, 0x20, 0x3A, 0xB7, 0x2C, 0xE7, 0x00, 0x77, 0x80, 0xD4, 0x00, 0x79, 0x80,
+    0xA3, 0xE3, 0x41, 0x69, 0x7B, 0xC4, 0xCC, 0x16, 0x32, 0xDC, 0xB2, 0x4F, 0x9A, 0x6A, 0x9B, 0xB3,
+    0xB8, 0x0F, 0x38, 0x03, 0x2D, 0x9F, 0x9F, 0x2D, 0xFD, 0xB0, 0xA9, 0x6D, 0xFE, 0xFA, 0xF0, 0xB3,
+    0x5D, 0x00, 0x12, 0xCD, 0x42, 0x28, 0x31, 0x72, 0xBC, 0x33, 0xF1, 0x52, 0xB3, 0xC9, 0xEA, 0x4F,
+    0x43, 0x2B, 0x59, 0xD2, 0xC2, 0x96, 0x6F, 0xB5, 0x3E, 0x41, 0x85, 0x4E, 0xC0, 0x21, 0xBC, 0x87,
+    0x04, 0x00, 0x23, 0x9A, 0x78, 0x42, 0xD5, 0xFD, 0x8C, 0xB5, 0x6C, 0xC3, 0x5D, 0x76, 0x26, 0x84,
+    0xD7, 0xFA, 0xD7, 0xCA, 0xE7, 0xA9, 0x9C, 0xBA, 0x35, 0xAC, 0x4C, 0x6E, 0xAC, 0x32, 0x31, 0x8D,
+    0x98, 0x58, 0x5D, 0x09, 0xD8, 0x5C, 0x57, 0x0B, 0x96, 0xC5, 0x71, 0xAB, 0x37, 0x45, 0x63, 0xC7,
+    0x2D, 0x31, 0x44, 0x31, 0xE9, 0x5A, 0x58, 0x94, 0x1B, 0x47, 0x69, 0x7C, 0x7C, 0x94, 0x7A, 0x78,
+    0xF6, 0x2B, 0x59, 0xBA, 0xE1, 0xC4, 0xE8, 0x66, 0x4B, 0x10, 0xFA, 0x41, 0x0B, 0x22, 0x9B, 0xAB,
+    0x70, 0xCC, 0xA6, 0x1C, 0x4B, 0x7C, 0x87, 0xE2, 0x88, 0xD8, 0x98, 0x5D, 0xC5, 0xFC, 0x16, 0xDD,
+    0x3E, 0x6E, 0x7A, 0x60, 0xB4, 0x86, 0xA7, 0xCF, 0xA4, 0xFE, 0x24, 0xB6, 0x0D, 0xDE, 0x2F, 0xF5,
+    0x60, 0xBD, 0x03, 0xD2, 0x8D, 0x2C, 0x9B, 0x5F, 0xC5, 0xB0, 0x56, 0xEE, 0x8B, 0xE3, 0x05, 0x27,
+    0xC6, 0xF7, 0x4A, 0x0C, 0x27, 0x4A, 0xF8, 0x13, 0x67, 0xCF, 0xC0, 0xC3, 0xA0, 0xDF, 0x1B, 0xE9,
+    0xC4, 0xF8, 0xFE, 0x07, 0x80, 0xB2, 0xC1, 0x91, 0x02, 0xEF, 0x22, 0x19, 0x05, 0xF4, 0x07, 0xA5,
+    0xA1, 0x8F, 0xAE, 0xF7, 0x5C, 0xA8, 0x08, 0x1E, 0xE5, 0xFD, 0x80, 0x6C, 0xB5, 0xFA, 0xEA, 0xA3,
+    0xCC, 0x95, 0xEA, 0x8B, 0x41, 0x1A, 0x79, 0x41, 0x96, 0x35, 0xAB, 0x64, 0xCD, 0x87, 0xD6, 0x81,
+    0xF0, 0xF9, 0x43, 0x49, 0x02, 0x62, 0x6E, 0x33, 0x37, 0xAF, 0x1D, 0x29, 0x29, 0xC2, 0x67, 0x27,
+    0x4A, 0x9E, 0x3E, 0xD5, 0x5E, 0x27, 0x72, 0x1E, 0xAB, 0x67, 0x4C, 0x74, 0x30, 0xAC, 0x51, 0x62,
+    0x6B, 0xDD, 0x49, 0x93, 0x2A, 0x24, 0x05, 0xE0, 0xA4, 0x7B, 0xF5, 0x9D, 0xAD, 0x75, 0x73, 0x29,
+    0x15, 0x21, 0x32, 0x7B, 0x11, 0x76, 0x42, 0x5A, 0xDD, 0x72, 0x44, 0xCA, 0xBC, 0xB9, 0xB7, 0xC8,
+    0xA5, 0x95, 0xAA, 0x42, 0x6D, 0x0A, 0x50, 0x9D, 0xF6, 0x21, 0x49, 0xC4, 0xE5, 0x5E, 0x4B, 0xF2,
+    0x81, 0x51, 0x61, 0x60, 0x52, 0x90, 0xDB, 0x4B, 0x60, 0x44, 0xA3, 0x40, 0x39, 0xC9, 0x22, 0x75,
+    0xA9, 0xCC, 0x59, 0x44, 0xFE, 0xAD, 0x0D, 0x0F, 0x52, 0x00, 0xB0, 0x3B, 0xC1, 0x05, 0x4A, 0x48,
+    0x67, 0xE2, 0x83, 0xE8, 0x1D, 0x13, 0x8F, 0x62, 0x2D, 0x4E, 0xB7, 0x47, 0xDA, 0x69, 0x77, 0x21,
+    0x50, 0x13, 0xB5, 0x9E, 0x82, 0x5F, 0x29, 0x7A, 0x91, 0x1D, 0x89, 0xC3, 0xA6, 0xE4, 0x72, 0x35,
+    0x75, 0x53, 0xCC, 0xB4, 0xF2, 0x69, 0xAE, 0x68, 0xA8, 0x4C, 0x2C, 0xE4, 0x22, 0x22, 0x24, 0xF3,
+    0x98, 0x8D, 0x0F, 0x7D, 0x07, 0x65, 0x22, 0x1B, 0x4E, 0xE4, 0xAF, 0xAC, 0x52, 0x93, 0xF7, 0xAD,
+    0x48, 0x9D, 0x76, 0x8B, 0x15, 0x8F, 0x7B, 0x7B, 0xFA, 0x21, 0x2D, 0xF5, 0xDE, 0xDC, 0xDB, 0xCB,
+    0x64, 0x2A, 0x77, 0x81, 0xDB, 0x18, 0x58, 0xC8, 0x57, 0xF9, 0x96, 0x18, 0x72, 0xD6, 0xC2, 0x98,
+    0x61, 0x01, 0x46, 0xD1, 0x8A, 0xE1, 0x71, 0x23, 0x45, 0x2A, 0x77, 0xBF, 0x68, 0x23, 0x06, 0xCF,
+    0xDC, 0x50, 0x55, 0xBB, 0xB1, 0xB7, 0x27, 0xDF, 0x2B, 0x1C, 0x6C, 0x0B, 0x57, 0x8B, 0x4B, 0x1E,
+    0xE7, 0x6D, 0x48, 0xA6, 0xF0, 0xDE, 0x5C, 0x43, 0x26, 0xF0, 0x11, 0xC7, 0xF1, 0x01, 0xDC, 0x61,
+    0xB5, 0xC7, 0xFA, 0xC3, 0xC2, 0x1F, 0xF8, 0x94, 0xFB, 0xD7, 0xE0, 0x6A, 0x7C, 0x99, 0x9C, 0x2A,
+    0x1B, 0xC0, 0x48, 0x07, 0xB2, 0x75, 0xBE, 0x00, 0xBD, 0xAF, 0xE5, 0x9F, 0xE6, 0xB7, 0x66, 0x4E,
+    0xB6, 0x9E, 0xD2, 0xAA, 0xC6, 0x25, 0x28, 0x80, 0x38, 0xDF, 0x75, 0x82, 0xC1, 0xA8, 0xB9, 0x32,
+    0xF5, 0x88, 0x45, 0x84, 0x72, 0x85, 0xEC, 0x3D, 0x57, 0x9A, 0xFF, 0x85, 0x85, 0x8A, 0xC4, 0xF8,
+    0x6D, 0xFB, 0x7D, 0x17, 0x69, 0xC7, 0x28, 0x12, 0x46, 0xC5, 0x26, 0x9B, 0x7D, 0x84, 0xD4, 0x5D,
+    0x5A, 0x1B, 0x1E, 0xA9, 0xD1, 0xD8, 0x28, 0xD8, 0xD6, 0x3D, 0x33, 0xBF, 0xCD, 0xB2, 0xF0, 0x10,
+    0x0E, 0x48, 0x57, 0x01, 0x1F, 0xB7, 0x4F, 0x9C, 0x71, 0x5B, 0x59, 0x8D, 0x3B, 0xE3, 0x67, 0xC0,
+    0xB1, 0x1B, 0xBC, 0xE1, 0xD7, 0x3C, 0x98, 0xBC, 0x85, 0x0C, 0xD7, 0x5E, 0xB8, 0x5F, 0x9A, 0xED,
+    0x96, 0xB8, 0x05, 0xDB, 0xEF, 0x11, 0xF9, 0xBB, 0xBB, 0xB6, 0x99, 0xA5, 0x09, 0xF0, 0xF3, 0xEF,
+    0xFC, 0x76, 0x82, 0x7B, 0xEE, 0x3A, 0x81, 0xCD, 0xB3, 0xB5, 0xE8, 0x6E, 0x73, 0x51, 0x80, 0x7D,
+    0x0F, 0xA4, 0xF0, 0x03, 0x8B, 0xE4, 0x93, 0xC4, 0x14, 0xDB, 0xCE, 0xF8, 0xF0, 0x63, 0xBA, 0x08,
+    0x40, 0xAA, 0x4F, 0x2D, 0x8B, 0xBD, 0x86, 0x47, 0xF6, 0x6E, 0xFF, 0x39, 0xB3, 0xAC, 0xE3, 0x86,
+    0x8A, 0xBA, 0x10, 0x15, 0x46, 0xA6, 0x20, 0x2F, 0xA8, 0x32, 0xF0, 0x80, 0x3A, 0x80, 0x9C, 0x93,
+    0x6B, 0x1E, 0xA7, 0xFE, 0xD4, 0x0D, 0xD4, 0xBC, 0x2C, 0x20, 0x6C, 0x0D, 0xF8, 0xA1, 0x01, 0xC9,
+    0x99, 0x07, 0x3C, 0x19, 0x90, 0xC8, 0xF2, 0x85, 0xC1, 0xE6, 0x94, 0x49, 0x66, 0x8F, 0x4B, 0x0C,
+    0x97, 0xE2, 0x6B, 0xFE, 0x1C, 0x0F, 0xB9, 0xA4, 0x1F, 0x70, 0x6F, 0x6A, 0x62, 0x7C, 0x79, 0xEB,
+    0x7B, 0xBF, 0xC0, 0x5F, 0xB6, 0xE0, 0x3C, 0x2D, 0x15, 0x1A, 0x3A, 0x3D, 0xF8, 0xDF, 0xB8, 0xEF,
+    0x2B, 0xEB, 0x67, 0x6B, 0x35, 0x22, 0x90, 0x4E, 0x8D, 0x99, 0x5E, 0xE0, 0x46, 0xE9, 0xCF, 0x7F,
+    0x17, 0x5A, 0x41, 0xBA, 0x99, 0x90, 0x64, 0xD9, 0x67, 0x7E, 0x2B, 0x91, 0x41, 0x76, 0x1B, 0xD6,
+    0xFC, 0x00, 0x2B, 0x21, 0x0B, 0x50, 0xDE, 0xAC, 0x3A, 0x03, 0x2D, 0x39, 0xE1, 0x18, 0xAD, 0xC8,
+    0xB9, 0xA0, 0x68, 0xE2, 0x49, 0x61, 0xC6, 0x61, 0x21, 0x9D, 0x94, 0xCE, 0x2F, 0xC9, 0x08, 0xB8,
+    0xD9, 0x40, 0xB5, 0x06, 0xAF, 0xAA, 0xE0, 0xF4, 0x43, 0x77, 0xA0, 0x75, 0xEA, 0xE8, 0x7A, 0xE8,
+    0x83, 0x43, 0x78, 0xED, 0x4D, 0x2E, 0xF0, 0xA5, 0x25, 0x92, 0x6F, 0x3B, 0xE6, 0x74, 0x6E, 0xB7,
+    0xB9, 0xFF, 0xE9, 0xBF, 0x5C, 0xEB, 0xF7, 0xE7, 0xD6, 0xAF, 0x6D, 0x6B, 0xF4, 0xDB, 0xFE, 0x55,
+    0x8B, 0x35, 0xCE, 0x1B, 0xE6, 0x06, 0xA0, 0x48, 0xAB, 0x62, 0x17, 0x32, 0xE3, 0x05, 0xC6, 0x61,
+    0xD1, 0x99, 0xFC, 0xAC, 0x63, 0x60, 0x16, 0x3E, 0xDC, 0xE8, 0xB4, 0xD8, 0xD0, 0x04, 0x19, 0x95,
+    0xAC, 0xEF, 0x7B, 0x2A, 0x1A, 0x81, 0x59, 0x50, 0x8D, 0x88, 0x91, 0x19, 0x8A, 0x82, 0x89, 0x48,
+    0x89, 0xD0, 0x03, 0xC9, 0x36, 0x68, 0x25, 0xE7, 0xC4, 0xD0, 0x8B, 0xCA, 0x76, 0x83, 0x15, 0x3C,
+    0x95, 0x3C, 0x58, 0x64, 0x08, 0xBE, 0x37, 0x06, 0x79, 0x42, 0x0B, 0x6D, 0x04, 0xDF, 0x29, 0x5B,
+    0x81, 0xF7, 0x51, 0x38, 0x0D, 0xFC, 0xE9, 0x67, 0x48, 0xF8, 0x65, 0x4E, 0x8D, 0xB9, 0x3D, 0x4C,
+    0x26, 0x78, 0x72, 0x00, 0x54, 0x52, 0x00, 0x40, 0x55, 0xBB, 0x11, 0x15, 0x25, 0xC5, 0x23, 0x9A,
+    0xB2, 0x64, 0xE9, 0x08, 0xAD, 0x9A, 0xCE, 0xE4, 0xE3, 0xDC, 0xEA, 0xD8, 0xC7, 0x72, 0x1E, 0x51,
+    0xE0, 0xD9, 0x78, 0x37, 0x47, 0xFB, 0x04, 0x7E, 0x5C, 0xA0, 0x52, 0x18, 0xB4, 0x50, 0x0E, 0x44,
+    0x55, 0xE6, 0xB1, 0x91, 0x80, 0xE4, 0x3B, 0xB0, 0xCE, 0x50, 0x70, 0x1E, 0x22, 0x5D, 0xC1, 0x84,
+    0xF5, 0x0C, 0x02, 0x99, 0x26, 0x49, 0xE7, 0xB5, 0xD7, 0x42, 0xD4, 0xD7, 0x5E, 0x96, 0x17, 0xED,
+    0xFC, 0x0E, 0x40, 0xE2, 0x98, 0x65, 0xCB, 0xDE, 0x0A, 0x2F, 0x68, 0x53, 0xAE, 0x42, 0xB8, 0x77,
+    0x77, 0x4F, 0x73, 0x9B, 0xDE, 0xF6, 0x39, 0x0B, 0x95, 0xD6, 0xC5, 0xE4, 0x81, 0x05, 0x20, 0x3C,
+    0x93, 0x39, 0x21, 0x99, 0x84, 0x3E, 0x8E, 0xB1, 0x3C, 0x5F, 0x9F, 0x8F, 0xE4, 0xB0, 0x74, 0xB6,
+    0xD1, 0xCF, 0xB3, 0x7F, 0x82, 0xB4, 0x53, 0x71, 0x88, 0x30, 0xDF, 0x44, 0x38, 0x2C, 0xBC, 0xCF,
+    0xA1, 0x4F, 0xC8, 0x9F, 0x1B, 0xE3, 0x22, 0x9C, 0xE4, 0xBD, 0x74, 0xD6, 0xDF, 0x03, 0x1E, 0x72,
+    0x34, 0xF5, 0x2F, 0x14, 0x8C, 0xB3, 0x8F, 0xEF, 0x2B, 0x47, 0x93, 0xF3, 0x3A, 0x88, 0x96, 0x94,
+    0xF2, 0x5D, 0xE7, 0x6D, 0x65, 0x56, 0x2E, 0x03, 0x2B, 0x91, 0x95, 0x22, 0x82, 0x89, 0x97, 0xFA,
+    0x43, 0x98, 0xD9, 0xC1, 0xCB, 0x52, 0xF7, 0x7A, 0x1D, 0xE3, 0xD1, 0x2C, 0xBC, 0xD7, 0x3E, 0x38,
+    0xFE, 0x83, 0x3C, 0xE4, 0x49, 0xC5, 0x23, 0xFA, 0x47, 0x24, 0x9A, 0xAB, 0x17, 0x74, 0xAE, 0xF4,
+    0x6B, 0xFA, 0x2F, 0x26, 0x2B, 0x1A, 0x07, 0x58, 0xAD, 0x7F, 0xB1, 0xF3, 0x68, 0xB7, 0xD8, 0x49,
+    0x10, 0xB8, 0x8A, 0x91, 0xFC, 0xEB, 0xF1, 0x7B, 0x70, 0x0B, 0x9F, 0x39, 0xA0, 0x0C, 0x0B, 0x03,
+    0xC9, 0x3A, 0x36, 0xB3, 0xBB, 0x7B, 0x86, 0x24, 0xBF, 0x98, 0x16, 0x48, 0xD9, 0xDD, 0xC3, 0xE5,
+    0x50, 0x3E, 0x75, 0xF2, 0x55, 0x12, 0x90, 0x79, 0x6A, 0x86, 0x7C, 0xB2, 0x65, 0x14, 0x4F, 0x27,
+    0xB2, 0x44, 0x3E, 0x96, 0xD5, 0xA2, 0x22, 0x3F, 0xEA, 0x2C, 0xCF, 0xD7, 0x57, 0xAB, 0x24, 0x3B,
+    0x05, 0x0A, 0x27, 0x35, 0x15, 0xAB, 0x3A, 0x1E, 0xC4, 0xC9, 0xA2, 0x6F, 0x74, 0x2C, 0x6B, 0x77,
+    0x1D, 0x4F, 0xF0, 0xA8, 0xF5, 0x71, 0x92, 0xD5, 0x22, 0xF5, 0xF3, 0x5A, 0xC5, 0x8A, 0xE4, 0xDD,
+    0x9D, 0xD1, 0x36, 0xCC, 0xE3, 0x76, 0x1D, 0xF7, 0xDA, 0x31, 0xA5, 0x75, 0xFE, 0x51, 0xDB, 0x3D,
+    0x13, 0x5A, 0xB1, 0x2C, 0xC9, 0x5B, 0x86, 0x7A, 0x92, 0xDD, 0x3D, 0x62, 0x3A, 0x95, 0x96, 0x97,
+    0x19, 0x7A, 0x80, 0x9D, 0x54, 0x5C, 0x8D, 0x64, 0x28, 0x43, 0x3D, 0xD9, 0xA2, 0xF0, 0x3B, 0x19,
+    0x3A, 0x83, 0xC9, 0x29, 0x33, 0x83, 0x13, 0xF6, 0x20, 0x66, 0x72, 0xD7, 0xAB, 0x26, 0x4E, 0x61,
+    0x9E, 0x64, 0x77, 0x0F, 0xE6, 0xA5, 0xA6, 0x70, 0xA9, 0x3E, 0x74, 0x7E, 0xDC, 0x47, 0x71, 0x78,
+    0x67, 0x06, 0xF9, 0x27, 0x4B, 0xCB, 0xC8, 0xC7, 0xCC, 0x83, 0x3E, 0x4E, 0x4A, 0x94, 0xF5, 0x0B,
+    0x26, 0x0C, 0xA3, 0x0E, 0x41, 0xFD, 0x5B, 0x5B, 0x12, 0xB4, 0x6D, 0xF7, 0x01, 0xD2, 0xD1, 0x1C,
+    0x85, 0xEC, 0xF4, 0x03, 0xD6, 0x10, 0x9B, 0x7F, 0xC6, 0x46, 0xA0, 0xFA, 0x8F, 0xF6, 0xC0, 0x30,
+    0xB0, 0x92, 0x3D, 0x5A, 0x54, 0xB6, 0xB4, 0x12, 0xB1, 0x29, 0x93, 0xC7, 0x76, 0x04, 0x3B, 0xEF,
+    0x96, 0x36, 0xC7, 0x0A, 0xBB, 0x39, 0x72, 0x7F, 0x47, 0xEE, 0x16, 0x19, 0xC7, 0xAF, 0x04, 0x3D,
+    0x46, 0x43, 0x38, 0xDA, 0x9F, 0x77, 0x75, 0x52, 0xCB, 0xE3, 0xE7, 0x31, 0x67, 0xB7, 0xD1, 0x8A,
+    0x25, 0x2B, 0x79, 0x73, 0xE3, 0x42, 0xBC, 0x91, 0x46, 0xE2, 0x53, 0x92, 0xE2, 0xA9, 0x10, 0x78,
+    0x27, 0xB9, 0x53, 0x9F, 0xCB, 0x26, 0x27, 0x6A, 0x77, 0x28, 0x27, 0xA8, 0x6F, 0x6F, 0x41, 0xFE,
+    0xE7, 0xDE, 0x6E, 0xD9, 0x74, 0xDA, 0xF2, 0x8F, 0x0D, 0x6C, 0x2A, 0x34, 0x51, 0x36, 0x92, 0xAA,
+    0xD4, 0xAF, 0x31, 0x9B, 0x05, 0xFC, 0xCB, 0x21, 0xFB, 0xE7, 0x2A, 0x49, 0xFD, 0xD9, 0x2D, 0x7D,
+    0xF7, 0x0E, 0x33, 0x90, 0x67, 0x9F, 0x57, 0x6E, 0x49, 0x20, 0xB2, 0x6F, 0xB5, 0x4F, 0x57, 0xA4,
+    0x8F, 0x5D, 0x88, 0x4F, 0x17, 0x4A, 0x6F, 0x19, 0xCD, 0x08, 0x64, 0xCC, 0x53, 0x1E, 0x90, 0xFC,
+    0x8C, 0x0A, 0x80, 0x0C, 0x48, 0x2F, 0xD3, 0xD0, 0x92, 0x95, 0xB4, 0x2A, 0x8C, 0x64, 0xFD, 0xD2,
+    0x9D, 0x7E, 0xBE, 0x8A, 0x31, 0xC1, 0xB1, 0x8A, 0xB2, 0xA9, 0xC2, 0x67, 0x71, 0xB7, 0xE8, 0xF9,
+    0x95, 0xA6, 0x83, 0x35, 0xF0, 0xC7, 0x95, 0x37, 0xA7, 0x84, 0xC8, 0x8E, 0x30, 0xA1, 0x29, 0x8C,
+    0x21, 0x2B, 0xD6, 0x57, 0xA4, 0x89, 0x66, 0x02, 0x52, 0x39, 0xDA, 0x47, 0x8C, 0x8A, 0x70, 0xF6,
+    0x85, 0x74, 0x1E, 0x23, 0x34, 0x9A, 0xDB, 0x5F, 0x78, 0xF2, 0x8D, 0x25, 0xF6, 0xDD, 0x74, 0xDA,
+    0x6E, 0x77, 0xBB, 0x90, 0xC5, 0xEE, 0xFF, 0x0D, 0x54, 0xDA, 0x63, 0xF9, 0x37, 0xDF, 0x42, 0x5D,
+    0xFF, 0xB6, 0xBF, 0x5D, 0x9C, 0xF4, 0xAF, 0x03, 0xFC, 0x01, 0x69, 0x12, 0x6C, 0x51, 0x98, 0xA5,
+    0x2F, 0x93, 0xBE, 0x81, 0x34, 0xD5, 0xFE, 0xA8, 0x66, 0x48, 0x99, 0x1C, 0xAD, 0x19, 0xE7, 0x1E,
+    0x0A, 0x23, 0x4B, 0xB5, 0xC4, 0x27, 0x68, 0xF2, 0xCC, 0x38, 0xF6, 0x54, 0xB4, 0x18, 0x9D, 0xD8,
+    0x9F, 0xBF, 0xE5, 0xAA, 0x4A, 0xA3, 0x05, 0xC9, 0xBE, 0xA0, 0x21, 0x96, 0xFC, 0xFB, 0x2D, 0x4F,
+    0xC4, 0xFB, 0x5D, 0xFB, 0x4F, 0x52, 0x6D, 0x54, 0x60, 0x19, 0x46, 0xF7, 0xA1, 0x14, 0xCD, 0x93,
+    0x98, 0xCF, 0xBA, 0x31, 0xB3, 0xBB, 0xF2, 0xD7, 0x45, 0x58, 0xFA, 0x94, 0x84, 0x4D, 0x75, 0x53,
+    0x86, 0xB9, 0x67, 0x83, 0xAD, 0x46, 0x99, 0xD6, 0x3B, 0x04, 0x91, 0x9D, 0xFE, 0x54, 0x5F, 0x80,
+    0x3F, 0x5A, 0x12, 0xC5, 0xA5, 0xE8, 0x4C, 0x2C, 0x0B, 0xF7, 0x2E, 0x96, 0xA5, 0x55, 0x24, 0x23,
+    0x25, 0xD5, 0xE9, 0x9E, 0xDE, 0x73, 0xB5, 0x33, 0xF3, 0x4F, 0x87, 0x05, 0xDF, 0x90, 0xCE, 0xD6,
+    0xF0, 0x83, 0x6F, 0x25, 0x8A, 0xB6, 0xD5, 0x2E, 0x05, 0x5C, 0x58, 0xF8, 0x08, 0x0B, 0x2D, 0xE8,
+    0x11, 0x56, 0x55, 0xFC, 0xB2, 0x2E, 0xB7, 0xAE, 0x8B, 0x43, 0xD5, 0xA5, 0x56, 0xAE, 0x81, 0x15,
+    0x5F, 0x9D, 0xDD, 0x94, 0x8C, 0x12, 0x27, 0xE5, 0xB3, 0xD9, 0x9B, 0x3F, 0x67, 0x2B, 0xCD, 0x50,
+    0xAB, 0xAE, 0x70, 0x4A, 0x7F, 0xF4, 0xF8, 0xF4, 0x87, 0x3A, 0xEC, 0x47, 0x9C, 0x9C, 0x16, 0x7C,
+    0xE6, 0x3B, 0x66, 0x74, 0xA2, 0xB5, 0x3A, 0x6D, 0xF5, 0x11, 0x09, 0xDB, 0x71, 0x48, 0x29, 0x07,
+    0xF9, 0xA6, 0xA7, 0x95, 0xCA, 0x9E, 0xF7, 0x5B, 0x1C, 0x5E, 0x62, 0xFB, 0x55, 0xB2, 0xDF, 0xEE,
+    0x30, 0x53, 0x85, 0xBA, 0x3A, 0xDB, 0xB4, 0xD3, 0xB5, 0x3F, 0xFA, 0xBC, 0x53, 0x31, 0xF6, 0x7B,
+    0xEC, 0xC9, 0x27, 0xA1, 0x44, 0xE5, 0xF3, 0x4F, 0xF7, 0x45, 0x6C, 0x5F, 0x7B, 0x0E, 0x4A, 0x37,
+    0x80, 0xFC, 0x4C, 0x91, 0x5D, 0x0E, 0xEE, 0x76, 0x1C, 0x2C, 0xFA, 0x41, 0x1E, 0x46, 0x86, 0xF9,
+    0x40, 0x3A, 0xE8, 0x70, 0x71, 0x67, 0x4F, 0x3A, 0x0A, 0x0C, 0x47, 0x9F, 0xBF, 0xC7, 0x6B, 0x76,
+    0x68, 0x5F, 0x1E, 0x02, 0xAC, 0xC4, 0x8F, 0xA5, 0x19, 0xB8, 0x38, 0xBC, 0x7F, 0xDB, 0x54, 0xE7,
+    0x9F, 0x5E, 0xE6, 0xFB, 0xA3, 0xB5, 0x1E, 0x47, 0xFF, 0x28, 0x80, 0xF0, 0x6C, 0x76, 0x5A, 0xFD,
+    0x10, 0xE0, 0x70, 0xC7, 0x2A, 0x21, 0x37, 0x16, 0xE9, 0xF4, 0x66, 0xF6, 0xDA, 0xAC, 0xF7, 0xA1,
+    0x8D, 0xAF, 0x0C, 0x4B, 0x1A, 0xE5, 0xEF, 0xB5, 0x6B, 0x82, 0xCD, 0x87, 0xAE, 0x68, 0x32, 0xAE,
+    0xBC, 0x6F, 0x91, 0xCE, 0xE2, 0x4F, 0xF1, 0xC9, 0x96, 0x78, 0x30, 0xE5, 0x6F, 0xF9, 0x1F, 0x9E,
+    0xD0, 0x3E, 0xA4, 0xAE, 0x1C, 0xCC, 0x97, 0xFF, 0x18, 0x05, 0x34, 0x52, 0xE2, 0x60, 0xCF, 0x63,
+    0x3E, 0x9B, 0x18, 0xFB, 0x90, 0xBC, 0xB5, 0xBA, 0xB4, 0x33, 0xFE, 0xDF, 0x81, 0x6A, 0x42, 0x94,
+    0x75, 0x60, 0x00, 0x00,
+};
+
+static constexpr PortalAsset portal_assets[] PROGMEM = {
+    {"/app.css", "text/css", "21afebc8", portal_asset0,
+     sizeof(portal_asset0) - 1, portal_asset0_gzip, sizeof(portal_asset0_gzip)},
+    {"/app.js", "application/javascript", "94426a81", portal_asset1,
+     sizeof(portal_asset1) - 1, portal_asset1_gzip, sizeof(portal_asset1_gzip)},
+};
+static constexpr size_t portal_asset_count = 2;
+
+// CRC-32 of all static chunks; changes whenever the page source does.
+static constexpr uint32_t page_static_hash = 0x252AC9B3;
 
 #endif // PROVISION_HTML_H
-
@@ -0,0 +1,310 @@
+#include "provision_request.h"
+#include <string.h>
+
+namespace wifiprov {
+
+namespace {
+
+// Deeper values are not something the page sends
+constexpr uint8_t kMaxDepth = 16;
+
+bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+bool isLiteralChar(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '.' || c == '+' ||
+         c == '-' || c == 'E';
+}
+
+} // namespace
+
+void ProvisionRequest::clear() { memset(this, 0, sizeof(*this)); }
+
+ProvisionRequestParser::ProvisionRequestParser(ProvisionRequest &out, size_t codeLimit)
+    : _out(out),
+      _codeLimit(codeLimit > 0 && codeLimit < ProvisionRequest::kCodeMax ? codeLimit
+                                                                          : ProvisionRequest::kCodeMax),
+      _state(State::Start), _error(nullptr), _keyLength(0), _inKey(false), _target(nullptr),
+      _capacity(0), _length(0), _tooLong(nullptr), _presentBit(0), _unicode(0),
+      _unicodeDigits(0), _highSurrogate(0), _depth(0) {
+  _out.clear();
+}
+
+bool ProvisionRequestParser::feed(const char *data, size_t len) {
+  for (size_t i = 0; i < len; ++i) {
+    if (!step(data[i])) {
+      return false;
+    }
+  }
+  return _state != State::Failed;
+}
+
+bool ProvisionRequestParser::finish() {
+  if (_state == State::Done) {
+    return true;
+  }
+  if (_state != State::Failed) {
+    fail("incomplete JSON");
+  }
+  return false;
+}
+
+bool ProvisionRequestParser::fail(const char *why) {
+  _state = State::Failed;
+  _error = why;
+  return false;
+}
+
+void ProvisionRequestParser::selectField() {
+  struct Field {
+    const char *name;
+    char *target;
+    size_t capacity;
+    uint8_t bit;
+    const char *tooLong;
+  };
+  const Field fields[] = {
+      {"ssid", _out.ssid, ProvisionRequest::kSsidMax, 0, "ssid too long"},
+      {"password", _out.password, ProvisionRequest::kPasswordMax, ProvisionRequest::kPassword,
+       "password too long"},
+      {"code", _out.code, _codeLimit, ProvisionRequest::kCode, "code too long"},
+      {"username", _out.username, ProvisionRequest::kUsernameMax, ProvisionRequest::kUsername,
+       "username too long"},
+      {"service_password", _out.servicePassword, ProvisionRequest::kServicePasswordMax,
+       ProvisionRequest::kServicePassword, "service_password too long"},
+  };
+  _target = nullptr;
+  for (const Field &field : fields) {
+    if (strcmp(_key, field.name) == 0) {
+      _target = field.target;
+      _capacity = field.capacity;
+      _presentBit = field.bit;
+      _tooLong = field.tooLong;
+      return;
+    }
+  }
+}
+
+bool ProvisionRequestParser::put(uint8_t byte) {
+  if (_inKey) {
+    // An overlong name matches no field
+    if (_keyLength < sizeof(_key) - 1) {
+      _key[_keyLength++] = (char)byte;
+    } else {
+      _key[0] = '\0';
+      _keyLength = sizeof(_key) - 1;
+    }
+    return true;
+  }
+  if (!_target) {
+    return true; // Skipped member
+  }
+  if (_length >= _capacity) {
+    return fail(_tooLong); // Rejected at the first byte that does not fit
+  }
+  _target[_length++] = (char)byte;
+  return true;
+}
+
+bool ProvisionRequestParser::putCodepoint(uint32_t cp) {
+  if (cp == 0) {
+    return fail("NUL in string");
+  }
+  if (cp < 0x80) {
+    return put(cp);
+  }
+  if (cp < 0x800) {
+    return put(0xC0 | (cp >> 6)) && put(0x80 | (cp & 0x3F));
+  }
+  if (cp < 0x10000) {
+    return put(0xE0 | (cp >> 12)) && put(0x80 | ((cp >> 6) & 0x3F)) && put(0x80 | (cp & 0x3F));
+  }
+  return put(0xF0 | (cp >> 18)) && put(0x80 | ((cp >> 12) & 0x3F)) &&
+         put(0x80 | ((cp >> 6) & 0x3F)) && put(0x80 | (cp & 0x3F));
+}
+
+bool ProvisionRequestParser::step(char c) {
+  switch (_state) {
+  case State::Start:
+    if (c == '{') {
+      _state = State::KeyOrEnd;
+      return true;
+    }
+    return isSpace(c) || fail("expected an object");
+
+  case State::KeyOrEnd:
+    if (c == '}') {
+      _state = State::Done;
+      return true;
+    }
+    // fall through
+  case State::Key:
+    if (c == '"') {
+      _inKey = true;
+      _keyLength = 0;
+      _state = State::String;
+      return true;
+    }
+    return isSpace(c) || fail("expected a member name");
+
+  case State::Colon:
+    if (c == ':') {
+      selectField();
+      _state = State::Value;
+      return true;
+    }
+    return isSpace(c) || fail("expected ':'");
+
+  case State::Value:
+    if (c == '"') {
+      _length = 0;
+      _state = State::String;
+    } else if (c == '{' || c == '[') {
+      _depth = 1;
+      _state = State::Nested;
+    } else if (c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n') {
+      _state = State::Literal; // Not a string: the field stays absent
+    } else {
+      return isSpace(c) || fail("expected a value");
+    }
+    return true;
+
+  case State::String:
+    if (_highSurrogate && c != '\\') {
+      return fail("unpaired surrogate");
+    }
+    if (c == '\\') {
+      _state = State::Escape;
+      return true;
+    }
+    if (c == '"') {
+      if (_inKey) {
+        _key[_keyLength] = '\0';
+        _inKey = false;
+        _state = State::Colon;
+        return true;
+      }
+      if (_target) {
+        _target[_length] = '\0';
+        _out.present |= _presentBit;
+      }
+      _state = State::AfterValue;
+      return true;
+    }
+    if ((uint8_t)c < 0x20) {
+      return fail("control character in string");
+    }
+    return put((uint8_t)c);
+
+  case State::Escape: {
+    if (_highSurrogate && c != 'u') {
+      return fail("unpaired surrogate");
+    }
+    _state = State::String;
+    switch (c) {
+    case '"': case '\\': case '/': return put((uint8_t)c);
+    case 'b': return put('\b');
+    case 'f': return put('\f');
+    case 'n': return put('\n');
+    case 'r': return put('\r');
+    case 't': return put('\t');
+    case 'u':
+      _unicode = 0;
+      _unicodeDigits = 0;
+      _state = State::Unicode;
+      return true;
+    default: return fail("bad escape");
+    }
+  }
+
+  case State::Unicode: {
+    int digit = hexValue(c);
+    if (digit < 0) {
+      return fail("bad \\u escape");
+    }
+    _unicode = _unicode << 4 | digit;
+    if (++_unicodeDigits < 4) {
+      return true;
+    }
+    _state = State::String;
+    if (_unicode >= 0xD800 && _unicode <= 0xDBFF) {
+      if (_highSurrogate) {
+        return fail("unpaired surrogate");
+      }
+      _highSurrogate = _unicode;
+      return true;
+    }
+    if (_unicode >= 0xDC00 && _unicode <= 0xDFFF) {
+      if (!_highSurrogate) {
+        return fail("unpaired surrogate");
+      }
+      uint32_t cp = 0x10000 + ((uint32_t)(_highSurrogate - 0xD800) << 10) + (_unicode - 0xDC00);
+      _highSurrogate = 0;
+      return putCodepoint(cp);
+    }
+    if (_highSurrogate) {
+      return fail("unpaired surrogate");
+    }
+    return putCodepoint(_unicode);
+  }
+
+  case State::Literal:
+    if (isLiteralChar(c)) {
+      return true;
+    }
+    _state = State::AfterValue;
+    return step(c);
+
+  case State::Nested:
+    if (c == '"') {
+      _state = State::NestedString;
+    } else if (c == '{' || c == '[') {
+      if (++_depth > kMaxDepth) {
+        return fail("nested too deeply");
+      }
+    } else if (c == '}' || c == ']') {
+      if (--_depth == 0) {
+        _state = State::AfterValue;
+      }
+    }
+    return true;
+
+  case State::NestedString:
+    if (c == '\\') {
+      _state = State::NestedEscape;
+    } else if (c == '"') {
+      _state = State::Nested;
+    }
+    return true;
+
+  case State::NestedEscape:
+    _state = State::NestedString;
+    return true;
+
+  case State::AfterValue:
+    if (c == ',') {
+      _state = State::Key;
+      return true;
+    }
+    if (c == '}') {
+      _state = State::Done;
+      return true;
+    }
+    return isSpace(c) || fail("expected ',' or '}'");
+
+  case State::Done:
+    return isSpace(c) || fail("data after the object");
+
+  case State::Failed:
+    return false;
+  }
+  return false;
+}
+
+} // namespace wifiprov
@@ -0,0 +1,105 @@
+#ifndef WIFIPROVISIONER_PROVISION_REQUEST_H
+#define WIFIPROVISIONER_PROVISION_REQUEST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace wifiprov {
+
+// Longest device code /configure accepts, whatever Config::INPUT_LENGTH says.
+#ifndef WIFI_PROVISIONER_MAX_CODE_LENGTH
+#define WIFI_PROVISIONER_MAX_CODE_LENGTH 64
+#endif
+
+/**
+ * @brief The fields of a /configure request, in fixed buffers. Lengths are
+ * in bytes: an SSID is at most 32, a WPA passphrase at most 64.
+ */
+struct ProvisionRequest {
+  static constexpr size_t kSsidMax = 32;
+  static constexpr size_t kPasswordMax = 64;
+  static constexpr size_t kCodeMax = WIFI_PROVISIONER_MAX_CODE_LENGTH;
+  static constexpr size_t kUsernameMax = 64;
+  static constexpr size_t kServicePasswordMax = 64;
+
+  // Bits of `present`: optional fields the request carried as strings
+  static constexpr uint8_t kPassword = 1 << 0;
+  static constexpr uint8_t kCode = 1 << 1;
+  static constexpr uint8_t kUsername = 1 << 2;
+  static constexpr uint8_t kServicePassword = 1 << 3;
+
+  char ssid[kSsidMax + 1];
+  char password[kPasswordMax + 1];
+  char code[kCodeMax + 1];
+  char username[kUsernameMax + 1];
+  char servicePassword[kServicePasswordMax + 1];
+  uint8_t present;
+
+  // Empties every field; the old contents are overwritten, not just cut off.
+  void clear();
+  // A field as the callbacks expect it: nullptr if the request left it out.
+  const char *optional(const char *field, uint8_t bit) const {
+    return (present & bit) ? field : nullptr;
+  }
+};
+
+/**
+ * @brief Push parser for the /configure JSON body.
+ *
+ * Bytes are fed as they are available, in any split, and decoded straight
+ * into a ProvisionRequest; nothing is allocated. Known members are copied
+ * with their escapes resolved. A value longer than its field fails the
+ * parse at the byte that overflows it. Other members are skipped, nested
+ * ones included. Known members that are not strings (null, numbers) count
+ * as absent.
+ */
+class ProvisionRequestParser {
+public:
+  // `codeLimit` caps the code below kCodeMax, e.g. to Config::INPUT_LENGTH; 0 = no extra cap.
+  ProvisionRequestParser(ProvisionRequest &out, size_t codeLimit = 0);
+
+  // False once the input is known to be bad.
+  bool feed(const char *data, size_t len);
+  // Call after the last byte; false unless a complete object was read.
+  bool finish();
+
+  // Why the parse failed, for the log.
+  const char *error() const { return _error; }
+
+private:
+  enum class State : uint8_t {
+    Start, KeyOrEnd, Key, Colon, Value, String, Escape, Unicode, Literal,
+    Nested, NestedString, NestedEscape, AfterValue, Done, Failed
+  };
+
+  bool step(char c);
+  bool fail(const char *why);
+  void selectField();
+  bool put(uint8_t byte);
+  bool putCodepoint(uint32_t cp);
+
+  ProvisionRequest &_out;
+  size_t _codeLimit;
+  State _state;
+  const char *_error;
+
+  char _key[24]; // Current member name; longer names are unknown anyway
+  uint8_t _keyLength;
+  bool _inKey;
+
+  // String being decoded: a field, or nullptr to skip
+  char *_target;
+  size_t _capacity;
+  size_t _length;
+  const char *_tooLong; // Error if it overflows
+  uint8_t _presentBit;
+
+  uint32_t _unicode; // \uXXXX being read
+  uint8_t _unicodeDigits;
+  uint16_t _highSurrogate; // Waiting for its low half, or 0
+  uint8_t _depth; // Nesting of a skipped value
+};
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_PROVISION_REQUEST_H
@@ -0,0 +1,70 @@
+#include "response_writer.h"
+#include <string.h>
+
+namespace wifiprov {
+
+ResponseWriter::ResponseWriter(WiFiClient &client)
+    : _client(client), _used(0), _segments(0), _bytes(0), _failed(false) {}
+
+void ResponseWriter::begin() {
+  _used = 0;
+  _segments = 0;
+  _bytes = 0;
+  _failed = false;
+  _client.setNoDelay(true);
+}
+
+size_t ResponseWriter::write(uint8_t byte) { return write(&byte, 1); }
+
+size_t ResponseWriter::write(const uint8_t *data, size_t len) {
+  size_t remaining = len;
+
+  // Top up a partially filled buffer first
+  if (_used > 0) {
+    size_t room = kSegmentSize - _used;
+    size_t n = remaining < room ? remaining : room;
+    memcpy(_buf + _used, data, n);
+    _used += n;
+    data += n;
+    remaining -= n;
+    if (_used == kSegmentSize) {
+      send(_buf, _used);
+      _used = 0;
+    }
+  }
+
+  // Whole segments can go out without a copy
+  while (remaining >= kSegmentSize) {
+    send(data, kSegmentSize);
+    data += kSegmentSize;
+    remaining -= kSegmentSize;
+  }
+
+  if (remaining > 0) {
+    memcpy(_buf, data, remaining);
+    _used = remaining;
+  }
+  return _failed ? 0 : len;
+}
+
+void ResponseWriter::flush() {
+  if (_used > 0) {
+    send(_buf, _used);
+    _used = 0;
+  }
+}
+
+void ResponseWriter::send(const uint8_t *data, size_t len) {
+  if (_failed) {
+    return;
+  }
+  size_t written = _client.write(data, len);
+  _segments++;
+  _bytes += written;
+  if (written != len) {
+    // Peer went away; drop the rest of the response
+    _failed = true;
+  }
+}
+
+} // namespace wifiprov
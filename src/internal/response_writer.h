@@ -0,0 +1,57 @@
+#ifndef WIFIPROVISIONER_RESPONSE_WRITER_H
+#define WIFIPROVISIONER_RESPONSE_WRITER_H
+
+#include <Print.h>
+#include <WiFiClient.h>
+#include <lwip/opt.h>
+
+namespace wifiprov {
+
+// Payload bytes per TCP segment; defaults to the lwIP MSS of the core.
+#ifndef WIFI_PROVISIONER_SEGMENT_SIZE
+#define WIFI_PROVISIONER_SEGMENT_SIZE TCP_MSS
+#endif
+
+/**
+ * @brief Coalesces an HTTP response into full TCP segments.
+ *
+ * Headers and small body pieces are collected in a fixed, segment-sized
+ * buffer that is only handed to the socket once it is full. Large writes go
+ * straight to the socket in whole segments. Only the tail of the response,
+ * sent by flush(), can produce a short segment. Nagle is disabled on the
+ * client, so that tail goes out immediately instead of waiting for an ACK.
+ */
+class ResponseWriter : public Print {
+public:
+  static constexpr size_t kSegmentSize = WIFI_PROVISIONER_SEGMENT_SIZE;
+
+  explicit ResponseWriter(WiFiClient &client);
+
+  // Starts a new response on the client; the counters restart at zero.
+  void begin();
+
+  size_t write(uint8_t byte) override;
+  size_t write(const uint8_t *data, size_t len) override;
+  using Print::write;
+
+  // Sends whatever is buffered; call once the response is complete.
+  void flush() override;
+
+  // Socket writes issued and payload bytes handed to the socket so far.
+  uint32_t segments() const { return _segments; }
+  uint32_t bytes() const { return _bytes; }
+
+private:
+  void send(const uint8_t *data, size_t len);
+
+  WiFiClient &_client;
+  uint8_t _buf[kSegmentSize];
+  size_t _used;
+  uint32_t _segments;
+  uint32_t _bytes;
+  bool _failed;
+};
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_RESPONSE_WRITER_H
@@ -0,0 +1,63 @@
+#include "service_task.h"
+
+namespace wifiprov {
+
+ServiceTask::ServiceTask()
+    : _handle(nullptr), _stopped(nullptr), _idleTicks(1), _stopRequested(false) {}
+
+ServiceTask::~ServiceTask() {
+  stop();
+  if (_stopped) {
+    vSemaphoreDelete(_stopped);
+  }
+}
+
+bool ServiceTask::start(const char *name, uint32_t stackSize, UBaseType_t priority,
+                        int core, uint32_t idleMs, std::function<void()> work) {
+  if (_handle) {
+    return false;
+  }
+  if (!_stopped) {
+    _stopped = xSemaphoreCreateBinary();
+    if (!_stopped) {
+      return false;
+    }
+  }
+  _work = std::move(work);
+  _stopRequested = false;
+  // At least one tick, so lower-priority tasks (and the idle task's
+  // watchdog feed) get to run between passes
+  _idleTicks = pdMS_TO_TICKS(idleMs);
+  if (_idleTicks == 0) {
+    _idleTicks = 1;
+  }
+
+  BaseType_t affinity = core < 0 ? tskNO_AFFINITY : core;
+  if (xTaskCreatePinnedToCore(&ServiceTask::entry, name, stackSize, this, priority,
+                              &_handle, affinity) != pdPASS) {
+    _handle = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void ServiceTask::stop() {
+  if (!_handle) {
+    return;
+  }
+  _stopRequested = true;
+  xSemaphoreTake(_stopped, portMAX_DELAY);
+  _handle = nullptr;
+}
+
+void ServiceTask::entry(void *arg) {
+  ServiceTask *self = static_cast<ServiceTask *>(arg);
+  while (!self->_stopRequested) {
+    self->_work();
+    vTaskDelay(self->_idleTicks);
+  }
+  xSemaphoreGive(self->_stopped);
+  vTaskDelete(nullptr);
+}
+
+} // namespace wifiprov
@@ -0,0 +1,47 @@
+#ifndef WIFIPROVISIONER_SERVICE_TASK_H
+#define WIFIPROVISIONER_SERVICE_TASK_H
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <functional>
+#include <stdint.h>
+
+namespace wifiprov {
+
+/**
+ * @brief A FreeRTOS task that calls one piece of work in a loop until
+ * stopped, e.g. to service a server without the application's loop.
+ *
+ * stop() waits for the current pass to finish, so whatever the work touches
+ * can be torn down safely once it returns.
+ */
+class ServiceTask {
+public:
+  ServiceTask();
+  ~ServiceTask();
+
+  ServiceTask(const ServiceTask &) = delete;
+  ServiceTask &operator=(const ServiceTask &) = delete;
+
+  // Starts calling `work`, sleeping `idleMs` between passes. `core` < 0
+  // leaves the task unpinned.
+  bool start(const char *name, uint32_t stackSize, UBaseType_t priority, int core,
+             uint32_t idleMs, std::function<void()> work);
+  // Blocks until the task has left its loop and deleted itself.
+  void stop();
+  bool running() const { return _handle != nullptr; }
+
+private:
+  static void entry(void *arg);
+
+  std::function<void()> _work;
+  TaskHandle_t _handle;
+  SemaphoreHandle_t _stopped;
+  TickType_t _idleTicks;
+  volatile bool _stopRequested;
+};
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_SERVICE_TASK_H
@@ -0,0 +1,709 @@
+#include "socket_http_server.h"
+#include "idle_waiter.h"
+#include <Arduino.h>
+#include <errno.h>
+#include <lwip/opt.h>
+#include <lwip/sockets.h>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace wifiprov {
+
+namespace {
+
+// Bytes sent per slot per pass: enough to fill a couple of segments, small
+// enough that every busy slot gets its turn quickly
+constexpr size_t kSendBudget = 2 * TCP_MSS;
+// A response whose peer stops reading for this long is dropped
+constexpr unsigned long kStallTimeout = 10000;
+// A new connection that has sent nothing for this long may be evicted
+// like a kept-alive one
+constexpr unsigned long kSilentConnection = 1000;
+
+const char *rejectText(int statusCode) {
+  switch (statusCode) {
+  case 405: return "405 Method Not Allowed";
+  case 413: return "413 Payload Too Large";
+  case 431: return "431 Request Header Fields Too Large";
+  default: return "400 Bad Request";
+  }
+}
+
+int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Appends the URL-decoded form of [begin, end) to `out`
+void urlDecode(const char *begin, const char *end, String &out) {
+  out.reserve(end - begin);
+  for (const char *p = begin; p < end; ++p) {
+    if (*p == '+') {
+      out += ' ';
+    } else if (*p == '%' && end - p >= 3 && hexValue(p[1]) >= 0 && hexValue(p[2]) >= 0) {
+      out += (char)(hexValue(p[1]) << 4 | hexValue(p[2]));
+      p += 2;
+    } else {
+      out += *p;
+    }
+  }
+}
+
+// Whether a comma-separated header value lists `token`
+bool hasToken(const char *value, const char *token) {
+  size_t tokenLength = strlen(token);
+  for (const char *p = value; *p;) {
+    while (*p == ' ' || *p == ',') ++p;
+    const char *start = p;
+    while (*p && *p != ',' && *p != ' ') ++p;
+    if ((size_t)(p - start) == tokenLength && strncasecmp(start, token, tokenLength) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// FNV-1a over the path, seeded with the method
+uint32_t routeHash(HttpMethod method, const char *path) {
+  uint32_t hash = 2166136261u ^ (uint32_t)method;
+  for (; *path; ++path) {
+    hash = (hash ^ (uint8_t)*path) * 16777619u;
+  }
+  return hash;
+}
+
+// Header names, by SocketHttpServer::KnownHeader
+const char *const kKnownHeaderNames[] = {"Host", "Accept-Encoding", "If-None-Match"};
+
+// Terminates the line starting at `line` and returns where the next begins
+char *splitLine(char *line, char *end) {
+  char *eol = (char *)memchr(line, '\r', end - line);
+  if (!eol) {
+    return end;
+  }
+  *eol = '\0';
+  return eol + 2 <= end ? eol + 2 : end;
+}
+
+char *trim(char *s) {
+  while (*s == ' ' || *s == '\t') ++s;
+  size_t len = strlen(s);
+  while (len > 0 && (s[len - 1] == ' ' || s[len - 1] == '\t')) s[--len] = '\0';
+  return s;
+}
+
+} // namespace
+
+SocketHttpServer::SocketHttpServer(uint16_t port)
+    : _port(port), _listenFd(-1), _slots(nullptr), _nextSlot(0), _routeCount(0),
+      _current(nullptr), _writer(*this) {
+  memset(_routeIndex, 0, sizeof(_routeIndex));
+}
+
+SocketHttpServer::~SocketHttpServer() { end(); }
+
+bool SocketHttpServer::begin() {
+  end();
+  _slots = new (std::nothrow) Slot[WIFI_PROVISIONER_HTTP_SLOTS];
+  if (!_slots) {
+    return false;
+  }
+  for (size_t i = 0; i < WIFI_PROVISIONER_HTTP_SLOTS; ++i) {
+    _slots[i].fd = -1;
+    _slots[i].state = SlotState::Free;
+    _slots[i].owner = nullptr;
+  }
+
+  _listenFd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (_listenFd < 0) {
+    end();
+    return false;
+  }
+  int reuse = 1;
+  setsockopt(_listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+  struct sockaddr_in local;
+  memset(&local, 0, sizeof(local));
+  local.sin_family = AF_INET;
+  local.sin_port = htons(_port);
+  local.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(_listenFd, (struct sockaddr *)&local, sizeof(local)) < 0 ||
+      listen(_listenFd, 2 * WIFI_PROVISIONER_HTTP_SLOTS) < 0) {
+    end();
+    return false;
+  }
+  fcntl(_listenFd, F_SETFL, fcntl(_listenFd, F_GETFL, 0) | O_NONBLOCK);
+  return true;
+}
+
+void SocketHttpServer::end() {
+  if (_slots) {
+    for (size_t i = 0; i < WIFI_PROVISIONER_HTTP_SLOTS; ++i) {
+      closeSlot(_slots[i]);
+    }
+    delete[] _slots;
+    _slots = nullptr;
+  }
+  if (_listenFd >= 0) {
+    close(_listenFd);
+    _listenFd = -1;
+  }
+}
+
+bool SocketHttpServer::on(const char *path, HttpMethod method, Handler handler) {
+  if (_routeCount == kMaxRoutes) {
+    return false;
+  }
+  uint32_t hash = routeHash(method, path);
+  size_t bucket = hash & (kRouteBuckets - 1);
+  while (_routeIndex[bucket]) {
+    bucket = (bucket + 1) & (kRouteBuckets - 1);
+  }
+  _routes[_routeCount] = Route{path, method, hash, handler};
+  _routeIndex[bucket] = ++_routeCount;
+  return true;
+}
+
+const SocketHttpServer::Handler &SocketHttpServer::route(const Slot &slot) const {
+  uint32_t hash = routeHash(slot.method, slot.path);
+  // The first route registered for a path wins, as it comes first in its chain
+  for (size_t bucket = hash & (kRouteBuckets - 1); _routeIndex[bucket];
+       bucket = (bucket + 1) & (kRouteBuckets - 1)) {
+    const Route &r = _routes[_routeIndex[bucket] - 1];
+    if (r.hash == hash && r.method == slot.method && strcmp(r.path, slot.path) == 0) {
+      return r.handler;
+    }
+  }
+  return _notFound;
+}
+
+void SocketHttpServer::poll() {
+  if (_listenFd < 0) {
+    return;
+  }
+  acceptClients();
+
+  for (size_t i = 0; i < WIFI_PROVISIONER_HTTP_SLOTS; ++i) {
+    Slot &slot = _slots[(_nextSlot + i) % WIFI_PROVISIONER_HTTP_SLOTS];
+    if (slot.state == SlotState::Reading) {
+      readRequest(slot);
+      if (slot.state == SlotState::Reading && millis() - slot.lastActivity > kIdleTimeout) {
+        closeSlot(slot);
+      }
+    } else if (slot.state == SlotState::Writing) {
+      if (!transmit(slot, kSendBudget) || millis() - slot.lastActivity > kStallTimeout) {
+        closeSlot(slot);
+      } else if (!pending(slot)) {
+        complete(slot);
+      }
+    }
+  }
+  _nextSlot = (_nextSlot + 1) % WIFI_PROVISIONER_HTTP_SLOTS;
+}
+
+void SocketHttpServer::watchSockets(IdleWaiter &waiter) {
+  if (_listenFd < 0) {
+    return;
+  }
+  bool room = false;
+  for (size_t i = 0; i < WIFI_PROVISIONER_HTTP_SLOTS; ++i) {
+    const Slot &slot = _slots[i];
+    switch (slot.state) {
+    case SlotState::Free:
+      room = true;
+      break;
+    case SlotState::Reading:
+      // A buffered next request, or a full buffer to reject, needs no data
+      if (slot.pipelined || slot.requestLength + 1 >= sizeof(slot.request)) {
+        waiter.noteActivity();
+      } else {
+        waiter.watchRead(slot.fd);
+      }
+      break;
+    case SlotState::Writing:
+      if (pending(slot)) {
+        waiter.watchWrite(slot.fd);
+      } else {
+        waiter.noteActivity();
+      }
+      break;
+    }
+  }
+  // A waiting connection would keep select() returning until a slot is
+  // free to take it
+  if (room || idleSlot()) {
+    waiter.watchRead(_listenFd);
+  }
+}
+
+void SocketHttpServer::acceptClients() {
+  for (size_t i = 0; i < WIFI_PROVISIONER_HTTP_SLOTS; ++i) {
+    Slot &slot = _slots[i];
+    if (slot.state != SlotState::Free) {
+      continue;
+    }
+    int fd = accept(_listenFd, nullptr, nullptr);
+    if (fd < 0) {
+      return; // Nobody waiting
+    }
+    openSlot(slot, fd);
+  }
+
+  // All slots busy: a connection sitting idle between requests makes way
+  // for one that is waiting, as browsers open more than they use
+  Slot *idle = idleSlot();
+  if (idle) {
+    int fd = accept(_listenFd, nullptr, nullptr);
+    if (fd >= 0) {
+      closeSlot(*idle);
+      openSlot(*idle, fd);
+    }
+  }
+}
+
+void SocketHttpServer::openSlot(Slot &slot, int fd) {
+  // Responses are sent in whole pieces; their tail should not wait for
+  // an ACK
+  int noDelay = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+  slot.fd = fd;
+  slot.state = SlotState::Reading;
+  slot.lastActivity = millis();
+  slot.requestLength = 0;
+  slot.headerLength = 0;
+  slot.scanned = 0;
+  slot.request[0] = '\0';
+  slot.pipelined = false;
+  slot.keepAlive = false;
+  slot.requests = 0;
+  slot.responding = false;
+  slot.failed = false;
+}
+
+SocketHttpServer::Slot *SocketHttpServer::idleSlot() {
+  Slot *oldest = nullptr;
+  for (size_t i = 0; i < WIFI_PROVISIONER_HTTP_SLOTS; ++i) {
+    Slot &slot = _slots[i];
+    if (slot.state == SlotState::Reading && slot.requestLength == 0 &&
+        (slot.requests > 0 || millis() - slot.lastActivity >= kSilentConnection) &&
+        (!oldest || (long)(slot.lastActivity - oldest->lastActivity) < 0)) {
+      oldest = &slot;
+    }
+  }
+  return oldest;
+}
+
+void SocketHttpServer::readRequest(Slot &slot) {
+  if (slot.pipelined) {
+    // Left over from the previous request; may already be complete
+    slot.pipelined = false;
+    processRequest(slot);
+    return;
+  }
+  size_t room = sizeof(slot.request) - 1 - slot.requestLength;
+  if (room == 0) {
+    reject(slot, slot.headerLength ? 413 : 431);
+    return;
+  }
+  int n = recv(slot.fd, slot.request + slot.requestLength, room, MSG_DONTWAIT);
+  if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+    closeSlot(slot); // Closed before a full request arrived
+    return;
+  }
+  if (n < 0) {
+    return;
+  }
+  slot.requestLength += n;
+  slot.request[slot.requestLength] = '\0';
+  slot.lastActivity = millis();
+  processRequest(slot);
+}
+
+void SocketHttpServer::processRequest(Slot &slot) {
+  int result = parseRequest(slot);
+  if (result == 1) {
+    dispatch(slot);
+  } else if (result != 0) {
+    reject(slot, result);
+  }
+}
+
+int SocketHttpServer::parseRequest(Slot &slot) {
+  if (slot.headerLength == 0) {
+    // Only what arrived since the last pass is searched, plus three bytes
+    // in case the blank line straddles the two
+    char *blank = strstr(slot.request + (slot.scanned > 3 ? slot.scanned - 3 : 0), "\r\n\r\n");
+    slot.scanned = slot.requestLength;
+    if (!blank) {
+      return 0;
+    }
+    slot.headerLength = blank + 4 - slot.request;
+    *blank = '\0';
+    int result = parseHead(slot, blank);
+    if (result != 1) {
+      return result;
+    }
+    if (slot.contentLength > sizeof(slot.request) - 1 - slot.headerLength) {
+      return 413;
+    }
+  }
+
+  if (slot.requestLength < slot.headerLength + slot.contentLength) {
+    return 0; // Body still arriving
+  }
+  // Terminate the body for arg("plain"), keeping the byte it replaces
+  slot.bodyEnd = slot.request[slot.headerLength + slot.contentLength];
+  slot.request[slot.headerLength + slot.contentLength] = '\0';
+  return 1;
+}
+
+int SocketHttpServer::parseHead(Slot &slot, char *end) {
+  // Request line: METHOD SP target SP version
+  char *line = slot.request;
+  char *next = splitLine(line, end);
+  char *target;
+  if (memcmp(line, "GET ", 4) == 0) {
+    slot.method = HttpMethod::Get;
+    target = line + 4;
+  } else if (memcmp(line, "POST ", 5) == 0) {
+    slot.method = HttpMethod::Post;
+    target = line + 5;
+  } else {
+    return 405;
+  }
+  char *space = strchr(target, ' ');
+  if (!space || *target != '/') {
+    return 400;
+  }
+  *space = '\0';
+  // HTTP/1.1 connections persist by default, 1.0 ones only on request
+  bool persistent = strcmp(space + 1, "HTTP/1.1") == 0;
+  char *question = strchr(target, '?');
+  if (question) {
+    *question = '\0';
+  }
+  slot.path = target;
+  slot.query = question ? question + 1 : "";
+
+  // Header lines, split in place; only the ones used are looked at
+  for (size_t i = 0; i < kKnownHeaders; ++i) {
+    slot.headers[i] = nullptr;
+  }
+  slot.contentLength = 0;
+  for (line = next; line < end; line = next) {
+    next = splitLine(line, end);
+    char *colon = strchr(line, ':');
+    if (!colon) {
+      continue;
+    }
+    *colon = '\0';
+    const char *name = trim(line);
+    const char *value = trim(colon + 1);
+    switch (strlen(name)) {
+    case 4:
+      if (strcasecmp(name, "Host") == 0) slot.headers[kHost] = value;
+      break;
+    case 10:
+      if (strcasecmp(name, "Connection") == 0) {
+        persistent = persistent ? !hasToken(value, "close") : hasToken(value, "keep-alive");
+      }
+      break;
+    case 13:
+      if (strcasecmp(name, "If-None-Match") == 0) slot.headers[kIfNoneMatch] = value;
+      break;
+    case 14:
+      if (strcasecmp(name, "Content-Length") == 0) slot.contentLength = strtoul(value, nullptr, 10);
+      break;
+    case 15:
+      if (strcasecmp(name, "Accept-Encoding") == 0) slot.headers[kAcceptEncoding] = value;
+      break;
+    }
+  }
+  slot.keepAlive = persistent && slot.requests + 1 < WIFI_PROVISIONER_HTTP_MAX_REQUESTS;
+  return 1;
+}
+
+void SocketHttpServer::dispatch(Slot &slot) {
+  const Handler &handler = route(slot);
+
+  _current = &slot;
+  slot.requests++;
+  slot.responding = false;
+  if (handler) {
+    handler();
+  }
+  _current = nullptr;
+
+  if (!slot.responding || slot.failed) {
+    closeSlot(slot); // Nothing to send, or nobody to send it to
+    return;
+  }
+  if (slot.state != SlotState::Writing) {
+    endResponse(slot); // The handler never called endResponse()
+  }
+  if (slot.failed) {
+    closeSlot(slot);
+  } else if (!pending(slot)) {
+    complete(slot);
+  }
+}
+
+void SocketHttpServer::reject(Slot &slot, int statusCode) {
+  int len = snprintf((char *)slot.response, sizeof(slot.response),
+                     "HTTP/1.1 %s\r\nConnection: close\r\nContent-Length: 0\r\n\r\n",
+                     rejectText(statusCode));
+  slot.responseLength = len;
+  slot.responseSent = 0;
+  slot.stable = nullptr;
+  slot.stableLength = slot.stableSent = 0;
+  slot.keepAlive = false;
+  slot.state = SlotState::Writing;
+  slot.lastActivity = millis();
+}
+
+bool SocketHttpServer::pending(const Slot &slot) {
+  return slot.responseSent < slot.responseLength || slot.stableSent < slot.stableLength;
+}
+
+bool SocketHttpServer::transmit(Slot &slot, size_t budget) {
+  while (budget > 0) {
+    const uint8_t *data;
+    size_t left;
+    if (slot.responseSent < slot.responseLength) {
+      data = slot.response + slot.responseSent;
+      left = slot.responseLength - slot.responseSent;
+    } else if (slot.stableSent < slot.stableLength) {
+      data = slot.stable + slot.stableSent;
+      left = slot.stableLength - slot.stableSent;
+    } else {
+      return true;
+    }
+    size_t n = left < budget ? left : budget;
+    int sent = send(slot.fd, data, n, MSG_DONTWAIT);
+    if (sent < 0) {
+      return errno == EAGAIN || errno == EWOULDBLOCK; // Else the peer is gone
+    }
+    if (slot.responseSent < slot.responseLength) {
+      slot.responseSent += sent;
+    } else {
+      slot.stableSent += sent;
+    }
+    slot.bytes += sent;
+    slot.segments++;
+    slot.lastActivity = millis();
+    budget -= sent;
+    if ((size_t)sent < n) {
+      return true; // Send buffer full; continue on a later pass
+    }
+  }
+  return true;
+}
+
+bool SocketHttpServer::drain(Slot &slot) {
+  while (pending(slot)) {
+    uint32_t before = slot.bytes;
+    if (!transmit(slot, SIZE_MAX)) {
+      return false;
+    }
+    if (slot.bytes == before) {
+      if (millis() - slot.lastActivity > kStallTimeout) {
+        return false;
+      }
+      delay(1);
+    }
+  }
+  slot.responseLength = slot.responseSent = 0;
+  if (slot.owner) {
+    slot.owner->release();
+    slot.owner = nullptr;
+  }
+  slot.stable = nullptr;
+  slot.stableLength = slot.stableSent = 0;
+  return true;
+}
+
+void SocketHttpServer::complete(Slot &slot) {
+  if (!slot.keepAlive || slot.failed) {
+    closeSlot(slot);
+    return;
+  }
+  if (slot.owner) {
+    slot.owner->release();
+    slot.owner = nullptr;
+  }
+  // Move a pipelined next request to the front of the buffer
+  size_t used = slot.headerLength + slot.contentLength;
+  slot.request[used] = slot.bodyEnd;
+  size_t left = slot.requestLength - used;
+  memmove(slot.request, slot.request + used, left);
+  slot.request[left] = '\0';
+  slot.requestLength = left;
+  slot.headerLength = 0;
+  slot.scanned = 0;
+  slot.pipelined = left > 0;
+  slot.state = SlotState::Reading;
+  slot.lastActivity = millis();
+}
+
+void SocketHttpServer::closeSlot(Slot &slot) {
+  if (slot.owner) {
+    slot.owner->release();
+    slot.owner = nullptr;
+  }
+  if (slot.fd >= 0) {
+    close(slot.fd);
+    slot.fd = -1;
+  }
+  slot.state = SlotState::Free;
+}
+
+String SocketHttpServer::uri() { return _current ? String(_current->path) : String(); }
+
+String SocketHttpServer::header(const char *name) {
+  if (_current) {
+    for (size_t i = 0; i < kKnownHeaders; ++i) {
+      if (strcasecmp(kKnownHeaderNames[i], name) == 0 && _current->headers[i]) {
+        return String(_current->headers[i]);
+      }
+    }
+  }
+  return String();
+}
+
+bool SocketHttpServer::hasArg(const char *name) {
+  if (_current && strcmp(name, "plain") == 0) {
+    return _current->contentLength > 0;
+  }
+  return findArg(name, nullptr);
+}
+
+String SocketHttpServer::arg(const char *name) {
+  String value;
+  if (_current && strcmp(name, "plain") == 0) {
+    value = _current->request + _current->headerLength;
+  } else {
+    findArg(name, &value);
+  }
+  return value;
+}
+
+const char *SocketHttpServer::body(size_t *length) {
+  if (!_current || _current->contentLength == 0) {
+    return nullptr;
+  }
+  *length = _current->contentLength;
+  return _current->request + _current->headerLength;
+}
+
+bool SocketHttpServer::findArg(const char *name, String *value) {
+  if (!_current) {
+    return false;
+  }
+  size_t nameLength = strlen(name);
+  const char *p = _current->query;
+  while (*p) {
+    const char *end = strchr(p, '&');
+    if (!end) {
+      end = p + strlen(p);
+    }
+    const char *eq = (const char *)memchr(p, '=', end - p);
+    const char *keyEnd = eq ? eq : end;
+    if ((size_t)(keyEnd - p) == nameLength && strncmp(p, name, nameLength) == 0) {
+      if (value && eq) {
+        urlDecode(eq + 1, end, *value);
+      }
+      return true;
+    }
+    p = *end ? end + 1 : end;
+  }
+  return false;
+}
+
+Print *SocketHttpServer::beginResponse() {
+  Slot *slot = _current;
+  if (!slot) {
+    return nullptr;
+  }
+  if (slot->owner) {
+    slot->owner->release();
+    slot->owner = nullptr;
+  }
+  slot->responseLength = slot->responseSent = 0;
+  slot->stable = nullptr;
+  slot->stableLength = slot->stableSent = 0;
+  slot->bytes = 0;
+  slot->segments = 0;
+  slot->failed = false;
+  slot->responding = true;
+  return &_writer;
+}
+
+size_t SocketHttpServer::SlotWriter::write(const uint8_t *data, size_t len) {
+  Slot *slot = _server._current;
+  if (!slot || slot->failed) {
+    return 0;
+  }
+  size_t remaining = len;
+  while (remaining > 0) {
+    size_t room = sizeof(slot->response) - slot->responseLength;
+    if (slot->stable || room == 0) {
+      // Out of buffer: send what is queued before taking more
+      if (!_server.drain(*slot)) {
+        slot->failed = true;
+        return 0;
+      }
+      continue;
+    }
+    size_t n = remaining < room ? remaining : room;
+    memcpy(slot->response + slot->responseLength, data, n);
+    slot->responseLength += n;
+    data += n;
+    remaining -= n;
+  }
+  return len;
+}
+
+void SocketHttpServer::sendStable(const uint8_t *data, size_t length, SharedBuffer *owner) {
+  Slot *slot = _current;
+  if (!slot || slot->failed) {
+    return;
+  }
+  if (slot->stable && !drain(*slot)) {
+    slot->failed = true;
+    return;
+  }
+  if (owner) {
+    owner->retain();
+  }
+  slot->stable = data;
+  slot->stableLength = length;
+  slot->stableSent = 0;
+  slot->owner = owner;
+}
+
+ResponseStats SocketHttpServer::endResponse() {
+  if (!_current) {
+    return ResponseStats{0, 0};
+  }
+  return endResponse(*_current);
+}
+
+ResponseStats SocketHttpServer::endResponse(Slot &slot) {
+  slot.state = SlotState::Writing;
+  slot.lastActivity = millis();
+  // Small responses leave right away, even if the handler goes on to block
+  if (!slot.failed && !transmit(slot, kSendBudget)) {
+    slot.failed = true;
+  }
+  // The rest goes out from poll(); count it as sent
+  uint32_t queued = (slot.responseLength - slot.responseSent) +
+                    (slot.stableLength - slot.stableSent);
+  return ResponseStats{slot.bytes + queued, slot.segments};
+}
+
+} // namespace wifiprov
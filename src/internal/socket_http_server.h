@@ -0,0 +1,188 @@
+#ifndef WIFIPROVISIONER_SOCKET_HTTP_SERVER_H
+#define WIFIPROVISIONER_SOCKET_HTTP_SERVER_H
+
+#include "http_transport.h"
+
+namespace wifiprov {
+
+// Connections a SocketHttpServer serves at once; more wait in the backlog.
+#ifndef WIFI_PROVISIONER_HTTP_SLOTS
+#define WIFI_PROVISIONER_HTTP_SLOTS 4
+#endif
+
+// Per-connection buffer for the request line, headers and body.
+#ifndef WIFI_PROVISIONER_HTTP_REQUEST_BUFFER
+#define WIFI_PROVISIONER_HTTP_REQUEST_BUFFER 1536
+#endif
+
+// Per-connection buffer for response headers and small bodies.
+#ifndef WIFI_PROVISIONER_HTTP_RESPONSE_BUFFER
+#define WIFI_PROVISIONER_HTTP_RESPONSE_BUFFER 2048
+#endif
+
+// Requests served on one persistent connection before it is closed.
+#ifndef WIFI_PROVISIONER_HTTP_MAX_REQUESTS
+#define WIFI_PROVISIONER_HTTP_MAX_REQUESTS 32
+#endif
+
+/**
+ * @brief HttpTransport on non-blocking lwIP sockets, serving several clients
+ * at once.
+ *
+ * Each connection gets a slot with its own bounded request and response
+ * buffers. poll() reads requests as their bytes arrive, runs the handler
+ * once one is complete and then sends responses a segment or two per slot
+ * per pass, so a large page going to one client does not hold up the small
+ * JSON replies to another. A response is the slot's buffered bytes
+ * followed by at most one stable body, sent straight from flash or a pinned
+ * SharedBuffer. Only a response that outgrows the slot buffer before its
+ * stable body is flushed while the handler runs, which blocks the other
+ * slots; the portal only does that for the page when it had no memory to
+ * cache it.
+ *
+ * Connections are persistent unless the client asks otherwise: after a
+ * response the slot waits for the next request on the same socket, up to
+ * kIdleTimeout and WIFI_PROVISIONER_HTTP_MAX_REQUESTS requests. An idle
+ * connection gives up its slot when a new one is waiting for it.
+ *
+ * Requests are parsed in place and only the headers the portal reads are
+ * kept. Routes are found through a hash of method and path, so a lookup is
+ * one hash and one string compare however many routes there are.
+ */
+class SocketHttpServer : public HttpTransport {
+public:
+  static constexpr size_t kMaxRoutes = 32;
+  // Longest wait for a request, on a new or a kept-alive connection
+  static constexpr unsigned long kIdleTimeout = 5000;
+
+  explicit SocketHttpServer(uint16_t port);
+  ~SocketHttpServer() override;
+
+  SocketHttpServer(const SocketHttpServer &) = delete;
+  SocketHttpServer &operator=(const SocketHttpServer &) = delete;
+
+  bool begin() override;
+  void end() override;
+  void poll() override;
+  void watchSockets(IdleWaiter &waiter) override;
+
+  // Takes up to kMaxRoutes routes; false for any past that.
+  bool on(const char *path, HttpMethod method, Handler handler) override;
+  void onNotFound(Handler handler) override { _notFound = handler; }
+  // The headers kept are fixed: Host, Accept-Encoding and If-None-Match.
+  void collectHeaders(const char *const *, size_t) override {}
+
+  String uri() override;
+  String hostHeader() override { return header("Host"); }
+  String header(const char *name) override;
+  bool hasArg(const char *name) override;
+  String arg(const char *name) override;
+  // Points into the slot buffer; no copy is made.
+  const char *body(size_t *length) override;
+
+  bool keepAlive() override { return _current && _current->keepAlive; }
+  Print *beginResponse() override;
+  void sendStable(const uint8_t *data, size_t length, SharedBuffer *owner) override;
+  ResponseStats endResponse() override;
+
+private:
+  enum class SlotState : uint8_t { Free, Reading, Writing };
+
+  // Request headers handlers can read; the rest are dropped while parsing
+  enum KnownHeader : uint8_t { kHost, kAcceptEncoding, kIfNoneMatch, kKnownHeaders };
+
+  struct Slot {
+    int fd;
+    SlotState state;
+    unsigned long lastActivity; // millis() of the last progress
+
+    // Request, split in place once its headers are complete
+    char request[WIFI_PROVISIONER_HTTP_REQUEST_BUFFER];
+    size_t requestLength;
+    size_t headerLength; // 0 until the blank line has arrived
+    size_t scanned; // Bytes already searched for the blank line
+    size_t contentLength;
+    HttpMethod method;
+    const char *path;
+    const char *query;
+    const char *headers[kKnownHeaders]; // nullptr if absent
+    char bodyEnd; // Byte after the body, replaced by its terminator
+    bool pipelined; // The buffer holds the start of the next request
+    bool keepAlive; // The connection stays open after this response
+    uint16_t requests; // Requests served on this connection
+
+    // Response: the buffered bytes, then the stable body
+    uint8_t response[WIFI_PROVISIONER_HTTP_RESPONSE_BUFFER];
+    size_t responseLength;
+    size_t responseSent;
+    const uint8_t *stable;
+    size_t stableLength;
+    size_t stableSent;
+    SharedBuffer *owner;
+    uint32_t bytes;
+    uint32_t segments;
+    bool responding;
+    bool failed; // Peer gone mid-response; further writes are dropped
+  };
+
+  struct Route {
+    const char *path;
+    HttpMethod method;
+    uint32_t hash;
+    Handler handler;
+  };
+
+  // Open-addressed index into _routes, kept at most half full
+  static constexpr size_t kRouteBuckets = 2 * kMaxRoutes;
+  static_assert((kRouteBuckets & (kRouteBuckets - 1)) == 0, "kRouteBuckets must be a power of two");
+
+  // The Print handlers write their response to
+  class SlotWriter : public Print {
+  public:
+    explicit SlotWriter(SocketHttpServer &server) : _server(server) {}
+    size_t write(uint8_t byte) override { return write(&byte, 1); }
+    size_t write(const uint8_t *data, size_t len) override;
+    using Print::write;
+
+  private:
+    SocketHttpServer &_server;
+  };
+
+  void acceptClients();
+  void openSlot(Slot &slot, int fd);
+  Slot *idleSlot();
+  void readRequest(Slot &slot);
+  void processRequest(Slot &slot);
+  // 0 while incomplete, 1 when ready to dispatch, else a status to reject with
+  int parseRequest(Slot &slot);
+  // Parses the request line and headers in [slot.request, end)
+  int parseHead(Slot &slot, char *end);
+  const Handler &route(const Slot &slot) const;
+  void dispatch(Slot &slot);
+  void reject(Slot &slot, int statusCode);
+  ResponseStats endResponse(Slot &slot);
+  // Sends up to `budget` bytes without blocking. False once the peer is gone.
+  bool transmit(Slot &slot, size_t budget);
+  // Sends everything queued so far, waiting for the socket as needed.
+  bool drain(Slot &slot);
+  static bool pending(const Slot &slot);
+  // A response has gone out: wait for the next request or close.
+  void complete(Slot &slot);
+  void closeSlot(Slot &slot);
+  bool findArg(const char *name, String *value);
+
+  uint16_t _port;
+  int _listenFd;
+  Slot *_slots;
+  size_t _nextSlot; // Goes first on the next pass, for fairness
+  Route _routes[kMaxRoutes];
+  size_t _routeCount;
+  uint8_t _routeIndex[kRouteBuckets]; // Route number + 1, or 0 if empty
+  Handler _notFound;
+  Slot *_current; // Slot whose handler is running
+  SlotWriter _writer;
+};
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_SOCKET_HTTP_SERVER_H
@@ -0,0 +1,172 @@
+#include "station_connector.h"
+#include <esp_idf_version.h>
+#include <esp_wifi.h>
+#include <string.h>
+
+namespace wifiprov {
+
+namespace {
+
+constexpr EventBits_t kGotIpBit = 1 << 0;
+constexpr EventBits_t kFailedBit = 1 << 1;
+
+/**
+ * @brief Maps an 802.11 / ESP-IDF disconnect reason to a failure class.
+ * A wrong WPA2 password rarely gets an explicit rejection: the access
+ * point just stops answering the 4-way handshake. Those timeouts are kept
+ * apart from AuthFailed, since a weak link causes them too. Lost beacons
+ * stay AssocFailed and the driver's own retry gets its chance.
+ */
+ConnectFailure classifyReason(uint8_t reason) {
+  switch (reason) {
+  case WIFI_REASON_NO_AP_FOUND:
+#if ESP_IDF_VERSION_MAJOR >= 5
+  case WIFI_REASON_NO_AP_FOUND_W_COMPATIBLE_SECURITY:
+  case WIFI_REASON_NO_AP_FOUND_IN_AUTHMODE_THRESHOLD:
+  case WIFI_REASON_NO_AP_FOUND_IN_RSSI_THRESHOLD:
+#endif
+    return ConnectFailure::NoApFound;
+  case WIFI_REASON_AUTH_FAIL:
+  case WIFI_REASON_MIC_FAILURE:
+  case WIFI_REASON_802_1X_AUTH_FAILED:
+    return ConnectFailure::AuthFailed;
+  case WIFI_REASON_4WAY_HANDSHAKE_TIMEOUT:
+  case WIFI_REASON_HANDSHAKE_TIMEOUT:
+    return ConnectFailure::HandshakeTimeout;
+  case 0:
+    return ConnectFailure::Timeout;
+  default:
+    return ConnectFailure::AssocFailed;
+  }
+}
+
+/**
+ * @brief Reasons that end the attempt at once; the rest may still recover
+ * on the driver's own retry.
+ */
+bool isDefinitive(ConnectFailure failure) {
+  return failure == ConnectFailure::NoApFound || failure == ConnectFailure::AuthFailed ||
+         failure == ConnectFailure::HandshakeTimeout;
+}
+
+} // namespace
+
+const char *connectFailureName(ConnectFailure failure) {
+  switch (failure) {
+  case ConnectFailure::None: return "none";
+  case ConnectFailure::NoApFound: return "no_ap_found";
+  case ConnectFailure::AuthFailed: return "auth_failed";
+  case ConnectFailure::HandshakeTimeout: return "handshake_timeout";
+  case ConnectFailure::AssocFailed: return "assoc_failed";
+  case ConnectFailure::NoIp: return "no_ip";
+  case ConnectFailure::Timeout: return "timeout";
+  }
+  return "unknown";
+}
+
+StationConnector::StationConnector()
+    : _events(nullptr), _handler(0), _registered(false), _lastReason(0),
+      _associated(false), _hinted(false) {}
+
+StationConnector::~StationConnector() {
+  end();
+  if (_events) {
+    vEventGroupDelete(_events);
+  }
+}
+
+bool StationConnector::begin(const char *ssid, const char *password, const ConnectHint *hint) {
+  if (!_events) {
+    _events = xEventGroupCreate();
+    if (!_events) {
+      return false;
+    }
+  }
+  xEventGroupClearBits(_events, kGotIpBit | kFailedBit);
+  _lastReason = 0;
+  _associated = false;
+
+  if (!_registered) {
+    _handler = WiFi.onEvent([this](arduino_event_id_t event, arduino_event_info_t info) {
+      onEvent(event, info);
+    });
+    _registered = true;
+  }
+  _hinted = hint != nullptr;
+  if (hint) {
+    WiFi.begin(ssid, password, hint->channel, hint->bssid);
+  } else {
+    WiFi.begin(ssid, password);
+  }
+  return true;
+}
+
+bool StationConnector::wait(uint32_t timeoutMs) {
+  if (!_events) {
+    return true; // Nothing started; nothing to wait for
+  }
+  EventBits_t bits = xEventGroupWaitBits(_events, kGotIpBit | kFailedBit, pdFALSE,
+                                         pdFALSE, pdMS_TO_TICKS(timeoutMs));
+  return (bits & (kGotIpBit | kFailedBit)) != 0;
+}
+
+bool StationConnector::connected() const {
+  return _events && (xEventGroupGetBits(_events) & kGotIpBit);
+}
+
+ConnectFailure StationConnector::failure() const {
+  if (connected()) {
+    return ConnectFailure::None;
+  }
+  ConnectFailure failure = classifyReason(_lastReason);
+  if (failure == ConnectFailure::Timeout && _associated) {
+    return ConnectFailure::NoIp;
+  }
+  return failure;
+}
+
+void StationConnector::end() {
+  if (_registered) {
+    WiFi.removeEvent(_handler);
+    _registered = false;
+  }
+}
+
+bool StationConnector::storedHint(const char *ssid, ConnectHint &hint) {
+  wifi_config_t config;
+  if (esp_wifi_get_config(WIFI_IF_STA, &config) != ESP_OK) {
+    return false; // Driver not started
+  }
+  const wifi_sta_config_t &sta = config.sta;
+  size_t length = strlen(ssid);
+  if (length > sizeof(sta.ssid) || memcmp(sta.ssid, ssid, length) != 0 ||
+      (length < sizeof(sta.ssid) && sta.ssid[length] != 0) || !sta.bssid_set ||
+      sta.channel == 0) {
+    return false;
+  }
+  memcpy(hint.bssid, sta.bssid, sizeof(hint.bssid));
+  hint.channel = sta.channel;
+  return true;
+}
+
+void StationConnector::onEvent(arduino_event_id_t event, arduino_event_info_t info) {
+  switch (event) {
+  case ARDUINO_EVENT_WIFI_STA_CONNECTED:
+    _associated = true;
+    _lastReason = 0;
+    break;
+  case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+    xEventGroupSetBits(_events, kGotIpBit);
+    break;
+  case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+    _lastReason = info.wifi_sta_disconnected.reason;
+    if (isDefinitive(classifyReason(_lastReason))) {
+      xEventGroupSetBits(_events, kFailedBit);
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+} // namespace wifiprov
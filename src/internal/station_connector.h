@@ -0,0 +1,92 @@
+#ifndef WIFIPROVISIONER_STATION_CONNECTOR_H
+#define WIFIPROVISIONER_STATION_CONNECTOR_H
+
+#include <WiFi.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+#include <stdint.h>
+
+namespace wifiprov {
+
+/**
+ * @brief Why a station connect attempt did not end with an IP address.
+ */
+enum class ConnectFailure : uint8_t {
+  None,
+  NoApFound,        // SSID not seen on any channel
+  AuthFailed,       // Wrong password or handshake rejected
+  HandshakeTimeout, // Key handshake never finished; on ESP32 usually a
+                    // wrong WPA2 password, rarely a weak link
+  AssocFailed,      // AP refused or dropped the association
+  NoIp,             // Associated, but DHCP never produced an address
+  Timeout,          // No outcome before the deadline
+};
+
+/**
+ * @brief Short machine-readable name for a failure, as sent to the page.
+ */
+const char *connectFailureName(ConnectFailure failure);
+
+/**
+ * @brief Where a network was last seen. Passed to WiFi.begin() so the
+ * driver goes straight to that access point instead of scanning every
+ * channel first.
+ */
+struct ConnectHint {
+  uint8_t bssid[6];
+  uint8_t channel;
+};
+
+/**
+ * @brief Runs one WiFi.begin() attempt off the Wi-Fi event stream.
+ *
+ * Got-IP and definitive disconnect reasons (AP not found, authentication
+ * failure, handshake timeout) set bits in an event group, so wait() returns as soon as the
+ * outcome is known instead of on the next status poll. Other disconnects
+ * are remembered and only reported if the deadline passes.
+ *
+ * A hinted attempt that does not find its access point fails with
+ * NoApFound like any other; the caller retries without the hint.
+ */
+class StationConnector {
+public:
+  StationConnector();
+  ~StationConnector();
+
+  StationConnector(const StationConnector &) = delete;
+  StationConnector &operator=(const StationConnector &) = delete;
+
+  // Registers for events and calls WiFi.begin(), on the hinted channel and
+  // access point if `hint` is given. False if the event group could not be
+  // allocated.
+  bool begin(const char *ssid, const char *password, const ConnectHint *hint = nullptr);
+  // Blocks up to `timeoutMs` for an outcome; true once one is known.
+  bool wait(uint32_t timeoutMs);
+  bool connected() const;
+  // True once the station has associated during this attempt.
+  bool associated() const { return _associated; }
+  // True if the current attempt was started with a hint.
+  bool hinted() const { return _hinted; }
+  // The failure so far; on a pending attempt, what a timeout now would report.
+  ConnectFailure failure() const;
+  // Unregisters from the event stream; the attempt itself is left alone.
+  void end();
+
+  // The access point the driver's saved station config pins `ssid` to, as
+  // left by an earlier hinted begin(). False if it has none.
+  static bool storedHint(const char *ssid, ConnectHint &hint);
+
+private:
+  void onEvent(arduino_event_id_t event, arduino_event_info_t info);
+
+  EventGroupHandle_t _events;
+  wifi_event_id_t _handler;
+  bool _registered;
+  volatile uint8_t _lastReason;  // Last disconnect reason code, 0 if none
+  volatile bool _associated;     // Saw STA_CONNECTED during this attempt
+  bool _hinted;
+};
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_STATION_CONNECTOR_H
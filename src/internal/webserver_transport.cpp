@@ -0,0 +1,48 @@
+#include "webserver_transport.h"
+
+namespace wifiprov {
+
+WebServerTransport::WebServerTransport(uint16_t port) : _server(port), _out(_client) {}
+
+bool WebServerTransport::on(const char *path, HttpMethod method, Handler handler) {
+  _server.on(path, method == HttpMethod::Post ? HTTP_POST : HTTP_GET, handler);
+  return true; // WebServer keeps its routes in a list
+}
+
+void WebServerTransport::collectHeaders(const char *const *names, size_t count) {
+  // WebServer only keeps the request headers it is asked for
+  _server.collectHeaders(const_cast<const char **>(names), count);
+}
+
+const char *WebServerTransport::body(size_t *length) {
+  if (!_server.hasArg("plain")) {
+    return nullptr;
+  }
+  _body = _server.arg("plain");
+  *length = _body.length();
+  return _body.c_str();
+}
+
+Print *WebServerTransport::beginResponse() {
+  _client = _server.client();
+  if (!_client) {
+    return nullptr;
+  }
+  _out.begin();
+  return &_out;
+}
+
+void WebServerTransport::sendStable(const uint8_t *data, size_t length, SharedBuffer *) {
+  // Written before the handler returns, so the buffer needs no pin
+  _out.write(data, length);
+}
+
+ResponseStats WebServerTransport::endResponse() {
+  _out.flush();
+  _client.stop();
+  _client = WiFiClient();
+  _body = String();
+  return ResponseStats{_out.bytes(), _out.segments()};
+}
+
+} // namespace wifiprov
@@ -0,0 +1,51 @@
+#ifndef WIFIPROVISIONER_WEBSERVER_TRANSPORT_H
+#define WIFIPROVISIONER_WEBSERVER_TRANSPORT_H
+
+#include "http_transport.h"
+#include "response_writer.h"
+#include <WebServer.h>
+
+namespace wifiprov {
+
+/**
+ * @brief HttpTransport on the Arduino WebServer. One client at a time:
+ * each response is written out before the handler returns and the
+ * connection is closed after it.
+ */
+class WebServerTransport : public HttpTransport {
+public:
+  explicit WebServerTransport(uint16_t port);
+
+  bool begin() override {
+    _server.begin();
+    return true;
+  }
+  void end() override { _server.stop(); }
+  void poll() override { _server.handleClient(); }
+
+  bool on(const char *path, HttpMethod method, Handler handler) override;
+  void onNotFound(Handler handler) override { _server.onNotFound(handler); }
+  void collectHeaders(const char *const *names, size_t count) override;
+
+  String uri() override { return _server.uri(); }
+  String hostHeader() override { return _server.hostHeader(); }
+  String header(const char *name) override { return _server.header(name); }
+  bool hasArg(const char *name) override { return _server.hasArg(name); }
+  String arg(const char *name) override { return _server.arg(name); }
+  const char *body(size_t *length) override;
+
+  bool keepAlive() override { return false; }
+  Print *beginResponse() override;
+  void sendStable(const uint8_t *data, size_t length, SharedBuffer *owner) override;
+  ResponseStats endResponse() override;
+
+private:
+  WebServer _server;
+  WiFiClient _client;
+  ResponseWriter _out;
+  String _body; // WebServer hands the body out as a copy
+};
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_WEBSERVER_TRANSPORT_H
@@ -0,0 +1,243 @@
+#include "wpa_pmk.h"
+#include <string.h>
+
+namespace wifiprov {
+
+namespace {
+
+constexpr size_t kBlockLength = 64;
+constexpr size_t kDigestWords = 5;
+constexpr size_t kDigestLength = 4 * kDigestWords;
+constexpr uint32_t kIterations = 4096; // IEEE 802.11i, Annex J
+
+const uint32_t kInitialState[kDigestWords] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476,
+                                              0xC3D2E1F0};
+
+inline uint32_t rotl(uint32_t x, int n) { return x << n | x >> (32 - n); }
+
+inline uint32_t loadBigEndian(const uint8_t *p) {
+  return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+inline void storeBigEndian(uint8_t *p, uint32_t value) {
+  p[0] = value >> 24;
+  p[1] = value >> 16;
+  p[2] = value >> 8;
+  p[3] = value;
+}
+
+// One SHA-1 compression of the 16 message words in `w`, which serve as the
+// rolling message schedule and are overwritten.
+void compress(uint32_t *state, uint32_t *w) {
+  uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+  for (int i = 0; i < 80; ++i) {
+    if (i >= 16) {
+      w[i & 15] = rotl(w[(i + 13) & 15] ^ w[(i + 8) & 15] ^ w[(i + 2) & 15] ^ w[i & 15], 1);
+    }
+    uint32_t f;
+    uint32_t k;
+    if (i < 20) {
+      f = d ^ (b & (c ^ d));
+      k = 0x5A827999;
+    } else if (i < 40) {
+      f = b ^ c ^ d;
+      k = 0x6ED9EBA1;
+    } else if (i < 60) {
+      f = (b & c) | (d & (b | c));
+      k = 0x8F1BBCDC;
+    } else {
+      f = b ^ c ^ d;
+      k = 0xCA62C1D6;
+    }
+    uint32_t t = rotl(a, 5) + f + e + k + w[i & 15];
+    e = d;
+    d = c;
+    c = rotl(b, 30);
+    b = a;
+    a = t;
+  }
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+}
+
+void compressBytes(uint32_t *state, const uint8_t *block) {
+  uint32_t w[16];
+  for (int i = 0; i < 16; ++i) {
+    w[i] = loadBigEndian(block + 4 * i);
+  }
+  compress(state, w);
+}
+
+// Streaming SHA-1, for the parts whose length is not fixed: a long HMAC key
+// and the first PBKDF2 iteration over the salt
+struct Sha1 {
+  uint32_t state[kDigestWords];
+  uint8_t buffer[kBlockLength];
+  size_t buffered;
+  uint64_t length; // Bytes hashed so far
+
+  // Continues from `from`, a state that has absorbed `absorbed` bytes
+  void begin(const uint32_t *from, uint64_t absorbed) {
+    memcpy(state, from, sizeof(state));
+    buffered = 0;
+    length = absorbed;
+  }
+
+  void update(const uint8_t *data, size_t len) {
+    length += len;
+    while (len > 0) {
+      size_t take = kBlockLength - buffered;
+      if (take > len) {
+        take = len;
+      }
+      memcpy(buffer + buffered, data, take);
+      buffered += take;
+      data += take;
+      len -= take;
+      if (buffered == kBlockLength) {
+        compressBytes(state, buffer);
+        buffered = 0;
+      }
+    }
+  }
+
+  void finish(uint32_t *digest) {
+    uint64_t bits = length * 8;
+    buffer[buffered++] = 0x80;
+    if (buffered > kBlockLength - 8) {
+      memset(buffer + buffered, 0, kBlockLength - buffered);
+      compressBytes(state, buffer);
+      buffered = 0;
+    }
+    memset(buffer + buffered, 0, kBlockLength - 8 - buffered);
+    storeBigEndian(buffer + kBlockLength - 8, bits >> 32);
+    storeBigEndian(buffer + kBlockLength - 4, (uint32_t)bits);
+    compressBytes(state, buffer);
+    memcpy(digest, state, sizeof(state));
+    memset(this, 0, sizeof(*this));
+  }
+};
+
+// SHA-1 over a key pad already absorbed into `padState` and then a 20-byte
+// digest: one block whose padding and length never change
+void hashDigest(const uint32_t *padState, const uint32_t *digest, uint32_t *out) {
+  uint32_t w[16] = {digest[0], digest[1], digest[2], digest[3], digest[4], 0x80000000};
+  w[15] = (kBlockLength + kDigestLength) * 8;
+  memcpy(out, padState, kDigestLength);
+  compress(out, w);
+}
+
+} // namespace
+
+void pbkdf2HmacSha1(const uint8_t *password, size_t passwordLength, const uint8_t *salt,
+                    size_t saltLength, uint32_t iterations, uint8_t *out, size_t outLength) {
+  // HMAC key block: the password, or its digest if longer than a block
+  uint8_t key[kBlockLength] = {};
+  if (passwordLength > kBlockLength) {
+    Sha1 sha;
+    uint32_t digest[kDigestWords];
+    sha.begin(kInitialState, 0);
+    sha.update(password, passwordLength);
+    sha.finish(digest);
+    for (size_t i = 0; i < kDigestWords; ++i) {
+      storeBigEndian(key + 4 * i, digest[i]);
+    }
+  } else {
+    memcpy(key, password, passwordLength);
+  }
+
+  // Both pads are hashed once, not once per iteration
+  uint32_t inner[kDigestWords];
+  uint32_t outer[kDigestWords];
+  uint8_t pad[kBlockLength];
+  for (size_t i = 0; i < kBlockLength; ++i) {
+    pad[i] = key[i] ^ 0x36;
+  }
+  memcpy(inner, kInitialState, sizeof(inner));
+  compressBytes(inner, pad);
+  for (size_t i = 0; i < kBlockLength; ++i) {
+    pad[i] = key[i] ^ 0x5c;
+  }
+  memcpy(outer, kInitialState, sizeof(outer));
+  compressBytes(outer, pad);
+
+  uint32_t u[kDigestWords];
+  uint32_t t[kDigestWords];
+  uint32_t scratch[kDigestWords];
+  for (uint32_t block = 1; outLength > 0; ++block) {
+    // U1 = HMAC(password, salt || INT(block))
+    uint8_t index[4];
+    storeBigEndian(index, block);
+    Sha1 sha;
+    sha.begin(inner, kBlockLength);
+    sha.update(salt, saltLength);
+    sha.update(index, sizeof(index));
+    sha.finish(scratch);
+    hashDigest(outer, scratch, u);
+    memcpy(t, u, sizeof(t));
+
+    // Un = HMAC(password, Un-1), two fixed-shape blocks each
+    for (uint32_t i = 1; i < iterations; ++i) {
+      hashDigest(inner, u, scratch);
+      hashDigest(outer, scratch, u);
+      for (size_t j = 0; j < kDigestWords; ++j) {
+        t[j] ^= u[j];
+      }
+    }
+
+    uint8_t bytes[kDigestLength];
+    for (size_t i = 0; i < kDigestWords; ++i) {
+      storeBigEndian(bytes + 4 * i, t[i]);
+    }
+    size_t take = outLength < kDigestLength ? outLength : kDigestLength;
+    memcpy(out, bytes, take);
+    memset(bytes, 0, sizeof(bytes));
+    out += take;
+    outLength -= take;
+  }
+
+  memset(key, 0, sizeof(key));
+  memset(pad, 0, sizeof(pad));
+  memset(inner, 0, sizeof(inner));
+  memset(outer, 0, sizeof(outer));
+  memset(u, 0, sizeof(u));
+  memset(t, 0, sizeof(t));
+  memset(scratch, 0, sizeof(scratch));
+}
+
+bool derivePmk(const char *ssid, const char *passphrase, uint8_t *pmk) {
+  size_t ssidLength = strlen(ssid);
+  size_t passphraseLength = strlen(passphrase);
+  if (ssidLength == 0 || ssidLength > 32 || passphraseLength < 8 || passphraseLength > 63) {
+    return false;
+  }
+  pbkdf2HmacSha1((const uint8_t *)passphrase, passphraseLength, (const uint8_t *)ssid, ssidLength,
+                 kIterations, pmk, kPmkLength);
+  return true;
+}
+
+void formatPsk(const uint8_t *pmk, char *psk) {
+  static const char kHex[] = "0123456789abcdef";
+  for (size_t i = 0; i < kPmkLength; ++i) {
+    psk[2 * i] = kHex[pmk[i] >> 4];
+    psk[2 * i + 1] = kHex[pmk[i] & 15];
+  }
+  psk[kPskLength] = '\0';
+}
+
+bool isPsk(const char *password) {
+  size_t i = 0;
+  for (; password[i] != '\0'; ++i) {
+    char c = password[i];
+    bool hex = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+    if (!hex || i >= kPskLength) {
+      return false;
+    }
+  }
+  return i == kPskLength;
+}
+
+} // namespace wifiprov
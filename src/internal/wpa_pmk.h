@@ -0,0 +1,41 @@
+#ifndef WIFIPROVISIONER_WPA_PMK_H
+#define WIFIPROVISIONER_WPA_PMK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace wifiprov {
+
+// Bytes in a WPA2-Personal pairwise master key
+constexpr size_t kPmkLength = 32;
+// Characters in the same key written as hex, the form the Wi-Fi driver
+// accepts in place of a passphrase
+constexpr size_t kPskLength = 2 * kPmkLength;
+
+/**
+ * @brief PBKDF2 with HMAC-SHA1 (RFC 8018), writing `outLength` bytes.
+ *
+ * The HMAC key pads are hashed once up front and every later iteration is
+ * exactly two SHA-1 blocks, built in place as words, so 4096 iterations
+ * cost 8192 compressions per 20 bytes of output and nothing else.
+ */
+void pbkdf2HmacSha1(const uint8_t *password, size_t passwordLength, const uint8_t *salt,
+                    size_t saltLength, uint32_t iterations, uint8_t *out, size_t outLength);
+
+/**
+ * @brief Derives the PMK for `ssid` and `passphrase` as IEEE 802.11i
+ * specifies: PBKDF2-HMAC-SHA1 with the SSID as salt and 4096 iterations.
+ * False, with nothing written, if the passphrase is not 8 to 63 characters
+ * or the SSID is empty or longer than 32 bytes.
+ */
+bool derivePmk(const char *ssid, const char *passphrase, uint8_t *pmk);
+
+// Writes `pmk` as kPskLength lowercase hex digits and a terminator.
+void formatPsk(const uint8_t *pmk, char *psk);
+
+// True if `password` is a PMK in hex rather than a passphrase.
+bool isPsk(const char *password);
+
+} // namespace wifiprov
+
+#endif // WIFIPROVISIONER_WPA_PMK_H